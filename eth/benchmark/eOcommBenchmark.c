@@ -0,0 +1,1025 @@
+/*
+ * Copyright (C) 2026 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  iCub Facility
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - description
+// --------------------------------------------------------------------------------------------------------------------
+
+// host micro-benchmark of the comm-v2 transport stack. it builds a device side (local board w/ regular rops loaded
+// in its EOtransceiver) and a host side (an EOhostTransceiver for the same board seen as remote) and measures ns/op
+// of the functions which run every cycle of the 1 kHz loop.
+// usage: eOcommBenchmark [iterations]
+// the numbers are meaningful only if the libraries are compiled in release mode.
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+#include <time.h>
+
+#include "EoCommon.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVtheSystem_hid.h"
+
+#include "EoProtocol.h"
+#include "EoProtocolMC.h"
+#include "EoProtocolAS.h"
+#include "EoProtocolSK.h"
+
+#include "EOnvSet.h"
+#include "EOnvSetArena.h"
+#include "EOnv.h"
+#include "EOrop.h"
+#include "EOropframe.h"
+#include "EOpacket.h"
+#include "EOtransmitter.h"
+#include "EOreceiver.h"
+#include "EOtransceiver.h"
+#include "EOhostTransceiver.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define BENCH_DEFAULT_ITERATIONS    100000
+
+#define BENCH_IPADDR_HOST           EO_COMMON_IPV4ADDR(10, 0, 1, 104)
+#define BENCH_IPADDR_BOARD          EO_COMMON_IPV4ADDR(10, 0, 1, 1)
+#define BENCH_PORT                  12345
+
+#define BENCH_MAX_REGULARS          64
+
+#define BENCH_BATCH_SIZE            8
+
+// in the delta mode of the regulars an unchanged rop is transmitted once every BENCH_DELTA_KEYFRAME times
+#define BENCH_DELTA_KEYFRAME        16
+
+// in the schedule mode of the regulars the status of the motors is transmitted once every BENCH_SCHEDULE_PERIOD times
+#define BENCH_SCHEDULE_PERIOD       4
+
+// the board number used by the nv_Get benchmarks for their own EOnvSet is remoteboard + BENCH_NV_BOARD_OFFSET
+#define BENCH_NV_BOARD_OFFSET       2
+
+// the capacity of the change queue of the host
+#define BENCH_CHANGEQUEUE_CAPACITY  256
+
+// the number of buffers of the snapshots of the endpoints of the host
+#define BENCH_SNAPSHOT_BUFFERS      3
+
+// the fleet of boards used by the nvset_Fleet benchmarks: their numbers are BENCH_FLEET_FIRSTBOARD and the following ones
+#define BENCH_FLEET_BOARDS          16
+#define BENCH_FLEET_FIRSTBOARD      8
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    eOprotEndpoint_t    ep;
+    eOprotEntity_t      entity;
+    eOprotTag_t         tag;
+} bench_regular_t;
+
+typedef struct
+{
+    const char*         name;
+    eOnvset_BRDcfg_t    brdcfg;
+    eOnvBRD_t           remoteboard;        // number used by the host for the board
+    EOnvSet*            devnvset;
+    EOtransceiver*      device;
+    EOhostTransceiver*  host;
+    eOprotID32_t        regulars[BENCH_MAX_REGULARS];
+    uint16_t            numofregulars;
+    EOpacket*           packet;             // a copy of a packet formed by the device
+} bench_context_t;
+
+typedef uint64_t (*bench_fn_t)(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+typedef eOresult_t (*bench_parse_fn_t)(EOropframe *p, EOrop *rop, uint16_t *unparsed);
+
+typedef struct
+{
+    const char*         name;
+    bench_fn_t          fn;
+} bench_item_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_bench_system_init(void);
+static void s_bench_onerror(eOerrmanErrorType_t errtype, const char *info, eOerrmanCaller_t *caller, const eOerrmanDescriptor_t *des);
+static eOresult_t s_bench_sys_start(void (*init_fn)(void));
+static void* s_bench_sys_gettask(void);
+static eOabstime_t s_bench_sys_abstime_get(void);
+static void s_bench_sys_abstime_set(eOabstime_t time);
+static uint64_t s_bench_sys_nanotime_get(void);
+
+static uint64_t s_bench_now(void);
+
+static void s_bench_context_init(bench_context_t *ctx);
+static void s_bench_context_deinit(bench_context_t *ctx);
+static void s_bench_packet_renumber(EOpacket *pkt, uint64_t seqnum);
+
+static uint64_t s_bench_transmitter_outpacket_prepare(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_transmitter_outpacket_prepare_crc(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_transmitter_outpacket_prepare_delta(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_transmitter_outpacket_prepare_sched(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_transmitter_outpacket_getiov(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_transmitter_regular_rops_reload(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_receiver_process(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_transceiver_receive(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_transceiver_receivebatch(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_ropframe_rop_add(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_ropframe_rop_parse(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_ropframe_rop_parse_zerocopy(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_ropframe_rops_arevalid(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_ropframe_parse_with(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration, bench_parse_fn_t parse);
+static uint64_t s_bench_ropframe_crc_seal(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_ropframe_isvalid_crc(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_nvset_nv_get(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_nv_get(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_nv_get_seqlock(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_nv_get_with(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration, eOnvset_protection_t protection);
+static uint64_t s_bench_nvset_fleet_aggregate(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_nvset_fleet_aggregate_arena(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_nvset_fleet_aggregate_with(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration, eObool_t usearena);
+static uint64_t s_bench_receiver_process_statstiming(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_receiver_process_changequeue(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+static uint64_t s_bench_receiver_process_snapshot(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const eOtransceiver_sizes_t s_bench_device_sizes =
+{
+    EO_INIT(.capacityoftxpacket)            1440,
+    EO_INIT(.capacityofrop)                 256,
+    EO_INIT(.capacityofropframeregulars)    1024,
+    EO_INIT(.capacityofropframeoccasionals) 256,
+    EO_INIT(.capacityofropframereplies)     256,
+    EO_INIT(.maxnumberofregularrops)        BENCH_MAX_REGULARS
+};
+
+// the regulars which a board typically sends: the status of every jomo and of the sensors.
+// the ones whose entity is not present in the board configuration are simply skipped.
+static const bench_regular_t s_bench_regulars[] =
+{
+    { eoprot_endpoint_motioncontrol,    eoprot_entity_mc_joint,     eoprot_tag_mc_joint_status },
+    { eoprot_endpoint_motioncontrol,    eoprot_entity_mc_motor,     eoprot_tag_mc_motor_status },
+    { eoprot_endpoint_analogsensors,    eoprot_entity_as_strain,    eoprot_tag_as_strain_status },
+    { eoprot_endpoint_analogsensors,    eoprot_entity_as_mais,      eoprot_tag_as_mais_status },
+    { eoprot_endpoint_skin,             eoprot_entity_sk_skin,      eoprot_tag_sk_skin_status_arrayofcandata }
+};
+
+static const bench_item_t s_bench_items[] =
+{
+    { "transmitter_outpacket_Prepare",      s_bench_transmitter_outpacket_prepare },
+    { "transmitter_outpacket_PrepareCRC",   s_bench_transmitter_outpacket_prepare_crc },
+    { "transmitter_outpacket_PrepareDelta", s_bench_transmitter_outpacket_prepare_delta },
+    { "transmitter_outpacket_PrepareSched", s_bench_transmitter_outpacket_prepare_sched },
+    { "transmitter_outpacket_GetIOV",       s_bench_transmitter_outpacket_getiov },
+    { "transmitter_regular_rops_Reload",    s_bench_transmitter_regular_rops_reload },
+    { "receiver_Process",                   s_bench_receiver_process },
+    { "receiver_Process_StatsTiming",       s_bench_receiver_process_statstiming },
+    { "transceiver_Receive",                s_bench_transceiver_receive },
+    { "transceiver_ReceiveBatch",           s_bench_transceiver_receivebatch },
+    { "ropframe_ROP_Add",                   s_bench_ropframe_rop_add },
+    { "ropframe_ROP_Parse",                 s_bench_ropframe_rop_parse },
+    { "ropframe_ROP_Parse_zerocopy",        s_bench_ropframe_rop_parse_zerocopy },
+    { "ropframe_ROPs_AreValid",             s_bench_ropframe_rops_arevalid },
+    { "ropframe_CRC_Seal",                  s_bench_ropframe_crc_seal },
+    { "ropframe_IsValid_CRC",               s_bench_ropframe_isvalid_crc },
+    { "nvset_NV_Get",                       s_bench_nvset_nv_get },
+    { "nv_Get",                             s_bench_nv_get },
+    { "nv_Get_Seqlock",                     s_bench_nv_get_seqlock },
+    { "nvset_Fleet_Aggregate",              s_bench_nvset_fleet_aggregate },
+    { "nvset_Fleet_Aggregate_Arena",        s_bench_nvset_fleet_aggregate_arena },
+    { "receiver_Process_ChangeQueue",       s_bench_receiver_process_changequeue },    // keep them last: they enable the change queue 
+    { "receiver_Process_Snapshot",          s_bench_receiver_process_snapshot }        // and the snapshots of the host
+};
+
+static struct timespec s_bench_start_time;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of main
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = BENCH_DEFAULT_ITERATIONS;
+    bench_context_t contexts[2];
+    uint8_t c = 0;
+    uint8_t i = 0;
+
+    if(argc > 1)
+    {
+        iterations = strtoul(argv[1], NULL, 0);
+        if(0 == iterations)
+        {
+            iterations = BENCH_DEFAULT_ITERATIONS;
+        }
+    }
+
+    s_bench_system_init();
+
+    memset(contexts, 0, sizeof(contexts));
+    contexts[0].name = "BRDcfgStd";
+    memcpy(&contexts[0].brdcfg, &eonvset_BRDcfgStd, sizeof(eOnvset_BRDcfg_t));
+    contexts[0].remoteboard = 1;
+    contexts[1].name = "BRDcfgMax";
+    memcpy(&contexts[1].brdcfg, &eonvset_BRDcfgMax, sizeof(eOnvset_BRDcfg_t));
+    contexts[1].remoteboard = 2;
+
+    printf("%-36s %-10s %6s %12s %10s\n", "benchmark", "config", "rops", "iterations", "ns/op");
+
+    for(c=0; c<sizeof(contexts)/sizeof(contexts[0]); c++)
+    {
+        s_bench_context_init(&contexts[c]);
+
+        for(i=0; i<sizeof(s_bench_items)/sizeof(s_bench_items[0]); i++)
+        {
+            uint32_t opsperiteration = 1;
+            uint64_t ns = s_bench_items[i].fn(&contexts[c], iterations, &opsperiteration);
+            uint64_t ops = (uint64_t)iterations * opsperiteration;
+            printf("%-36s %-10s %6d %12llu %10.1f\n", s_bench_items[i].name, contexts[c].name, contexts[c].numofregulars,
+                   (unsigned long long)ops, (0 == ops) ? (0.0) : ((double)ns / (double)ops));
+        }
+
+        s_bench_context_deinit(&contexts[c]);
+    }
+
+    return(EXIT_SUCCESS);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_bench_system_init(void)
+{
+    eOerrman_cfg_t errmancfg;
+
+    memcpy(&errmancfg, &eo_errman_DefaultCfg, sizeof(eOerrman_cfg_t));
+    errmancfg.extfn.usr_on_error = s_bench_onerror;
+
+    clock_gettime(CLOCK_MONOTONIC, &s_bench_start_time);
+
+    // a minimal host system: the memory pool is dynamic and the time comes from clock_gettime()
+    eov_sys_hid_Initialise(NULL, &errmancfg,
+                           s_bench_sys_start, s_bench_sys_gettask,
+                           s_bench_sys_abstime_get, s_bench_sys_abstime_set,
+                           s_bench_sys_nanotime_get, NULL);
+}
+
+
+static void s_bench_onerror(eOerrmanErrorType_t errtype, const char *info, eOerrmanCaller_t *caller, const eOerrmanDescriptor_t *des)
+{
+    if(errtype < eo_errortype_error)
+    {
+        return;
+    }
+
+    printf("eOcommBenchmark: error %d from %s: %s\n", errtype, ((NULL != caller) && (NULL != caller->eobjstr)) ? (caller->eobjstr) : ("unknown"), (NULL != info) ? (info) : (""));
+
+    if(eo_errortype_fatal == errtype)
+    {
+        exit(EXIT_FAILURE);
+    }
+}
+
+
+static eOresult_t s_bench_sys_start(void (*init_fn)(void))
+{
+    if(NULL != init_fn)
+    {
+        init_fn();
+    }
+    return(eores_OK);
+}
+
+
+static void* s_bench_sys_gettask(void)
+{
+    return(NULL);
+}
+
+
+static eOabstime_t s_bench_sys_abstime_get(void)
+{
+    return((s_bench_now() - ((uint64_t)s_bench_start_time.tv_sec * 1000000000ULL + s_bench_start_time.tv_nsec)) / 1000);
+}
+
+
+static void s_bench_sys_abstime_set(eOabstime_t time)
+{
+    // do nothing
+}
+
+
+static uint64_t s_bench_sys_nanotime_get(void)
+{
+    return(s_bench_now());
+}
+
+
+static uint64_t s_bench_now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return((uint64_t)t.tv_sec * 1000000000ULL + t.tv_nsec);
+}
+
+
+static void s_bench_context_init(bench_context_t *ctx)
+{
+    eOtransceiver_cfg_t devcfg = eo_transceiver_cfg_default;
+    eOhosttransceiver_cfg_t hostcfg = eo_hosttransceiver_cfg_default;
+    eOropdescriptor_t ropdesc;
+    EOpacket *pkt = NULL;
+    uint16_t numberofrops = 0;
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint8_t r = 0;
+    uint8_t n = 0;
+    uint8_t index = 0;
+
+    // the device: the board is local and it has regular rops
+    ctx->devnvset = eo_nvset_New(eo_nvset_protection_none, NULL);
+    eo_nvset_InitBRD_LoadEPs(ctx->devnvset, eo_nvset_ownership_local, BENCH_IPADDR_BOARD, &ctx->brdcfg, eobool_true);
+
+    memcpy(&devcfg.sizes, &s_bench_device_sizes, sizeof(eOtransceiver_sizes_t));
+    devcfg.remipv4addr  = BENCH_IPADDR_HOST;
+    devcfg.remipv4port  = BENCH_PORT;
+    devcfg.nvset        = ctx->devnvset;
+    devcfg.zerocopy     = eobool_true;
+    ctx->device = eo_transceiver_New(&devcfg);
+
+    memcpy(&ropdesc, &eok_ropdesc_basic, sizeof(eOropdescriptor_t));
+    ropdesc.ropcode = eo_ropcode_sig;
+
+    ctx->numofregulars = 0;
+    for(r=0; r<sizeof(s_bench_regulars)/sizeof(s_bench_regulars[0]); r++)
+    {
+        n = eoprot_entity_numberof_get(eoprot_board_localboard, s_bench_regulars[r].ep, s_bench_regulars[r].entity);
+        for(index=0; (index<n) && (ctx->numofregulars < BENCH_MAX_REGULARS); index++)
+        {
+            ropdesc.id32 = eoprot_ID_get(s_bench_regulars[r].ep, s_bench_regulars[r].entity, index, s_bench_regulars[r].tag);
+            if(eores_OK == eo_transceiver_RegularROP_Load(ctx->device, &ropdesc))
+            {
+                ctx->regulars[ctx->numofregulars++] = ropdesc.id32;
+            }
+        }
+    }
+
+    // the host: the same board is remote
+    ctx->brdcfg.boardnum = ctx->remoteboard;
+    hostcfg.nvsetbrdcfg                 = &ctx->brdcfg;
+    hostcfg.remoteboardipv4addr         = BENCH_IPADDR_BOARD;
+    hostcfg.remoteboardipv4port         = BENCH_PORT;
+    hostcfg.zerocopy                    = eobool_true;
+    ctx->host = eo_hosttransceiver_New(&hostcfg);
+
+    // a reference packet formed by the device
+    eo_transceiver_outpacket_Prepare(ctx->device, &numberofrops, NULL);
+    eo_transceiver_outpacket_Get(ctx->device, &pkt);
+    eo_packet_Payload_Get(pkt, &data, &size);
+    ctx->packet = eo_packet_New(s_bench_device_sizes.capacityoftxpacket);
+    eo_packet_Full_Set(ctx->packet, BENCH_IPADDR_BOARD, BENCH_PORT, size, data);
+}
+
+
+static void s_bench_context_deinit(bench_context_t *ctx)
+{
+    eo_packet_Delete(ctx->packet);
+    eo_hosttransceiver_Delete(ctx->host);
+    eo_transceiver_Delete(ctx->device);
+    eo_nvset_Delete(ctx->devnvset);
+}
+
+
+static void s_bench_packet_renumber(EOpacket *pkt, uint64_t seqnum)
+{
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    eo_packet_Payload_Get(pkt, &data, &size);
+    eo_ropframedata_seqnum_Set((EOropframeData*)data, seqnum);
+}
+
+
+static uint64_t s_bench_transmitter_outpacket_prepare(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOtransmitter *transmitter = eo_transceiver_GetTransmitter(ctx->device);
+    EOpacket *pkt = NULL;
+    uint16_t numberofrops = 0;
+    uint64_t start = 0;
+    uint32_t i = 0;
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        eo_transmitter_outpacket_Prepare(transmitter, &numberofrops, NULL);
+        eo_transmitter_outpacket_Get(transmitter, &pkt);
+    }
+    return(s_bench_now() - start);
+}
+
+
+static uint64_t s_bench_transmitter_outpacket_prepare_crc(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOtransmitter *transmitter = eo_transceiver_GetTransmitter(ctx->device);
+    uint64_t duration = 0;
+
+    eo_transmitter_ropframeCRC_Set(transmitter, eobool_true);
+    duration = s_bench_transmitter_outpacket_prepare(ctx, iterations, opsperiteration);
+    eo_transmitter_ropframeCRC_Set(transmitter, eobool_false);
+    
+    return(duration);
+}
+
+
+// the values of the netvars do not change, thus the regulars are transmitted only at their keyframe
+static uint64_t s_bench_transmitter_outpacket_prepare_delta(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOtransmitter *transmitter = eo_transceiver_GetTransmitter(ctx->device);
+    uint64_t duration = 0;
+
+    eo_transmitter_regular_rops_Delta_Set(transmitter, BENCH_DELTA_KEYFRAME);
+    duration = s_bench_transmitter_outpacket_prepare(ctx, iterations, opsperiteration);
+    eo_transmitter_regular_rops_Delta_Set(transmitter, 0);
+    
+    return(duration);
+}
+
+
+// the motors have their own period, all the other regulars keep the default schedule
+static uint64_t s_bench_transmitter_outpacket_prepare_sched(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOtransmitter *transmitter = eo_transceiver_GetTransmitter(ctx->device);
+    uint64_t duration = 0;
+
+    eo_transmitter_regular_rops_Schedule_Set(transmitter, eoprot_endpoint_motioncontrol, eoprot_entity_mc_motor, BENCH_SCHEDULE_PERIOD, 0);
+    duration = s_bench_transmitter_outpacket_prepare(ctx, iterations, opsperiteration);
+    eo_transmitter_regular_rops_Schedule_Set(transmitter, eoprot_endpoint_motioncontrol, eoprot_entity_mc_motor, 0, 0);
+    
+    return(duration);
+}
+
+
+static uint64_t s_bench_transmitter_outpacket_getiov(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOtransmitter *transmitter = eo_transceiver_GetTransmitter(ctx->device);
+    eOtransmitter_iov_t iov;
+    uint16_t numberofrops = 0;
+    uint64_t start = 0;
+    uint32_t i = 0;
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        eo_transmitter_outpacket_GetIOV(transmitter, &iov, &numberofrops, NULL);
+    }
+    return(s_bench_now() - start);
+}
+
+
+static uint64_t s_bench_transmitter_regular_rops_reload(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOtransmitter *transmitter = eo_transceiver_GetTransmitter(ctx->device);
+    eOropdescriptor_t ropdesc;
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+    uint32_t i = 0;
+    uint8_t r = 0;
+
+    // the reconfiguration of the regulars: every iteration unloads and loads again all of them, in the order of loading
+    memcpy(&ropdesc, &eok_ropdesc_basic, sizeof(eOropdescriptor_t));
+    ropdesc.ropcode = eo_ropcode_sig;
+
+    for(i=0; i<iterations; i++)
+    {
+        start = s_bench_now();
+        for(r=0; r<ctx->numofregulars; r++)
+        {
+            ropdesc.id32 = ctx->regulars[r];
+            eo_transmitter_regular_rops_Unload(transmitter, &ropdesc);
+        }
+        for(r=0; r<ctx->numofregulars; r++)
+        {
+            ropdesc.id32 = ctx->regulars[r];
+            eo_transmitter_regular_rops_Load(transmitter, &ropdesc);
+        }
+        elapsed += (s_bench_now() - start);
+    }
+
+    *opsperiteration = 2*ctx->numofregulars;
+    return(elapsed);
+}
+
+
+static uint64_t s_bench_receiver_process(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOreceiver *receiver = eo_transceiver_GetReceiver(eo_hosttransceiver_GetTransceiver(ctx->host));
+    uint16_t numberofrops = 0;
+    eObool_t thereisareply = eobool_false;
+    eOabstime_t txtime = 0;
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+    uint32_t i = 0;
+
+    // the sequence number must progress, otherwise the receiver signals errors at every packet.
+    for(i=0; i<iterations; i++)
+    {
+        s_bench_packet_renumber(ctx->packet, i + 1);
+        start = s_bench_now();
+        eo_receiver_Process(receiver, ctx->packet, &numberofrops, &thereisareply, &txtime);
+        elapsed += (s_bench_now() - start);
+    }
+    return(elapsed);
+}
+
+
+static uint64_t s_bench_transceiver_receive(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOtransceiver *transceiver = eo_hosttransceiver_GetTransceiver(ctx->host);
+    uint16_t numberofrops = 0;
+    eOabstime_t txtime = 0;
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+    uint32_t i = 0;
+
+    for(i=0; i<iterations; i++)
+    {
+        s_bench_packet_renumber(ctx->packet, i + 1);
+        start = s_bench_now();
+        eo_transceiver_Receive(transceiver, ctx->packet, &numberofrops, &txtime);
+        elapsed += (s_bench_now() - start);
+    }
+    return(elapsed);
+}
+
+
+static uint64_t s_bench_transceiver_receivebatch(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOhostTransceiver *destinations[BENCH_BATCH_SIZE];
+    EOpacket *packets[BENCH_BATCH_SIZE];
+    eOreceiver_result_t results[BENCH_BATCH_SIZE];
+    uint16_t capacity = 0;
+    uint64_t seqnum = 1;
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+    uint32_t i = 0;
+    uint8_t b = 0;
+
+    // every iteration processes BENCH_BATCH_SIZE copies of the reference packet with consecutive sequence numbers
+    eo_packet_Capacity_Get(ctx->packet, &capacity);
+    for(b=0; b<BENCH_BATCH_SIZE; b++)
+    {
+        destinations[b] = ctx->host;
+        packets[b] = eo_packet_New(capacity);
+        eo_packet_Copy(packets[b], ctx->packet);
+    }
+
+    for(i=0; i<iterations; i++)
+    {
+        for(b=0; b<BENCH_BATCH_SIZE; b++)
+        {
+            s_bench_packet_renumber(packets[b], seqnum++);
+        }
+        start = s_bench_now();
+        eo_hosttransceiver_ReceiveBatch(destinations, packets, BENCH_BATCH_SIZE, results);
+        elapsed += (s_bench_now() - start);
+    }
+
+    for(b=0; b<BENCH_BATCH_SIZE; b++)
+    {
+        eo_packet_Delete(packets[b]);
+    }
+
+    *opsperiteration = BENCH_BATCH_SIZE;
+    return(elapsed);
+}
+
+
+static uint64_t s_bench_ropframe_rop_add(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOropframe *input = eo_ropframe_New();
+    EOropframe *output = eo_ropframe_New();
+    EOrop *rop = eo_rop_New(s_bench_device_sizes.capacityofrop);
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint16_t capacity = 0;
+    uint16_t remaining = 0;
+    uint8_t *outdata = NULL;
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+    uint32_t i = 0;
+
+    outdata = (uint8_t*) calloc(s_bench_device_sizes.capacityoftxpacket, 1);
+    eo_ropframe_Load(output, outdata, eo_ropframe_sizeforZEROrops, s_bench_device_sizes.capacityoftxpacket);
+    eo_ropframe_Clear(output);
+
+    // we add always the first rop of the reference packet. when the frame is full we clear it.
+    eo_packet_Payload_Get(ctx->packet, &data, &size);
+    eo_packet_Capacity_Get(ctx->packet, &capacity);
+    eo_ropframe_Load(input, data, size, capacity);
+    eo_ropframe_ROP_Parse(input, rop, &remaining);
+
+    for(i=0; i<iterations; i++)
+    {
+        start = s_bench_now();
+        if(eores_OK != eo_ropframe_ROP_Add(output, rop, NULL, NULL, &remaining))
+        {
+            eo_ropframe_Clear(output);
+            eo_ropframe_ROP_Add(output, rop, NULL, NULL, &remaining);
+        }
+        elapsed += (s_bench_now() - start);
+    }
+
+    eo_rop_Delete(rop);
+    eo_ropframe_Delete(output);
+    eo_ropframe_Delete(input);
+    free(outdata);
+
+    return(elapsed);
+}
+
+
+static uint64_t s_bench_ropframe_parse_with(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration, bench_parse_fn_t parse)
+{
+    EOropframe *input = eo_ropframe_New();
+    EOrop *rop = eo_rop_New(s_bench_device_sizes.capacityofrop);
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint16_t capacity = 0;
+    uint16_t remaining = 0;
+    uint16_t n = 0;
+    uint16_t r = 0;
+    uint64_t start = 0;
+    uint32_t i = 0;
+
+    eo_packet_Payload_Get(ctx->packet, &data, &size);
+    eo_packet_Capacity_Get(ctx->packet, &capacity);
+    eo_ropframe_Load(input, data, size, capacity);
+    n = eo_ropframe_ROP_NumberOf(input);
+    *opsperiteration = n;
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        // the load resets the parsing position
+        eo_ropframe_Load(input, data, size, capacity);
+        for(r=0; r<n; r++)
+        {
+            parse(input, rop, &remaining);
+        }
+    }
+    start = s_bench_now() - start;
+
+    eo_rop_Delete(rop);
+    eo_ropframe_Delete(input);
+
+    return(start);
+}
+
+
+static uint64_t s_bench_ropframe_rop_parse(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    return(s_bench_ropframe_parse_with(ctx, iterations, opsperiteration, eo_ropframe_ROP_Parse));
+}
+
+
+static uint64_t s_bench_ropframe_rop_parse_zerocopy(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    return(s_bench_ropframe_parse_with(ctx, iterations, opsperiteration, eo_ropframe_ROP_Parse_zerocopy));
+}
+
+
+static uint64_t s_bench_ropframe_rops_arevalid(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOropframe *input = eo_ropframe_New();
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint16_t capacity = 0;
+    uint64_t start = 0;
+    uint32_t i = 0;
+
+    eo_packet_Payload_Get(ctx->packet, &data, &size);
+    eo_packet_Capacity_Get(ctx->packet, &capacity);
+    eo_ropframe_Load(input, data, size, capacity);
+    *opsperiteration = 1;
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        eo_ropframe_ROPs_AreValid(input);
+    }
+    start = s_bench_now() - start;
+
+    eo_ropframe_Delete(input);
+
+    return(start);
+}
+
+
+static uint64_t s_bench_ropframe_crc_seal(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOropframe *input = eo_ropframe_New();
+    EOpacket *pkt = NULL;
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint16_t capacity = 0;
+    uint64_t start = 0;
+    uint32_t i = 0;
+
+    // the seal changes the frame, thus we work on a copy of the packet
+    eo_packet_Capacity_Get(ctx->packet, &capacity);
+    pkt = eo_packet_New(capacity);
+    eo_packet_Copy(pkt, ctx->packet);
+    eo_packet_Payload_Get(pkt, &data, &size);
+    eo_ropframe_Load(input, data, size, capacity);
+    *opsperiteration = 1;
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        eo_ropframe_CRC_Seal(input);
+    }
+    start = s_bench_now() - start;
+
+    eo_ropframe_Delete(input);
+    eo_packet_Delete(pkt);
+
+    return(start);
+}
+
+
+static uint64_t s_bench_ropframe_isvalid_crc(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOropframe *input = eo_ropframe_New();
+    EOpacket *pkt = NULL;
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint16_t capacity = 0;
+    uint64_t start = 0;
+    uint32_t i = 0;
+
+    eo_packet_Capacity_Get(ctx->packet, &capacity);
+    pkt = eo_packet_New(capacity);
+    eo_packet_Copy(pkt, ctx->packet);
+    eo_packet_Payload_Get(pkt, &data, &size);
+    eo_ropframe_Load(input, data, size, capacity);
+    eo_ropframe_CRC_Seal(input);
+    *opsperiteration = 1;
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        eo_ropframe_IsValid(input);
+    }
+    start = s_bench_now() - start;
+
+    eo_ropframe_Delete(input);
+    eo_packet_Delete(pkt);
+
+    return(start);
+}
+
+
+static uint64_t s_bench_nvset_nv_get(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOnvSet *nvset = eo_hosttransceiver_GetNVset(ctx->host);
+    EOnv *nv = eo_nv_New();
+    uint64_t start = 0;
+    uint32_t i = 0;
+    uint16_t r = 0;
+
+    *opsperiteration = ctx->numofregulars;
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        for(r=0; r<ctx->numofregulars; r++)
+        {
+            eo_nvset_NV_Get(nvset, ctx->regulars[r], nv);
+        }
+    }
+    start = s_bench_now() - start;
+
+    eo_nv_Delete(nv);
+
+    return(start);
+}
+
+
+static uint64_t s_bench_nv_get(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    return(s_bench_nv_get_with(ctx, iterations, opsperiteration, eo_nvset_protection_none));
+}
+
+
+static uint64_t s_bench_nv_get_seqlock(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    return(s_bench_nv_get_with(ctx, iterations, opsperiteration, eo_nvset_protection_seqlock));
+}
+
+
+static uint64_t s_bench_nv_get_with(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration, eOnvset_protection_t protection)
+{
+    eOnvset_BRDcfg_t brdcfg;
+    EOnvSet *nvset = eo_nvset_New(protection, NULL);
+    EOnv *nvs[BENCH_MAX_REGULARS];
+    uint8_t data[1024];
+    uint16_t size = 0;
+    uint64_t start = 0;
+    uint32_t i = 0;
+    uint16_t r = 0;
+
+    // the read side of the host: a remote board whose netvars are read by the threads of the application
+    memcpy(&brdcfg, &ctx->brdcfg, sizeof(eOnvset_BRDcfg_t));
+    brdcfg.boardnum = ctx->remoteboard + BENCH_NV_BOARD_OFFSET;
+    eoprot_config_board_reserve(brdcfg.boardnum);
+    eo_nvset_InitBRD_LoadEPs(nvset, eo_nvset_ownership_remote, BENCH_IPADDR_BOARD, &brdcfg, eobool_true);
+
+    for(r=0; r<ctx->numofregulars; r++)
+    {
+        nvs[r] = eo_nv_New();
+        eo_nvset_NV_Get(nvset, ctx->regulars[r], nvs[r]);
+    }
+
+    *opsperiteration = ctx->numofregulars;
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        for(r=0; r<ctx->numofregulars; r++)
+        {
+            eo_nv_Get(nvs[r], eo_nv_strg_volatile, data, &size);
+        }
+    }
+    start = s_bench_now() - start;
+
+    for(r=0; r<ctx->numofregulars; r++)
+    {
+        eo_nv_Delete(nvs[r]);
+    }
+    eo_nvset_Delete(nvset);
+
+    return(start);
+}
+
+
+static uint64_t s_bench_nvset_fleet_aggregate(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    return(s_bench_nvset_fleet_aggregate_with(ctx, iterations, opsperiteration, eobool_false));
+}
+
+
+static uint64_t s_bench_nvset_fleet_aggregate_arena(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    return(s_bench_nvset_fleet_aggregate_with(ctx, iterations, opsperiteration, eobool_true));
+}
+
+
+static uint64_t s_bench_nvset_fleet_aggregate_with(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration, eObool_t usearena)
+{
+    eOnvset_BRDcfg_t brdcfgs[BENCH_FLEET_BOARDS];
+    const eOnvset_BRDcfg_t* pbrdcfgs[BENCH_FLEET_BOARDS];
+    EOnvSet *nvsets[BENCH_FLEET_BOARDS];
+    const eOmc_joint_t *joints[BENCH_FLEET_BOARDS];
+    uint8_t numberofjoints[BENCH_FLEET_BOARDS];
+    EOnvSetArena *arena = NULL;
+    volatile int64_t sum = 0;
+    uint64_t start = 0;
+    uint32_t i = 0;
+    uint8_t b = 0;
+    uint8_t j = 0;
+
+    // the per-ms aggregation loop of a host which talks to a fleet of boards: it reads the position of all the joints
+    for(b=0; b<BENCH_FLEET_BOARDS; b++)
+    {
+        memcpy(&brdcfgs[b], &ctx->brdcfg, sizeof(eOnvset_BRDcfg_t));
+        brdcfgs[b].boardnum = BENCH_FLEET_FIRSTBOARD + b;
+        pbrdcfgs[b] = &brdcfgs[b];
+        eoprot_config_board_reserve(brdcfgs[b].boardnum);
+    }
+
+    if(eobool_true == usearena)
+    {
+        arena = eo_nvsetarena_New(pbrdcfgs, BENCH_FLEET_BOARDS);
+    }
+
+    *opsperiteration = 0;
+    for(b=0; b<BENCH_FLEET_BOARDS; b++)
+    {
+        nvsets[b] = eo_nvset_New(eo_nvset_protection_none, NULL);
+        eo_nvsetarena_Slot_Assign(arena, b, nvsets[b]);
+        eo_nvset_InitBRD_LoadEPs(nvsets[b], eo_nvset_ownership_remote, BENCH_IPADDR_BOARD + b, &brdcfgs[b], eobool_true);
+        joints[b] = (const eOmc_joint_t*) eo_nvset_RAMofEntity_Get(nvsets[b], eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 0);
+        numberofjoints[b] = (NULL == joints[b]) ? (0) : (eoprot_entity_numberof_get(brdcfgs[b].boardnum, eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint));
+        *opsperiteration += numberofjoints[b];
+    }
+
+    start = s_bench_now();
+    for(i=0; i<iterations; i++)
+    {
+        for(b=0; b<BENCH_FLEET_BOARDS; b++)
+        {
+            for(j=0; j<numberofjoints[b]; j++)
+            {
+                sum += joints[b][j].status.core.measures.meas_position;
+            }
+        }
+    }
+    start = s_bench_now() - start;
+
+    for(b=0; b<BENCH_FLEET_BOARDS; b++)
+    {
+        eo_nvset_Delete(nvsets[b]);
+    }
+    eo_nvsetarena_Delete(arena);
+
+    return(start);
+}
+
+
+static uint64_t s_bench_receiver_process_statstiming(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOreceiver *receiver = eo_transceiver_GetReceiver(eo_hosttransceiver_GetTransceiver(ctx->host));
+    uint64_t elapsed = 0;
+
+    // the same as receiver_Process but the statistics also keep the histograms of times
+    eo_receiver_Stats_Timing_Enable(receiver, eobool_true);
+    elapsed = s_bench_receiver_process(ctx, iterations, opsperiteration);
+    eo_receiver_Stats_Timing_Enable(receiver, eobool_false);
+
+    return(elapsed);
+}
+
+
+static uint64_t s_bench_receiver_process_changequeue(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOnvSet *nvset = eo_hosttransceiver_GetNVset(ctx->host);
+    eOnvset_change_t changes[BENCH_MAX_REGULARS];
+    uint32_t cursor = 0;
+    uint64_t elapsed = 0;
+    uint64_t start = 0;
+
+    // the same as receiver_Process but every say<> / sig<> is also recorded in the change queue, which a consumer drains
+    eo_nvset_ChangeQueue_Enable(nvset, BENCH_CHANGEQUEUE_CAPACITY);
+    cursor = eo_nvset_ChangeQueue_Cursor_Get(nvset);
+
+    elapsed = s_bench_receiver_process(ctx, iterations, opsperiteration);
+
+    start = s_bench_now();
+    while(0 != eo_nvset_ChangeQueue_Get(nvset, &cursor, changes, BENCH_MAX_REGULARS, NULL));
+    elapsed += (s_bench_now() - start);
+
+    return(elapsed);
+}
+
+
+static uint64_t s_bench_receiver_process_snapshot(bench_context_t *ctx, uint32_t iterations, uint32_t *opsperiteration)
+{
+    EOnvSet *nvset = eo_hosttransceiver_GetNVset(ctx->host);
+    uint8_t r = 0;
+
+    // the same as receiver_Process_ChangeQueue but every endpoint of the regulars is also published as a snapshot
+    for(r=0; r<sizeof(s_bench_regulars)/sizeof(s_bench_regulars[0]); r++)
+    {
+        eo_nvset_Snapshot_Enable(nvset, s_bench_regulars[r].ep, BENCH_SNAPSHOT_BUFFERS);
+    }
+
+    return(s_bench_receiver_process_changequeue(ctx, iterations, opsperiteration));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
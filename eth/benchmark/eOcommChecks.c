@@ -0,0 +1,1911 @@
+/*
+ * Copyright (C) 2026 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  iCub Facility
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - description
+// --------------------------------------------------------------------------------------------------------------------
+
+// host checks of the behaviour of the comm-v2 transport stack and of the EOtheMemoryPool, w/ the same minimal host
+// system of eOcommBenchmark.
+// usage: eOcommChecks <check>
+// ctest runs every check in its own process, as some of them configure the EOtheMemoryPool in their own way.
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "EoCommon.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVtheSystem_hid.h"
+#include "EOVmutex_hid.h"
+
+#include "EoProtocol.h"
+#include "EoProtocolMC.h"
+#include "EoProtocolMN.h"
+
+#include "EOnvSet.h"
+#include "EOnvSet_hid.h"
+#include "EOnv.h"
+#include "EOpacket.h"
+#include "EOtransmitter.h"
+#include "EOreceiver.h"
+#include "EOtransceiver.h"
+#include "EOhostTransceiver.h"
+#include "EOtransceiver_hid.h"
+#include "EOconfirmationManager.h"
+#include "EOproxy.h"
+#include "EOrop_hid.h"
+#include "EOtheInfoDispatcher.h"
+#include "EoError.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define CHECK_IPADDR_HOST           EO_COMMON_IPV4ADDR(10, 0, 1, 104)
+#define CHECK_IPADDR_BOARD          EO_COMMON_IPV4ADDR(10, 0, 1, 1)
+#define CHECK_PORT                  12345
+
+// the number used by the host for the board of the device
+#define CHECK_REMOTEBOARD           1
+#define CHECK_MAX_REGULARS          64
+
+// it counts a failure of the running check and tells where it is
+#define CHECK(cond)                 do { if(!(cond)) { s_check_failed(__LINE__, #cond); } } while(0)
+
+// the boards used by the seqlock check for its own EOnvSet, one per mode of the writers
+#define CHECK_SEQLOCK_BOARD         5
+// the reader reads for so many ns, over many time slices of the writers
+#define CHECK_SEQLOCK_DURATION      (200ULL*1000*1000)
+// the update() of the netvar is slowed down so that the writers are often preempted inside their write section. they
+// yield every so many writes, else on a single core a reader w/out the mutex would hardly find the section closed
+#define CHECK_SEQLOCK_SPINS         16
+#define CHECK_SEQLOCK_BURST         1024
+
+// the change queue check uses its own EOnvSet. the capacity is rounded up to a power of two
+#define CHECK_CHANGEQUEUE_BOARD     7
+#define CHECK_CHANGEQUEUE_CAPACITY  50
+#define CHECK_CHANGEQUEUE_SIZE      64
+#define CHECK_CHANGEQUEUE_CHANGES   200000
+#define CHECK_CHANGEQUEUE_BATCH     16
+
+// the ropframes received by the host and the occasionals loaded in the device while their stats are read. the
+// receiver and the loader yield every so many of them, so that the other thread runs also on a single core
+#define CHECK_STATS_ROPFRAMES       20000
+#define CHECK_STATS_OCCASIONALS     20000
+#define CHECK_STATS_BURST           64
+
+// the confirmation manager of the host: the timeout is in usec
+#define CHECK_CONFMAN_INFLIGHT      4
+#define CHECK_CONFMAN_TIMEOUT       (20*1000)
+#define CHECK_CONFMAN_RETRANSMITS   2
+
+// the proxy of the device: the times are in usec. the asks arrive and the proxy ticks every CHECK_PROXY_INTERVAL
+#define CHECK_PROXY_CAPACITY        8
+#define CHECK_PROXY_TIMEOUT         (30*1000)
+#define CHECK_PROXY_INTERVAL        (5*1000)
+#define CHECK_PROXY_IDS             5
+#define CHECK_PROXY_SIGNATURES      4
+#define CHECK_PROXY_OPERATIONS      3000
+
+// the info dispatcher of the device. the infos put in each round go from 1 to the capacity of its fifo, so that the head
+// of the fifo wraps around from every position. the host records up to CHECK_INFODISPATCHER_INFOS infos
+#define CHECK_INFODISPATCHER_CAPACITY   5
+#define CHECK_INFODISPATCHER_GROUP      3
+#define CHECK_INFODISPATCHER_ROUNDS     12
+#define CHECK_INFODISPATCHER_INFOS      256
+#define CHECK_INFODISPATCHER_STREAM     512
+
+// the biggest size class of the pooled mode of the EOtheMemoryPool, the transceivers created and deleted in a row and the
+// blocks held by each of the threads which use the pooled mode concurrently
+#define CHECK_POOLED_BIGGEST        (8UL << (eo_mempool_pooled_classes_numberof - 1))
+#define CHECK_POOLED_CYCLES         5
+#define CHECK_POOLED_SLOTS          128
+#define CHECK_POOLED_OPERATIONS     100000
+#define CHECK_POOLED_BURST          256
+
+// an arena of a few blocks (every block takes a header of 8 bytes and it is rounded up to 8 bytes), the arenas of the
+// host transceivers, one big enough and one which overflows, and the blocks taken by each thread from its own arena
+#define CHECK_ARENA_SIZE            132
+#define CHECK_ARENA_CAPACITY        136
+#define CHECK_ARENA_HEADER          8
+#define CHECK_ARENA_BIG             (1UL << 20)
+#define CHECK_ARENA_SMALL           4096
+#define CHECK_ARENA_BLOCKS          1000
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+typedef void (*check_fn_t)(void);
+
+// a device (the board is local and it has regular rops) and a host (the same board seen as remote)
+typedef struct
+{
+    eOnvset_BRDcfg_t        brdcfg;
+    EOnvSet*                devnvset;
+    EOtransceiver*          device;
+    EOhostTransceiver*      host;
+    uint16_t                numofregulars;
+} check_context_t;
+
+typedef struct
+{
+    const char*             name;
+    check_fn_t              fn;
+    const eOmempool_cfg_t*  mempoolcfg;         // NULL for the dynamic mode of the minimal host system
+} check_item_t;
+
+// a recursive pthread mutex for the EOnvSet
+typedef struct
+{
+    EOVmutex*               mutex;              // the base object must be the first
+    pthread_mutex_t         m;
+} check_mutex_t;
+
+typedef struct
+{
+    EOnv*                   nv;
+    uint8_t                 value;              // the first of the values written by the writer
+    volatile uint32_t       writes;
+} check_seqlock_writer_t;
+
+typedef struct
+{
+    EOnvSet*                nvset;
+    uint32_t                cursor;             // the first change it must get
+    uint32_t                got;
+    uint32_t                lost;
+    uint32_t                unordered;          // the changes whose sequence is not the expected one
+} check_changequeue_consumer_t;
+
+typedef struct
+{
+    EOreceiver*             receiver;
+    uint16_t                numofregulars;      // the rops of every ropframe
+    uint32_t                reads;
+    uint32_t                inconsistent;       // the copies of the stats whose counters do not agree
+} check_stats_reader_t;
+
+typedef struct
+{
+    EOtransceiver*          device;
+    uint32_t                loaded;
+    uint32_t                notloaded;
+    volatile eObool_t       done;
+} check_stats_loader_t;
+
+typedef struct
+{
+    EOproxy*                proxy;
+    EOnvSet*                nvset;
+    EOrop*                  rop;
+    EOrop*                  ropout;
+} check_proxy_t;
+
+typedef struct
+{
+    eOprotID32_t            id32;
+    uint32_t                signature;
+    eOabstime_t             before;             // the ask arrives in between
+    eOabstime_t             after;
+} check_proxy_ask_t;
+
+typedef struct
+{
+    unsigned int            seed;
+    uint8_t                 number;
+    void*                   blocks[CHECK_POOLED_SLOTS];
+    uint32_t                sizes[CHECK_POOLED_SLOTS];
+    uint32_t                corrupted;          // the blocks whose content has changed while in use
+    uint32_t                dirty;              // the blocks not given zeroed
+} check_pooled_worker_t;
+
+typedef struct
+{
+    eOmempool_arena_t*      arena;
+    uint8_t                 number;
+    uint32_t                outside;            // the blocks not given by the arena of the thread
+    uint32_t                corrupted;
+} check_arena_worker_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_check_system_init(void);
+static void s_check_onerror(eOerrmanErrorType_t errtype, const char *info, eOerrmanCaller_t *caller, const eOerrmanDescriptor_t *des);
+static eOresult_t s_check_sys_start(void (*init_fn)(void));
+static void* s_check_sys_gettask(void);
+static eOabstime_t s_check_sys_abstime_get(void);
+static void s_check_sys_abstime_set(eOabstime_t time);
+static uint64_t s_check_sys_nanotime_get(void);
+
+static uint64_t s_check_now(void);
+static void s_check_failed(int line, const char *cond);
+
+static EOVmutexDerived* s_check_mutex_new(void);
+static eOresult_t s_check_mutex_take(void *p, eOreltime_t tout);
+static eOresult_t s_check_mutex_release(void *p);
+static eOresult_t s_check_mutex_delete(void *p);
+
+static void s_check_context_init(check_context_t *ctx, eOconfman_cfg_t *confmancfg);
+static void s_check_context_deinit(check_context_t *ctx);
+static uint16_t s_check_transfer(EOtransceiver *from, eOipv4addr_t fromipv4addr, EOtransceiver *to, eObool_t deliver);
+
+static void s_check_seqlock(void);
+static void s_check_seqlock_with(eOnvBRD_t board, eov_mutex_fn_mutexderived_new mtxnew);
+static void* s_check_seqlock_writer(void *arg);
+static void s_check_seqlock_update(const EOnv *nv, const eOropdescriptor_t *rd);
+
+static void s_check_changequeue(void);
+static void s_check_changequeue_produce(EOnvSet *nvset, uint32_t number);
+static void* s_check_changequeue_consumer(void *arg);
+
+static void s_check_stats(void);
+static void* s_check_stats_reader(void *arg);
+static void* s_check_stats_loader(void *arg);
+static uint32_t s_check_stats_rops(const eOreceiver_stats_t *stats);
+
+static void s_check_confirmation(void);
+static void s_check_confirmation_ontimeout(eOipv4addr_t toipaddr, eOropdescriptor_t *ropdes);
+static void s_check_confirmation_wait(eOreltime_t tout);
+
+static void s_check_proxy(void);
+static eOresult_t s_check_proxy_ask(check_proxy_t *proxy, eOprotID32_t id32, uint32_t signature);
+
+static void s_check_infodispatcher(void);
+static eObool_t s_check_infodispatcher_flush(EOtheInfoDispatcher *dispatcher, check_context_t *ctx, uint16_t number);
+static void s_check_infodispatcher_update(const EOnv *nv, const eOropdescriptor_t *rd);
+
+static void s_check_pooled(void);
+static void s_check_pooled_inuse(uint32_t *inuse, uint32_t *blocks);
+static void* s_check_pooled_worker(void *arg);
+static eObool_t s_check_pooled_content(const void *m, uint32_t size, uint8_t value);
+
+static void s_check_arena(void);
+static void s_check_arena_transceiver(check_context_t *ctx, uint32_t arenasize, eOmempool_arena_stats_t *stats);
+static void* s_check_arena_worker(void *arg);
+static void* s_check_heap_allocate(uint32_t size);
+static void* s_check_heap_reallocate(void *m, uint32_t size);
+static void s_check_heap_release(void *m);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const eOmempool_cfg_t s_check_pooled_mempoolcfg =
+{
+    EO_INIT(.mode)          eo_mempool_alloc_pooled,
+    EO_INIT(.conf)          NULL
+};
+
+static const eOmempool_alloc_config_t s_check_arena_allocconfig =
+{
+    EO_INIT(.pool)          { 0 },
+    EO_INIT(.heap)
+    {
+        EO_INIT(.allocate)      s_check_heap_allocate,
+        EO_INIT(.reallocate)    s_check_heap_reallocate,
+        EO_INIT(.release)       s_check_heap_release
+    }
+};
+
+static const eOmempool_cfg_t s_check_arena_mempoolcfg =
+{
+    EO_INIT(.mode)          eo_mempool_alloc_dynamic,
+    EO_INIT(.conf)          &s_check_arena_allocconfig
+};
+
+static const check_item_t s_check_items[] =
+{
+    { "seqlock",            s_check_seqlock,            NULL },
+    { "changequeue",        s_check_changequeue,        NULL },
+    { "stats",              s_check_stats,              NULL },
+    { "confirmation",       s_check_confirmation,       NULL },
+    { "proxy",              s_check_proxy,              NULL },
+    { "infodispatcher",     s_check_infodispatcher,     NULL },
+    { "pooled",             s_check_pooled,             &s_check_pooled_mempoolcfg },
+    { "arena",              s_check_arena,              &s_check_arena_mempoolcfg }
+};
+
+static const eOtransceiver_sizes_t s_check_device_sizes =
+{
+    EO_INIT(.capacityoftxpacket)            1440,
+    EO_INIT(.capacityofrop)                 256,
+    EO_INIT(.capacityofropframeregulars)    1024,
+    EO_INIT(.capacityofropframeoccasionals) 256,
+    EO_INIT(.capacityofropframereplies)     256,
+    EO_INIT(.maxnumberofregularrops)        CHECK_MAX_REGULARS
+};
+
+static struct timespec s_check_start_time;
+
+static uint32_t s_check_failures = 0;
+
+// a check sets it when it expects the objects to report errors
+static eObool_t s_check_quiet = eobool_false;
+
+static volatile eObool_t s_check_seqlock_stop = eobool_false;
+
+static volatile eObool_t s_check_changequeue_stop = eobool_false;
+
+static volatile eObool_t s_check_stats_stop = eobool_false;
+
+// the blocks of the heap in use, counted under their mutex
+static uint32_t s_check_heap_blocks = 0;
+static pthread_mutex_t s_check_heap_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint32_t s_check_confirmation_timeouts = 0;
+static uint32_t s_check_confirmation_signature = 0;
+
+// the infos received by the host, in their order
+static eOmn_info_properties_t s_check_infodispatcher_infos[CHECK_INFODISPATCHER_INFOS];
+static uint16_t s_check_infodispatcher_received = 0;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of main
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    uint8_t i = 0;
+
+    for(i=0; i<sizeof(s_check_items)/sizeof(s_check_items[0]); i++)
+    {
+        if((argc > 1) && (0 == strcmp(argv[1], s_check_items[i].name)))
+        {
+            break;
+        }
+    }
+
+    if(sizeof(s_check_items)/sizeof(s_check_items[0]) == i)
+    {
+        printf("usage: eOcommChecks <check>, where check is one of:");
+        for(i=0; i<sizeof(s_check_items)/sizeof(s_check_items[0]); i++)
+        {
+            printf(" %s", s_check_items[i].name);
+        }
+        printf("\n");
+        return(EXIT_FAILURE);
+    }
+
+    // the mode of the memory pool must be set before the system initialises it w/ its default
+    if(NULL != s_check_items[i].mempoolcfg)
+    {
+        eo_mempool_Initialise(s_check_items[i].mempoolcfg);
+    }
+
+    s_check_system_init();
+
+    s_check_items[i].fn();
+
+    printf("%s: %s\n", s_check_items[i].name, (0 == s_check_failures) ? ("ok") : ("FAILED"));
+
+    return((0 == s_check_failures) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_check_system_init(void)
+{
+    eOerrman_cfg_t errmancfg;
+
+    memcpy(&errmancfg, &eo_errman_DefaultCfg, sizeof(eOerrman_cfg_t));
+    errmancfg.extfn.usr_on_error = s_check_onerror;
+
+    clock_gettime(CLOCK_MONOTONIC, &s_check_start_time);
+
+    eov_sys_hid_Initialise(NULL, &errmancfg,
+                           s_check_sys_start, s_check_sys_gettask,
+                           s_check_sys_abstime_get, s_check_sys_abstime_set,
+                           s_check_sys_nanotime_get, NULL);
+}
+
+
+static void s_check_onerror(eOerrmanErrorType_t errtype, const char *info, eOerrmanCaller_t *caller, const eOerrmanDescriptor_t *des)
+{
+    if((errtype < eo_errortype_error) || ((eo_errortype_fatal != errtype) && (eobool_true == s_check_quiet)))
+    {
+        return;
+    }
+
+    printf("eOcommChecks: error %d from %s: %s\n", errtype, ((NULL != caller) && (NULL != caller->eobjstr)) ? (caller->eobjstr) : ("unknown"), (NULL != info) ? (info) : (""));
+
+    if(eo_errortype_fatal == errtype)
+    {
+        exit(EXIT_FAILURE);
+    }
+}
+
+
+static eOresult_t s_check_sys_start(void (*init_fn)(void))
+{
+    if(NULL != init_fn)
+    {
+        init_fn();
+    }
+    return(eores_OK);
+}
+
+
+static void* s_check_sys_gettask(void)
+{
+    return(NULL);
+}
+
+
+static eOabstime_t s_check_sys_abstime_get(void)
+{
+    return((s_check_now() - ((uint64_t)s_check_start_time.tv_sec * 1000000000ULL + s_check_start_time.tv_nsec)) / 1000);
+}
+
+
+static void s_check_sys_abstime_set(eOabstime_t time)
+{
+    // do nothing
+}
+
+
+static uint64_t s_check_sys_nanotime_get(void)
+{
+    return(s_check_now());
+}
+
+
+static uint64_t s_check_now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return((uint64_t)t.tv_sec * 1000000000ULL + t.tv_nsec);
+}
+
+
+static void s_check_failed(int line, const char *cond)
+{
+    s_check_failures ++;
+    printf("eOcommChecks: line %d: failed %s\n", line, cond);
+}
+
+
+static EOVmutexDerived* s_check_mutex_new(void)
+{
+    check_mutex_t *p = (check_mutex_t*) calloc(1, sizeof(check_mutex_t));
+    pthread_mutexattr_t attr;
+
+    p->mutex = eov_mutex_hid_New();
+    eov_mutex_hid_SetVTABLE(p->mutex, s_check_mutex_take, s_check_mutex_release, s_check_mutex_delete);
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&p->m, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    return(p);
+}
+
+
+static eOresult_t s_check_mutex_take(void *p, eOreltime_t tout)
+{
+    pthread_mutex_lock(&((check_mutex_t*)p)->m);
+    return(eores_OK);
+}
+
+
+static eOresult_t s_check_mutex_release(void *p)
+{
+    pthread_mutex_unlock(&((check_mutex_t*)p)->m);
+    return(eores_OK);
+}
+
+
+static eOresult_t s_check_mutex_delete(void *p)
+{
+    check_mutex_t *m = (check_mutex_t*)p;
+    pthread_mutex_destroy(&m->m);
+    eov_mutex_hid_Delete(m->mutex);
+    free(m);
+    return(eores_OK);
+}
+
+
+static void s_check_context_init(check_context_t *ctx, eOconfman_cfg_t *confmancfg)
+{
+    eOtransceiver_cfg_t devcfg = eo_transceiver_cfg_default;
+    eOhosttransceiver_cfg_t hostcfg = eo_hosttransceiver_cfg_default;
+    eOropdescriptor_t ropdesc;
+    uint8_t n = 0;
+    uint8_t index = 0;
+
+    memset(ctx, 0, sizeof(check_context_t));
+    memcpy(&ctx->brdcfg, &eonvset_BRDcfgStd, sizeof(eOnvset_BRDcfg_t));
+
+    ctx->devnvset = eo_nvset_New(eo_nvset_protection_none, NULL);
+    eo_nvset_InitBRD_LoadEPs(ctx->devnvset, eo_nvset_ownership_local, CHECK_IPADDR_BOARD, &ctx->brdcfg, eobool_true);
+
+    memcpy(&devcfg.sizes, &s_check_device_sizes, sizeof(eOtransceiver_sizes_t));
+    devcfg.remipv4addr  = CHECK_IPADDR_HOST;
+    devcfg.remipv4port  = CHECK_PORT;
+    devcfg.nvset        = ctx->devnvset;
+    // the device is protected, as its occasionals may be loaded by another thread
+    devcfg.mutex_fn_new = s_check_mutex_new;
+    devcfg.protection   = eo_trans_protection_enabled;
+    ctx->device = eo_transceiver_New(&devcfg);
+
+    // the regulars are the status of every joint and motor
+    memcpy(&ropdesc, &eok_ropdesc_basic, sizeof(eOropdescriptor_t));
+    ropdesc.ropcode = eo_ropcode_sig;
+    n = eoprot_entity_numberof_get(eoprot_board_localboard, eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint);
+    for(index=0; index<n; index++)
+    {
+        ropdesc.id32 = eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, index, eoprot_tag_mc_joint_status);
+        CHECK(eores_OK == eo_transceiver_RegularROP_Load(ctx->device, &ropdesc));
+        ropdesc.id32 = eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_motor, index, eoprot_tag_mc_motor_status);
+        CHECK(eores_OK == eo_transceiver_RegularROP_Load(ctx->device, &ropdesc));
+        ctx->numofregulars += 2;
+    }
+    CHECK(ctx->numofregulars > 0);
+
+    ctx->brdcfg.boardnum = CHECK_REMOTEBOARD;
+    hostcfg.nvsetbrdcfg                 = &ctx->brdcfg;
+    hostcfg.remoteboardipv4addr         = CHECK_IPADDR_BOARD;
+    hostcfg.remoteboardipv4port         = CHECK_PORT;
+    hostcfg.confmancfg                  = confmancfg;
+    ctx->host = eo_hosttransceiver_New(&hostcfg);
+}
+
+
+static void s_check_context_deinit(check_context_t *ctx)
+{
+    eo_hosttransceiver_Delete(ctx->host);
+    eo_transceiver_Delete(ctx->device);
+    eo_nvset_Delete(ctx->devnvset);
+}
+
+
+static uint16_t s_check_transfer(EOtransceiver *from, eOipv4addr_t fromipv4addr, EOtransceiver *to, eObool_t deliver)
+{
+    EOpacket *pkt = NULL;
+    uint16_t numberofrops = 0;
+    eOabstime_t txtime = 0;
+
+    // the packet formed by from reaches to only if the network delivers it
+    eo_transceiver_outpacket_Prepare(from, &numberofrops, NULL);
+    eo_transceiver_outpacket_Get(from, &pkt);
+    if(eobool_true == deliver)
+    {
+        eo_packet_Addressing_Set(pkt, fromipv4addr, CHECK_PORT);
+        eo_transceiver_Receive(to, pkt, &numberofrops, &txtime);
+    }
+
+    return(numberofrops);
+}
+
+
+static void s_check_seqlock(void)
+{
+    eOprot_callbacks_variable_descriptor_t cbkdes =
+    {
+        EO_INIT(.endpoint)  eoprot_endpoint_motioncontrol,
+        EO_INIT(.entity)    eoprot_entity_mc_joint,
+        EO_INIT(.tag)       eoprot_tag_mc_joint_status,
+        EO_INIT(.init)      NULL,
+        EO_INIT(.update)    s_check_seqlock_update
+    };
+
+    // the update() of the netvar is inside the write section and it makes the section long enough to be preempted
+    eoprot_config_callbacks_variable_set(&cbkdes);
+
+    // the writers are serialised by the mutex of the nvset, then by the compare-and-swap of the seqlock
+    s_check_seqlock_with(CHECK_SEQLOCK_BOARD, s_check_mutex_new);
+    s_check_seqlock_with(CHECK_SEQLOCK_BOARD + 1, NULL);
+}
+
+
+static void s_check_seqlock_with(eOnvBRD_t board, eov_mutex_fn_mutexderived_new mtxnew)
+{
+    eOprotID32_t id32 = eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 0, eoprot_tag_mc_joint_status);
+    eOnvset_BRDcfg_t brdcfg;
+    EOnvSet *nvset = NULL;
+    EOnv *reader = NULL;
+    check_seqlock_writer_t writers[2];
+    pthread_t threads[2];
+    uint8_t data[1024];
+    uint16_t size = 0;
+    uint16_t j = 0;
+    uint64_t start = 0;
+    uint32_t reads = 0;
+    uint32_t torn = 0;
+    uint8_t w = 0;
+
+    // two writers w/ values of their own and a reader which must never see the value of a writer before its update()
+    memcpy(&brdcfg, &eonvset_BRDcfgStd, sizeof(eOnvset_BRDcfg_t));
+    brdcfg.boardnum = board;
+    eoprot_config_board_reserve(board);
+
+    nvset = eo_nvset_New(eo_nvset_protection_seqlock, mtxnew);
+    eo_nvset_InitBRD_LoadEPs(nvset, eo_nvset_ownership_remote, CHECK_IPADDR_BOARD, &brdcfg, eobool_true);
+
+    reader = eo_nv_New();
+    CHECK(eores_OK == eo_nvset_NV_Get(nvset, id32, reader));
+    CHECK(eo_nv_Size(reader) <= sizeof(data));
+
+    s_check_seqlock_stop = eobool_false;
+    for(w=0; w<2; w++)
+    {
+        writers[w].nv = eo_nv_New();
+        writers[w].value = w;
+        writers[w].writes = 0;
+        eo_nvset_NV_Get(nvset, id32, writers[w].nv);
+        pthread_create(&threads[w], NULL, s_check_seqlock_writer, &writers[w]);
+    }
+
+    // the reader starts when both writers are running
+    while((0 == writers[0].writes) || (0 == writers[1].writes))
+    {
+        sched_yield();
+    }
+
+    for(start=s_check_now(); (s_check_now() - start) < CHECK_SEQLOCK_DURATION; reads++)
+    {
+        CHECK(eores_OK == eo_nv_Get(reader, eo_nv_strg_volatile, data, &size));
+        for(j=1; j<size; j++)
+        {
+            if(data[j] != data[0])
+            {
+                torn ++;
+                break;
+            }
+        }
+    }
+
+    s_check_seqlock_stop = eobool_true;
+    for(w=0; w<2; w++)
+    {
+        pthread_join(threads[w], NULL);
+        eo_nv_Delete(writers[w].nv);
+    }
+
+    CHECK(reads > 0);
+    CHECK(0 == torn);
+
+    eo_nv_Delete(reader);
+    eo_nvset_Delete(nvset);
+}
+
+
+static void* s_check_seqlock_writer(void *arg)
+{
+    check_seqlock_writer_t *writer = (check_seqlock_writer_t*)arg;
+    uint8_t data[1024];
+    uint8_t value = writer->value;
+
+    while(eobool_false == s_check_seqlock_stop)
+    {
+        // the two writers never use the same value. the update() makes all the bytes equal to the first
+        value += 2;
+        memset(data, ~value, sizeof(data));
+        data[0] = value;
+        eo_nv_Set(writer->nv, data, eobool_true, eo_nv_upd_always);
+        if(0 == (++writer->writes % CHECK_SEQLOCK_BURST))
+        {
+            sched_yield();
+        }
+    }
+
+    return(NULL);
+}
+
+
+static void s_check_seqlock_update(const EOnv *nv, const eOropdescriptor_t *rd)
+{
+    volatile uint8_t *ram = (volatile uint8_t*) eo_nv_RAM(nv);
+    uint16_t size = eo_nv_Size(nv);
+    uint16_t i = 0;
+    uint16_t spin = 0;
+
+    // as a slow higher layer which rewrites the value one byte at a time
+    for(i=1; i<size; i++)
+    {
+        for(spin=0; spin<CHECK_SEQLOCK_SPINS; spin++)
+        {
+            ram[i] = ram[0];
+        }
+    }
+}
+
+
+static void s_check_changequeue(void)
+{
+    eOnvset_BRDcfg_t brdcfg;
+    EOnvSet *nvset = NULL;
+    eOnvset_change_t changes[2*CHECK_CHANGEQUEUE_SIZE];
+    check_changequeue_consumer_t consumers[2];
+    pthread_t threads[2];
+    uint32_t cursor = 0;
+    uint32_t lost = 0;
+    uint16_t n = 0;
+    uint16_t i = 0;
+    uint8_t c = 0;
+
+    memcpy(&brdcfg, &eonvset_BRDcfgStd, sizeof(eOnvset_BRDcfg_t));
+    brdcfg.boardnum = CHECK_CHANGEQUEUE_BOARD;
+    eoprot_config_board_reserve(CHECK_CHANGEQUEUE_BOARD);
+
+    nvset = eo_nvset_New(eo_nvset_protection_none, NULL);
+    eo_nvset_InitBRD_LoadEPs(nvset, eo_nvset_ownership_remote, CHECK_IPADDR_BOARD, &brdcfg, eobool_true);
+
+    CHECK(eores_NOK_nullpointer == eo_nvset_ChangeQueue_Enable(NULL, CHECK_CHANGEQUEUE_CAPACITY));
+    CHECK(eores_NOK_generic == eo_nvset_ChangeQueue_Enable(nvset, 0));
+    CHECK(0 == eo_nvset_ChangeQueue_Get(nvset, &cursor, changes, CHECK_CHANGEQUEUE_SIZE, &lost));
+    CHECK(eores_OK == eo_nvset_ChangeQueue_Enable(nvset, CHECK_CHANGEQUEUE_CAPACITY));
+    CHECK(eores_NOK_generic == eo_nvset_ChangeQueue_Enable(nvset, CHECK_CHANGEQUEUE_CAPACITY));
+
+    // a consumer which keeps up gets all the changes in order
+    cursor = eo_nvset_ChangeQueue_Cursor_Get(nvset);
+    CHECK(0 == cursor);
+    s_check_changequeue_produce(nvset, 10);
+    CHECK(10 == eo_nvset_ChangeQueue_Pending(nvset, cursor));
+    n = eo_nvset_ChangeQueue_Get(nvset, &cursor, changes, CHECK_CHANGEQUEUE_SIZE, &lost);
+    CHECK((10 == n) && (0 == lost) && (10 == cursor));
+    for(i=0; i<n; i++)
+    {
+        CHECK(i == changes[i].sequence);
+        CHECK(i == eoprot_ID2tag(changes[i].id32));
+    }
+
+    // a slow consumer gets only the last capacity changes and it is told how many it has lost
+    s_check_changequeue_produce(nvset, CHECK_CHANGEQUEUE_SIZE + 36);
+    CHECK(CHECK_CHANGEQUEUE_SIZE == eo_nvset_ChangeQueue_Pending(nvset, cursor));
+    n = eo_nvset_ChangeQueue_Get(nvset, &cursor, changes, 2*CHECK_CHANGEQUEUE_SIZE, &lost);
+    CHECK((CHECK_CHANGEQUEUE_SIZE == n) && (36 == lost) && ((10 + CHECK_CHANGEQUEUE_SIZE + 36) == cursor));
+    CHECK((10 + 36) == changes[0].sequence);
+    CHECK((cursor - 1) == changes[n-1].sequence);
+    CHECK(0 == eo_nvset_ChangeQueue_Pending(nvset, cursor));
+
+    // two consumers concurrent w/ the producer: each change is got once in order or it is counted as lost
+    s_check_changequeue_stop = eobool_false;
+    for(c=0; c<2; c++)
+    {
+        memset(&consumers[c], 0, sizeof(check_changequeue_consumer_t));
+        consumers[c].nvset = nvset;
+        consumers[c].cursor = eo_nvset_ChangeQueue_Cursor_Get(nvset);
+        pthread_create(&threads[c], NULL, s_check_changequeue_consumer, &consumers[c]);
+    }
+
+    s_check_changequeue_produce(nvset, CHECK_CHANGEQUEUE_CHANGES);
+
+    s_check_changequeue_stop = eobool_true;
+    for(c=0; c<2; c++)
+    {
+        pthread_join(threads[c], NULL);
+        CHECK(0 == consumers[c].unordered);
+        CHECK(CHECK_CHANGEQUEUE_CHANGES == (consumers[c].got + consumers[c].lost));
+    }
+
+    eo_nvset_Delete(nvset);
+}
+
+
+static void s_check_changequeue_produce(EOnvSet *nvset, uint32_t number)
+{
+    uint32_t i = 0;
+
+    // as the receiver does for the say<> and sig<> of its ropframes. the tag of the changed netvar tells which one it is
+    for(i=0; i<number; i++)
+    {
+        if(0 == (i % CHECK_CHANGEQUEUE_BATCH))
+        {
+            eo_nvset_hid_Ropframe_Begin(nvset);
+        }
+        eo_nvset_hid_NV_Changed(nvset, eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 0, i % CHECK_CHANGEQUEUE_SIZE));
+        if((CHECK_CHANGEQUEUE_BATCH - 1) == (i % CHECK_CHANGEQUEUE_BATCH))
+        {   // and then it waits for the next packet, so that the consumers run also on a single core
+            eo_nvset_hid_Ropframe_End(nvset);
+            sched_yield();
+        }
+    }
+    eo_nvset_hid_Ropframe_End(nvset);
+}
+
+
+static void* s_check_changequeue_consumer(void *arg)
+{
+    check_changequeue_consumer_t *consumer = (check_changequeue_consumer_t*)arg;
+    eOnvset_change_t changes[CHECK_CHANGEQUEUE_BATCH];
+    uint32_t expected = consumer->cursor;
+    uint32_t lost = 0;
+    uint16_t n = 0;
+    uint16_t i = 0;
+
+    while((eobool_false == s_check_changequeue_stop) || (0 != eo_nvset_ChangeQueue_Pending(consumer->nvset, consumer->cursor)))
+    {
+        n = eo_nvset_ChangeQueue_Get(consumer->nvset, &consumer->cursor, changes, CHECK_CHANGEQUEUE_BATCH, &lost);
+        consumer->lost += lost;
+        expected += lost;
+        for(i=0; i<n; i++)
+        {
+            if(expected != changes[i].sequence)
+            {
+                consumer->unordered ++;
+            }
+            expected ++;
+        }
+        consumer->got += n;
+        if(0 == n)
+        {
+            sched_yield();
+        }
+    }
+
+    return(NULL);
+}
+
+
+static void s_check_stats(void)
+{
+    check_context_t ctx;
+    check_stats_reader_t reader;
+    check_stats_loader_t loader;
+    pthread_t thread;
+    EOtransceiver *host = NULL;
+    EOreceiver *receiver = NULL;
+    EOtransmitter *transmitter = NULL;
+    eOreceiver_stats_t rxstats;
+    eOtransmitter_stats_t txstats;
+    EOpacket *pkt = NULL;
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint16_t numberofrops = 0;
+    eOabstime_t txtime = 0;
+    uint32_t ropframes = 0;
+    uint32_t sum = 0;
+    uint8_t b = 0;
+
+    s_check_context_init(&ctx, NULL);
+    host = eo_hosttransceiver_GetTransceiver(ctx.host);
+    receiver = eo_transceiver_GetReceiver(host);
+    transmitter = eo_transceiver_GetTransmitter(ctx.device);
+
+    // a reader concurrent w/ the receiver gets either a consistent copy of the stats or eores_NOK_busy
+    CHECK(eores_OK == eo_receiver_Stats_Timing_Enable(receiver, eobool_true));
+    memset(&reader, 0, sizeof(check_stats_reader_t));
+    reader.receiver = receiver;
+    reader.numofregulars = ctx.numofregulars;
+    s_check_stats_stop = eobool_false;
+    pthread_create(&thread, NULL, s_check_stats_reader, &reader);
+
+    for(ropframes=0; ropframes<CHECK_STATS_ROPFRAMES; ropframes++)
+    {
+        s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, host, eobool_true);
+        if(0 == (ropframes % CHECK_STATS_BURST))
+        {
+            sched_yield();
+        }
+    }
+
+    s_check_stats_stop = eobool_true;
+    pthread_join(thread, NULL);
+    CHECK(reader.reads > 0);
+    CHECK(0 == reader.inconsistent);
+
+    CHECK(eores_OK == eo_receiver_Stats_Get(receiver, &rxstats));
+    CHECK(CHECK_STATS_ROPFRAMES == rxstats.ropframes);
+    CHECK(0 == rxstats.ropframesrejected);
+    CHECK((CHECK_STATS_ROPFRAMES * ctx.numofregulars) == s_check_stats_rops(&rxstats));
+    CHECK((CHECK_STATS_ROPFRAMES * ctx.numofregulars) == rxstats.rops[eoprot_endpoint_motioncontrol][eo_ropcode_sig].rops);
+
+    // the reset restarts every counter from zero
+    CHECK(eores_OK == eo_receiver_Stats_Reset(receiver));
+    CHECK(eores_OK == eo_receiver_Stats_Get(receiver, &rxstats));
+    CHECK((0 == rxstats.ropframes) && (0 == rxstats.bytes) && (0 == s_check_stats_rops(&rxstats)));
+
+    // a corrupted ropframe is counted only amongst the rejected ones
+    eo_transceiver_outpacket_Prepare(ctx.device, &numberofrops, NULL);
+    eo_transceiver_outpacket_Get(ctx.device, &pkt);
+    eo_packet_Addressing_Set(pkt, CHECK_IPADDR_BOARD, CHECK_PORT);
+    eo_packet_Payload_Get(pkt, &data, &size);
+    data[0] ^= 0xff;
+    eo_transceiver_Receive(host, pkt, &numberofrops, &txtime);
+    CHECK(eores_OK == eo_receiver_Stats_Get(receiver, &rxstats));
+    CHECK((0 == rxstats.ropframes) && (1 == rxstats.ropframesrejected) && (0 == s_check_stats_rops(&rxstats)));
+
+    // the occasionals loaded by another thread are either transmitted or counted as not loaded
+    CHECK(eores_OK == eo_transmitter_Stats_Timing_Enable(transmitter, eobool_true));
+    CHECK(eores_OK == eo_transmitter_Stats_Reset(transmitter));
+    memset(&loader, 0, sizeof(check_stats_loader_t));
+    loader.device = ctx.device;
+    loader.done = eobool_false;
+    pthread_create(&thread, NULL, s_check_stats_loader, &loader);
+
+    ropframes = 0;
+    while(eobool_false == loader.done)
+    {
+        s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, host, eobool_false);
+        ropframes ++;
+        sched_yield();
+    }
+    pthread_join(thread, NULL);
+    s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, host, eobool_false);
+    ropframes ++;
+
+    CHECK(eores_OK == eo_transmitter_Stats_Get(transmitter, &txstats));
+    CHECK(ropframes == txstats.ropframes);
+    CHECK((ropframes * ctx.numofregulars) == txstats.regulars);
+    CHECK(loader.loaded == txstats.occasionals);
+    CHECK(loader.notloaded == txstats.ropsnotloaded);
+    CHECK(loader.notloaded > 0);
+    CHECK(0 == txstats.ropframestoobig);
+    for(sum=0, b=0; b<eo_transportstats_timebins_numberof; b++)
+    {
+        sum += txstats.timeofpreparation[b];
+    }
+    CHECK(ropframes == sum);
+
+    s_check_context_deinit(&ctx);
+}
+
+
+static void* s_check_stats_reader(void *arg)
+{
+    check_stats_reader_t *reader = (check_stats_reader_t*)arg;
+    eOreceiver_stats_t stats;
+    uint32_t last = 0;
+    uint32_t rops = 0;
+    uint32_t sum = 0;
+    uint8_t e = 0;
+    uint8_t r = 0;
+    uint8_t b = 0;
+
+    while(eobool_false == s_check_stats_stop)
+    {
+        if(eores_OK != eo_receiver_Stats_Get(reader->receiver, &stats))
+        {
+            continue;
+        }
+        reader->reads ++;
+
+        // every ropframe has the same rops. they are counted one by one and the ropframe after them
+        rops = s_check_stats_rops(&stats);
+        if((stats.ropframes < last) || (rops < (stats.ropframes * reader->numofregulars)) || (rops > ((stats.ropframes + 1) * reader->numofregulars)))
+        {
+            reader->inconsistent ++;
+        }
+        last = stats.ropframes;
+        for(sum=0, b=0; b<eo_transportstats_timebins_numberof; b++)
+        {
+            sum += stats.timeofropframes[b];
+        }
+        if(sum != stats.ropframes)
+        {
+            reader->inconsistent ++;
+        }
+        for(e=0; e<eoprot_endpoints_numberof; e++)
+        {
+            for(r=0; r<eo_receiver_stats_ropcodes; r++)
+            {
+                for(sum=0, b=0; b<eo_transportstats_timebins_numberof; b++)
+                {
+                    sum += stats.rops[e][r].timeofprocessing[b];
+                }
+                if(sum != stats.rops[e][r].rops)
+                {
+                    reader->inconsistent ++;
+                }
+            }
+        }
+    }
+
+    return(NULL);
+}
+
+
+static void* s_check_stats_loader(void *arg)
+{
+    check_stats_loader_t *loader = (check_stats_loader_t*)arg;
+    eOropdescriptor_t ropdesc;
+    uint32_t i = 0;
+
+    memcpy(&ropdesc, &eok_ropdesc_basic, sizeof(eOropdescriptor_t));
+    ropdesc.ropcode = eo_ropcode_sig;
+    ropdesc.id32 = eoprot_ID_get(eoprot_endpoint_management, eoprot_entity_mn_appl, 0, eoprot_tag_mn_appl_status);
+
+    // a burst fills the ropframe of the occasionals well before the device transmits it
+    for(i=0; i<CHECK_STATS_OCCASIONALS; i++)
+    {
+        if(eores_OK == eo_transceiver_OccasionalROP_Load(loader->device, &ropdesc))
+        {
+            loader->loaded ++;
+        }
+        else
+        {
+            loader->notloaded ++;
+        }
+        if(0 == (i % CHECK_STATS_BURST))
+        {
+            sched_yield();
+        }
+    }
+
+    loader->done = eobool_true;
+    return(NULL);
+}
+
+
+static uint32_t s_check_stats_rops(const eOreceiver_stats_t *stats)
+{
+    uint32_t rops = stats->ropsofotherendpoints;
+    uint8_t e = 0;
+    uint8_t r = 0;
+
+    for(e=0; e<eoprot_endpoints_numberof; e++)
+    {
+        for(r=0; r<eo_receiver_stats_ropcodes; r++)
+        {
+            rops += stats->rops[e][r].rops;
+        }
+    }
+
+    return(rops);
+}
+
+
+static void s_check_confirmation(void)
+{
+    check_context_t ctx;
+    eOconfman_cfg_t confmancfg = eOconfman_cfg_default;
+    eOprotID32_t idconfig = eoprot_ID_get(eoprot_endpoint_management, eoprot_entity_mn_appl, 0, eoprot_tag_mn_appl_config);
+    eOprotID32_t idstatus = eoprot_ID_get(eoprot_endpoint_management, eoprot_entity_mn_appl, 0, eoprot_tag_mn_appl_status);
+    EOtransceiver *host = NULL;
+    EOconfirmationManager *confman = NULL;
+    eOmn_appl_config_t *devconfig = NULL;
+    eOmn_appl_config_t config;
+    eOropdescriptor_t ropdesc;
+    eOconfman_status_t status = eoconfman_status_none;
+    uint8_t data[64];
+    uint8_t i = 0;
+
+    confmancfg.mode                 = eoconfman_mode_enabled;
+    confmancfg.maxnumberofinflight  = CHECK_CONFMAN_INFLIGHT;
+    confmancfg.timeout              = CHECK_CONFMAN_TIMEOUT;
+    confmancfg.maxretransmissions   = CHECK_CONFMAN_RETRANSMITS;
+    confmancfg.maxsizeofropdata     = sizeof(data);
+    confmancfg.on_rop_conf_timeout  = s_check_confirmation_ontimeout;
+    confmancfg.wait_fn              = s_check_confirmation_wait;
+
+    s_check_context_init(&ctx, &confmancfg);
+    host = eo_hosttransceiver_GetTransceiver(ctx.host);
+    confman = host->confmanager;
+    devconfig = (eOmn_appl_config_t*) eoprot_variable_ramof_get(eoprot_board_localboard, idconfig);
+    if((NULL == confman) || (NULL == devconfig))
+    {
+        CHECK((NULL != confman) && (NULL != devconfig));
+        return;
+    }
+
+    memset(&config, 0, sizeof(config));
+    memcpy(&ropdesc, &eok_ropdesc_basic, sizeof(eOropdescriptor_t));
+    ropdesc.ropcode = eo_ropcode_set;
+    ropdesc.control.rqstconf = 1;
+    ropdesc.control.plussign = 1;
+
+    // the set<> of a writable netvar is acked, the one of a read-only netvar is nacked
+    config.cycletime = 1234;
+    ropdesc.id32 = idconfig;
+    ropdesc.signature = 1;
+    ropdesc.size = sizeof(config);
+    ropdesc.data = (uint8_t*)&config;
+    CHECK(eores_OK == eo_transceiver_OccasionalROP_Load(host, &ropdesc));
+    memset(data, 0, sizeof(data));
+    ropdesc.id32 = idstatus;
+    ropdesc.signature = 2;
+    ropdesc.size = eoprot_variable_sizeof_get(eoprot_board_localboard, idstatus);
+    ropdesc.data = data;
+    CHECK(eores_OK == eo_transceiver_OccasionalROP_Load(host, &ropdesc));
+    CHECK(2 == eo_confman_Pending_Numberof(confman));
+
+    s_check_transfer(host, CHECK_IPADDR_HOST, ctx.device, eobool_true);
+    s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, host, eobool_true);
+    CHECK(0 == eo_confman_Pending_Numberof(confman));
+    CHECK((eores_OK == eo_confman_Status_Get(confman, CHECK_IPADDR_BOARD, idconfig, 1, &status)) && (eoconfman_status_acked == status));
+    CHECK((eores_OK == eo_confman_Status_Get(confman, CHECK_IPADDR_BOARD, idstatus, 2, &status)) && (eoconfman_status_nacked == status));
+    // the result is retrieved only once
+    CHECK((eores_NOK_generic == eo_confman_Status_Get(confman, CHECK_IPADDR_BOARD, idconfig, 1, &status)) && (eoconfman_status_none == status));
+
+    // a lost set<> is retransmitted after the timeout w/ the data it had when loaded, even if the caller reuses its buffer
+    config.cycletime = 4321;
+    ropdesc.id32 = idconfig;
+    ropdesc.signature = 3;
+    ropdesc.size = sizeof(config);
+    ropdesc.data = (uint8_t*)&config;
+    CHECK(eores_OK == eo_transceiver_OccasionalROP_Load(host, &ropdesc));
+    config.cycletime = 1;
+    s_check_transfer(host, CHECK_IPADDR_HOST, ctx.device, eobool_false);
+    CHECK((eores_OK == eo_confman_Status_Get(confman, CHECK_IPADDR_BOARD, idconfig, 3, &status)) && (eoconfman_status_pending == status));
+    usleep(CHECK_CONFMAN_TIMEOUT + CHECK_CONFMAN_TIMEOUT/2);
+    s_check_transfer(host, CHECK_IPADDR_HOST, ctx.device, eobool_true);
+    CHECK(4321 == devconfig->cycletime);
+    s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, host, eobool_true);
+    CHECK((eores_OK == eo_confman_Status_Get(confman, CHECK_IPADDR_BOARD, idconfig, 3, &status)) && (eoconfman_status_acked == status));
+    CHECK(0 == s_check_confirmation_timeouts);
+
+    // a set<> which never arrives is retransmitted maxretransmissions times, then it times out once
+    ropdesc.signature = 4;
+    CHECK(eores_OK == eo_transceiver_OccasionalROP_Load(host, &ropdesc));
+    for(i=0; i<=CHECK_CONFMAN_RETRANSMITS+1; i++)
+    {
+        s_check_transfer(host, CHECK_IPADDR_HOST, ctx.device, eobool_false);
+        CHECK((i > CHECK_CONFMAN_RETRANSMITS) || (0 == s_check_confirmation_timeouts));
+        usleep(CHECK_CONFMAN_TIMEOUT + CHECK_CONFMAN_TIMEOUT/4);
+    }
+    s_check_transfer(host, CHECK_IPADDR_HOST, ctx.device, eobool_false);
+    CHECK((1 == s_check_confirmation_timeouts) && (4 == s_check_confirmation_signature));
+    CHECK(0 == eo_confman_Pending_Numberof(confman));
+    CHECK((eores_OK == eo_confman_Status_Get(confman, CHECK_IPADDR_BOARD, idconfig, 4, &status)) && (eoconfman_status_timedout == status));
+
+    // the wait gives up after its timeout while the rop is pending and it returns the ack once it has arrived
+    ropdesc.signature = 5;
+    CHECK(eores_OK == eo_transceiver_OccasionalROP_Load(host, &ropdesc));
+    CHECK((eores_NOK_timeout == eo_confman_Status_Wait(confman, CHECK_IPADDR_BOARD, idconfig, 5, CHECK_CONFMAN_TIMEOUT/4, &status)) && (eoconfman_status_pending == status));
+    s_check_transfer(host, CHECK_IPADDR_HOST, ctx.device, eobool_true);
+    s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, host, eobool_true);
+    CHECK((eores_OK == eo_confman_Status_Wait(confman, CHECK_IPADDR_BOARD, idconfig, 5, CHECK_CONFMAN_TIMEOUT, &status)) && (eoconfman_status_acked == status));
+    CHECK((eores_NOK_generic == eo_confman_Status_Wait(confman, CHECK_IPADDR_BOARD, idconfig, 5, CHECK_CONFMAN_TIMEOUT, &status)) && (eoconfman_status_none == status));
+
+    // a confirmed rop is not loaded if the confirmation manager cannot track it
+    for(i=0; i<=CHECK_CONFMAN_INFLIGHT; i++)
+    {
+        ropdesc.signature = 10 + i;
+        CHECK((i < CHECK_CONFMAN_INFLIGHT) == (eores_OK == eo_transceiver_OccasionalROP_Load(host, &ropdesc)));
+    }
+    CHECK(CHECK_CONFMAN_INFLIGHT == eo_confman_Pending_Numberof(confman));
+    CHECK(CHECK_CONFMAN_INFLIGHT == s_check_transfer(host, CHECK_IPADDR_HOST, ctx.device, eobool_true));
+    s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, host, eobool_true);
+    CHECK(0 == eo_confman_Pending_Numberof(confman));
+
+    s_check_context_deinit(&ctx);
+}
+
+
+static void s_check_confirmation_ontimeout(eOipv4addr_t toipaddr, eOropdescriptor_t *ropdes)
+{
+    s_check_confirmation_timeouts ++;
+    s_check_confirmation_signature = ropdes->signature;
+}
+
+
+static void s_check_confirmation_wait(eOreltime_t tout)
+{
+    usleep(tout);
+}
+
+
+static void s_check_proxy(void)
+{
+    check_context_t ctx;
+    check_proxy_t proxy;
+    eOproxy_cfg_t proxycfg = eo_proxy_cfg_default;
+    eOproxy_stats_t stats;
+    eOproxy_params_t *params = NULL;
+    eOprotID32_t ids[CHECK_PROXY_IDS];
+    check_proxy_ask_t asks[CHECK_PROXY_CAPACITY];
+    uint16_t model[CHECK_PROXY_IDS][CHECK_PROXY_SIGNATURES];
+    uint16_t inmodel = 0;
+    uint16_t numberofreplies = 0;
+    eOabstime_t before = 0;
+    eOabstime_t after = 0;
+    eObool_t waiting = eobool_false;
+    eObool_t waited = eobool_false;
+    eOresult_t res = eores_NOK_generic;
+    uint32_t timeouts = 0;
+    uint32_t i = 0;
+    uint8_t expired = 0;
+    uint8_t a = 0;
+    uint8_t id = 0;
+    uint8_t sign = 0;
+
+    s_check_context_init(&ctx, NULL);
+
+    // the proxy reports the asks it rejects and the replies it does not find
+    s_check_quiet = eobool_true;
+
+    for(id=0; id<CHECK_PROXY_IDS-1; id++)
+    {
+        ids[id] = eoprot_ID_get(eoprot_endpoint_management, eoprot_entity_mn_appl, 0, id);
+    }
+    ids[CHECK_PROXY_IDS-1] = eoprot_ID_get(eoprot_endpoint_management, eoprot_entity_mn_comm, 0, 0);
+
+    proxycfg.mode                   = eoproxy_mode_enabled;
+    proxycfg.capacityoflistofropdes = CHECK_PROXY_CAPACITY;
+    proxycfg.replyroptimeout        = CHECK_PROXY_TIMEOUT;
+    proxycfg.mutex_fn_new           = s_check_mutex_new;
+    proxycfg.transceiver            = ctx.device;
+    proxy.proxy = eo_proxy_New(&proxycfg);
+    proxy.nvset = ctx.devnvset;
+    proxy.rop = eo_rop_New(s_check_device_sizes.capacityofrop);
+    proxy.ropout = eo_rop_New(s_check_device_sizes.capacityofrop);
+
+    // many asks of the same id32 wait together: the oldest is the default one, the others are selected by signature
+    CHECK(eores_OK == s_check_proxy_ask(&proxy, ids[0], 1));
+    CHECK(eores_OK == s_check_proxy_ask(&proxy, ids[0], 2));
+    CHECK(eores_OK == s_check_proxy_ask(&proxy, ids[1], 3));
+    params = eo_proxy_Params_GetWithSignature(proxy.proxy, ids[0], 2);
+    CHECK(NULL != params);
+    params->p08_1 = 22;
+    params = eo_proxy_Params_Get(proxy.proxy, ids[0]);
+    CHECK((NULL != params) && (0 == params->p08_1));
+    params->p08_1 = 11;
+    CHECK(eores_OK == eo_proxy_ReplyROP_LoadWithSignature(proxy.proxy, ids[0], 2, NULL));
+    params = eo_proxy_Params_Get(proxy.proxy, ids[0]);
+    CHECK((NULL != params) && (11 == params->p08_1));
+    CHECK(eores_OK == eo_proxy_ReplyROP_Load(proxy.proxy, ids[0], NULL));
+    CHECK(eores_OK != eo_proxy_ReplyROP_Load(proxy.proxy, ids[0], NULL));
+    CHECK(eores_OK == eo_proxy_ReplyROP_Load(proxy.proxy, ids[1], NULL));
+    eo_transceiver_NumberofOutROPs(ctx.device, &numberofreplies, NULL, NULL);
+    CHECK(3 == numberofreplies);
+    s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, eo_hosttransceiver_GetTransceiver(ctx.host), eobool_false);
+    CHECK(eores_OK == eo_proxy_Stats_Get(proxy.proxy, &stats));
+    CHECK((3 == stats.asks) && (3 == stats.replies) && (1 == stats.notfound) && (0 == stats.rejected));
+
+    // the asks expire in their order of arrival, whatever their id32, and the ones over capacity are rejected
+    for(a=0; a<CHECK_PROXY_CAPACITY; a++)
+    {
+        asks[a].id32 = ids[(CHECK_PROXY_IDS - 1) - (a % CHECK_PROXY_IDS)];
+        asks[a].signature = 100 + a;
+        asks[a].before = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+        CHECK(eores_OK == s_check_proxy_ask(&proxy, asks[a].id32, asks[a].signature));
+        asks[a].after = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+        usleep(CHECK_PROXY_INTERVAL);
+    }
+    CHECK(eores_OK != s_check_proxy_ask(&proxy, ids[0], 99));
+
+    for(expired=0, i=0; (expired < CHECK_PROXY_CAPACITY) && (i < 100); i++)
+    {
+        before = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+        CHECK(eores_OK == eo_proxy_Tick(proxy.proxy));
+        after = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+        for(expired=0, waited=eobool_false, a=0; a<CHECK_PROXY_CAPACITY; a++)
+        {
+            waiting = (NULL != eo_proxy_Params_GetWithSignature(proxy.proxy, asks[a].id32, asks[a].signature)) ? (eobool_true) : (eobool_false);
+            expired += (eobool_true == waiting) ? (0) : (1);
+            // an ask never expires before an older one, and the tick removes it only if its timeout has surely passed
+            CHECK((eobool_false == waited) || (eobool_true == waiting));
+            CHECK((eobool_false == waiting) || ((asks[a].after + CHECK_PROXY_TIMEOUT) >= before));
+            CHECK((eobool_true == waiting) || ((asks[a].before + CHECK_PROXY_TIMEOUT) < after));
+            waited = waiting;
+        }
+        CHECK(eores_OK == eo_proxy_Stats_Get(proxy.proxy, &stats));
+        CHECK((1 == stats.rejected) && (expired == stats.timeouts));
+        usleep(CHECK_PROXY_INTERVAL);
+    }
+    CHECK(CHECK_PROXY_CAPACITY == expired);
+    CHECK(eores_OK != eo_proxy_ReplyROP_Load(proxy.proxy, asks[0].id32, NULL));
+
+    // the table stays coherent w/ a model of the waiting asks along random asks and replies
+    memset(model, 0, sizeof(model));
+    srand(3);
+    for(i=0; i<CHECK_PROXY_OPERATIONS; i++)
+    {
+        id = rand() % CHECK_PROXY_IDS;
+        sign = rand() % CHECK_PROXY_SIGNATURES;
+        if(0 == (rand() % 2))
+        {
+            res = s_check_proxy_ask(&proxy, ids[id], sign);
+            CHECK((inmodel < CHECK_PROXY_CAPACITY) == (eores_OK == res));
+            if(eores_OK == res)
+            {
+                model[id][sign] ++;
+                inmodel ++;
+            }
+        }
+        else
+        {
+            res = eo_proxy_ReplyROP_LoadWithSignature(proxy.proxy, ids[id], sign, NULL);
+            CHECK((model[id][sign] > 0) == (eores_OK == res));
+            if(eores_OK == res)
+            {
+                model[id][sign] --;
+                inmodel --;
+            }
+        }
+        s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, eo_hosttransceiver_GetTransceiver(ctx.host), eobool_false);
+    }
+
+    CHECK(eores_OK == eo_proxy_Stats_Get(proxy.proxy, &stats));
+    timeouts = stats.timeouts;
+    usleep(CHECK_PROXY_TIMEOUT + CHECK_PROXY_INTERVAL);
+    CHECK(eores_OK == eo_proxy_Tick(proxy.proxy));
+    CHECK(eores_OK == eo_proxy_Stats_Get(proxy.proxy, &stats));
+    CHECK((stats.timeouts - timeouts) == inmodel);
+
+    eo_rop_Delete(proxy.ropout);
+    eo_rop_Delete(proxy.rop);
+    eo_proxy_Delete(proxy.proxy);
+    s_check_context_deinit(&ctx);
+}
+
+
+static eOresult_t s_check_proxy_ask(check_proxy_t *proxy, eOprotID32_t id32, uint32_t signature)
+{
+    EOrop *rop = proxy->rop;
+
+    // as the agent does w/ an ask<> of a proxied netvar
+    eo_rop_Reset(rop);
+    eo_nvset_NV_Get(proxy->nvset, id32, &rop->netvar);
+    rop->netvar.proxied = eobool_true;
+    rop->ropdes.ropcode = eo_ropcode_ask;
+    rop->ropdes.id32 = id32;
+    rop->ropdes.signature = signature;
+    rop->ropdes.control.plussign = 1;
+    rop->stream.head.ropc = eo_ropcode_ask;
+    rop->stream.head.id32 = id32;
+
+    return(eo_proxy_ROP_Forward(proxy->proxy, rop, proxy->ropout));
+}
+
+
+static void s_check_infodispatcher(void)
+{
+    eOprot_callbacks_variable_descriptor_t cbkdes =
+    {
+        EO_INIT(.endpoint)  eoprot_endpoint_management,
+        EO_INIT(.entity)    eoprot_entity_mn_info,
+        EO_INIT(.tag)       eoprot_tag_mn_info_status_basic,
+        EO_INIT(.init)      NULL,
+        EO_INIT(.update)    s_check_infodispatcher_update
+    };
+    check_context_t ctx;
+    eOinfodispatcher_cfg_t cfg = eo_infodispatcher_cfg_default;
+    EOtheInfoDispatcher *dispatcher = NULL;
+    EOtransmitter *transmitter = NULL;
+    eOmn_info_properties_t props;
+    uint8_t stream[CHECK_INFODISPATCHER_STREAM];
+    uint32_t overflowcode = eoerror_code_get(eoerror_category_System, eoerror_value_SYS_dispatcherfifooverflow);
+    uint16_t ropsize = 0;
+    uint16_t available = 0;
+    uint16_t sent = 0;
+    uint16_t remaining = 0;
+    uint16_t loaded = 0;
+    uint16_t put = 0;
+    uint16_t expected = 0;
+    uint16_t overflows = 0;
+    uint16_t unordered = 0;
+    uint16_t n = 0;
+    uint16_t i = 0;
+    uint8_t round = 0;
+
+    // the host records the sig<> of the infos w/out extra, which are the ones put by the check and the overflow
+    eoprot_config_callbacks_variable_set(&cbkdes);
+
+    s_check_context_init(&ctx, NULL);
+    transmitter = eo_transceiver_GetTransmitter(ctx.device);
+    ropsize = eo_rop_compute_size(eok_ropctrl_basic, eo_ropcode_sig, sizeof(eOmn_info_basic_t));
+
+    cfg.capacity        = CHECK_INFODISPATCHER_CAPACITY;
+    cfg.transmitter     = transmitter;
+    cfg.maxinfosperload = CHECK_INFODISPATCHER_GROUP;
+    dispatcher = eo_infodispatcher_Initialise(&cfg);
+    CHECK(NULL != dispatcher);
+
+    memset(&props, 0, sizeof(props));
+    props.code = eoerror_code_dummy;
+    EOMN_INFO_PROPERTIES_FLAGS_set_type(props.flags, eomn_info_type_info);
+    EOMN_INFO_PROPERTIES_FLAGS_set_source(props.flags, eomn_info_source_board);
+
+    // the infos of a round go in groups into the occasionals, which lose exactly their bytes, and the host gets them all
+    for(round=0; round<CHECK_INFODISPATCHER_ROUNDS; round++)
+    {
+        n = 1 + (round % CHECK_INFODISPATCHER_CAPACITY);
+        for(i=0; i<n; i++)
+        {
+            props.par16 = put++;
+            CHECK(eores_OK == eo_infodispatcher_Put(dispatcher, &props, NULL));
+        }
+        available = eo_transmitter_occasional_rops_Available(transmitter);
+        CHECK(eores_OK == eo_infodispatcher_Send(dispatcher, eoinfodispatcher_sendnumber_all, &sent, &remaining));
+        CHECK((n == sent) && (0 == remaining));
+        CHECK((available - n*ropsize) == eo_transmitter_occasional_rops_Available(transmitter));
+        s_check_transfer(ctx.device, CHECK_IPADDR_BOARD, eo_hosttransceiver_GetTransceiver(ctx.host), eobool_true);
+        CHECK(put == s_check_infodispatcher_received);
+    }
+
+    // a group of rops which does not fit in the occasionals is refused as a whole
+    available = eo_transmitter_occasional_rops_Available(transmitter);
+    n = available / ropsize + 1;
+    CHECK((n*ropsize) <= sizeof(stream));
+    memset(stream, 0, sizeof(stream));
+    CHECK(eores_OK != eo_transmitter_occasional_rops_LoadStreamOfROPs(transmitter, stream, n*ropsize, n, NULL));
+    CHECK(available == eo_transmitter_occasional_rops_Available(transmitter));
+
+    // the dispatcher fills the occasionals and keeps in the fifo the infos which dont fit in them
+    for(loaded=0, remaining=0; 0 == remaining; loaded+=sent)
+    {
+        for(i=0; i<CHECK_INFODISPATCHER_CAPACITY; i++)
+        {
+            props.par16 = put++;
+            CHECK(eores_OK == eo_infodispatcher_Put(dispatcher, &props, NULL));
+        }
+        CHECK(eores_OK == eo_infodispatcher_Send(dispatcher, eoinfodispatcher_sendnumber_all, &sent, &remaining));
+    }
+    CHECK(loaded == (available / ropsize));
+    CHECK(eo_transmitter_occasional_rops_Available(transmitter) < ropsize);
+    CHECK(eobool_true == s_check_infodispatcher_flush(dispatcher, &ctx, put));
+
+    // the info which does not fit in a full fifo is counted by the overflow, which is sent before the others
+    for(i=0; i<CHECK_INFODISPATCHER_CAPACITY; i++)
+    {
+        props.par16 = put++;
+        CHECK(eores_OK == eo_infodispatcher_Put(dispatcher, &props, NULL));
+    }
+    props.par16 = put;
+    CHECK(eores_OK != eo_infodispatcher_Put(dispatcher, &props, NULL));
+    CHECK(eobool_true == s_check_infodispatcher_flush(dispatcher, &ctx, put + 1));
+
+    // the infos put by the check have consecutive par16 and only the overflow is in between
+    for(i=0; i<s_check_infodispatcher_received; i++)
+    {
+        if(overflowcode == s_check_infodispatcher_infos[i].code)
+        {
+            overflows ++;
+            CHECK(1 == s_check_infodispatcher_infos[i].par16);
+            CHECK((put - CHECK_INFODISPATCHER_CAPACITY) == expected);
+        }
+        else if(expected++ != s_check_infodispatcher_infos[i].par16)
+        {
+            unordered ++;
+        }
+    }
+    CHECK((1 == overflows) && (put == expected) && (0 == unordered));
+
+    eo_infodispatcher_DeInitialise(dispatcher);
+    s_check_context_deinit(&ctx);
+}
+
+
+// it transfers the occasionals of the device to the host and it loads into them what the dispatcher keeps, until the
+// host has received number infos. every transfer empties the occasionals, thus a few of them are enough
+static eObool_t s_check_infodispatcher_flush(EOtheInfoDispatcher *dispatcher, check_context_t *ctx, uint16_t number)
+{
+    uint8_t i = 0;
+
+    for(i=0; (i < (CHECK_INFODISPATCHER_CAPACITY + 2)) && (number != s_check_infodispatcher_received); i++)
+    {
+        s_check_transfer(ctx->device, CHECK_IPADDR_BOARD, eo_hosttransceiver_GetTransceiver(ctx->host), eobool_true);
+        CHECK(eores_OK == eo_infodispatcher_Send(dispatcher, eoinfodispatcher_sendnumber_all, NULL, NULL));
+    }
+
+    return((number == s_check_infodispatcher_received) ? (eobool_true) : (eobool_false));
+}
+
+
+static void s_check_infodispatcher_update(const EOnv *nv, const eOropdescriptor_t *rd)
+{
+    const eOmn_info_basic_t *info = (const eOmn_info_basic_t*) eo_nv_RAM(nv);
+
+    // only the host receives the sig<>: the dispatcher of the device changes the netvar w/out update()
+    if((NULL == rd) || (eo_ropcode_sig != rd->ropcode) || (s_check_infodispatcher_received >= CHECK_INFODISPATCHER_INFOS))
+    {
+        return;
+    }
+
+    memcpy(&s_check_infodispatcher_infos[s_check_infodispatcher_received], &info->properties, sizeof(eOmn_info_properties_t));
+    s_check_infodispatcher_received ++;
+}
+
+
+static void s_check_pooled(void)
+{
+    EOtheMemoryPool *mempool = eo_mempool_GetHandle();
+    check_context_t ctx;
+    check_pooled_worker_t workers[2];
+    pthread_t threads[2];
+    uint32_t inuse[eo_mempool_pooled_classes_numberof];
+    uint32_t blocks[eo_mempool_pooled_classes_numberof];
+    uint32_t inuseafter[eo_mempool_pooled_classes_numberof];
+    uint32_t blocksafter[eo_mempool_pooled_classes_numberof];
+    uint32_t allocated = 0;
+    uint32_t size = 0;
+    uint8_t *m = NULL;
+    uint8_t *n = NULL;
+    uint8_t k = 0;
+    uint8_t c = 0;
+    uint16_t i = 0;
+
+    CHECK(eo_mempool_alloc_pooled == eo_mempool_alloc_mode_Get(mempool));
+    CHECK(eobool_true == eo_mempool_CanDelete(mempool));
+
+    // a released block is the next one given for its size class, zeroed, and the carved blocks do not grow
+    allocated = eo_mempool_SizeOfAllocated(mempool);
+    for(k=0; k<eo_mempool_pooled_classes_numberof; k++)
+    {
+        size = 8UL << k;
+        m = (uint8_t*) eo_mempool_New(mempool, size);
+        CHECK(0 == ((uintptr_t)m & 7));
+        CHECK((allocated + size) == eo_mempool_SizeOfAllocated(mempool));
+        memset(m, 0xa5, size);
+        s_check_pooled_inuse(inuse, blocks);
+        eo_mempool_Delete(mempool, m);
+        CHECK(allocated == eo_mempool_SizeOfAllocated(mempool));
+
+        n = (uint8_t*) eo_mempool_GetMemory(mempool, eo_mempool_align_08bit, (uint16_t)(size/2 + 1), 1);
+        CHECK(n == m);
+        CHECK(eobool_true == s_check_pooled_content(n, size/2 + 1, 0));
+        s_check_pooled_inuse(inuseafter, blocksafter);
+        CHECK((inuse[k] == inuseafter[k]) && (blocks[k] == blocksafter[k]));
+        eo_mempool_Delete(mempool, n);
+    }
+
+    // what is bigger than the biggest class comes from the heap and it is counted until it is released
+    m = (uint8_t*) eo_mempool_New(mempool, 3*CHECK_POOLED_BIGGEST);
+    CHECK((allocated + 3*CHECK_POOLED_BIGGEST) == eo_mempool_SizeOfAllocated(mempool));
+    memset(m, 0x5a, 3*CHECK_POOLED_BIGGEST);
+    m = (uint8_t*) eo_mempool_Realloc(mempool, m, 100);
+    CHECK(eobool_true == s_check_pooled_content(m, 100, 0x5a));
+    CHECK((allocated + 100) == eo_mempool_SizeOfAllocated(mempool));
+    m = (uint8_t*) eo_mempool_Realloc(mempool, m, 2*CHECK_POOLED_BIGGEST);
+    CHECK(eobool_true == s_check_pooled_content(m, 100, 0x5a));
+    CHECK(eobool_true == s_check_pooled_content(m + 100, 2*CHECK_POOLED_BIGGEST - 100, 0));
+    eo_mempool_Delete(mempool, m);
+    CHECK(allocated == eo_mempool_SizeOfAllocated(mempool));
+
+    // the transceivers created and deleted in a row reuse the same blocks
+    for(c=0; c<CHECK_POOLED_CYCLES; c++)
+    {
+        s_check_context_init(&ctx, NULL);
+        s_check_context_deinit(&ctx);
+        s_check_pooled_inuse(inuseafter, blocksafter);
+        if(0 == c)
+        {
+            memcpy(inuse, inuseafter, sizeof(inuse));
+            memcpy(blocks, blocksafter, sizeof(blocks));
+            allocated = eo_mempool_SizeOfAllocated(mempool);
+        }
+        CHECK(0 == memcmp(inuse, inuseafter, sizeof(inuse)));
+        CHECK(0 == memcmp(blocks, blocksafter, sizeof(blocks)));
+        CHECK(allocated == eo_mempool_SizeOfAllocated(mempool));
+    }
+
+    // two threads w/ blocks of every size: no block is given twice and the stats go back where they were. the
+    // mutex itself takes memory from the pool
+    CHECK(eores_OK == eo_mempool_SetMutex(mempool, s_check_mutex_new(), eok_reltimeINFINITE));
+    s_check_pooled_inuse(inuse, blocks);
+    allocated = eo_mempool_SizeOfAllocated(mempool);
+    for(c=0; c<2; c++)
+    {
+        memset(&workers[c], 0, sizeof(check_pooled_worker_t));
+        workers[c].seed = 1 + c;
+        workers[c].number = c;
+        pthread_create(&threads[c], NULL, s_check_pooled_worker, &workers[c]);
+    }
+    for(c=0; c<2; c++)
+    {
+        pthread_join(threads[c], NULL);
+        CHECK(0 == workers[c].corrupted);
+        CHECK(0 == workers[c].dirty);
+        for(i=0; i<CHECK_POOLED_SLOTS; i++)
+        {
+            eo_mempool_Delete(mempool, workers[c].blocks[i]);
+        }
+    }
+    s_check_pooled_inuse(inuseafter, blocksafter);
+    CHECK(0 == memcmp(inuse, inuseafter, sizeof(inuse)));
+    CHECK(allocated == eo_mempool_SizeOfAllocated(mempool));
+}
+
+
+static void s_check_pooled_inuse(uint32_t *inuse, uint32_t *blocks)
+{
+    eOmempool_pooled_stats_t stats;
+    uint8_t k = 0;
+
+    for(k=0; k<eo_mempool_pooled_classes_numberof; k++)
+    {
+        CHECK(eores_OK == eo_mempool_pooled_Stats_Get(eo_mempool_GetHandle(), k, &stats));
+        inuse[k] = stats.inuse;
+        blocks[k] = stats.blocks;
+    }
+}
+
+
+static void* s_check_pooled_worker(void *arg)
+{
+    check_pooled_worker_t *worker = (check_pooled_worker_t*)arg;
+    EOtheMemoryPool *mempool = eo_mempool_GetHandle();
+    uint32_t size = 0;
+    uint32_t i = 0;
+    uint16_t slot = 0;
+
+    // every block of a slot is filled w/ the number of the slot and of the worker
+    for(i=0; i<CHECK_POOLED_OPERATIONS; i++)
+    {
+        slot = rand_r(&worker->seed) % CHECK_POOLED_SLOTS;
+        if(NULL != worker->blocks[slot])
+        {
+            worker->corrupted += (eobool_true == s_check_pooled_content(worker->blocks[slot], worker->sizes[slot], (uint8_t)(slot + 128*worker->number))) ? (0) : (1);
+            if(0 == (rand_r(&worker->seed) % 4))
+            {   // it keeps the content
+                size = 1 + rand_r(&worker->seed) % (2*CHECK_POOLED_BIGGEST);
+                worker->blocks[slot] = eo_mempool_Realloc(mempool, worker->blocks[slot], size);
+                worker->corrupted += (eobool_true == s_check_pooled_content(worker->blocks[slot], (size < worker->sizes[slot]) ? (size) : (worker->sizes[slot]), (uint8_t)(slot + 128*worker->number))) ? (0) : (1);
+                worker->sizes[slot] = size;
+                memset(worker->blocks[slot], (uint8_t)(slot + 128*worker->number), size);
+            }
+            else
+            {
+                eo_mempool_Delete(mempool, worker->blocks[slot]);
+                worker->blocks[slot] = NULL;
+            }
+        }
+        else
+        {   // mostly small blocks, sometimes bigger than the biggest class
+            size = 1 + rand_r(&worker->seed) % ((0 == (rand_r(&worker->seed) % 10)) ? (2*CHECK_POOLED_BIGGEST) : (200));
+            worker->blocks[slot] = (0 == (i % 2)) ? (eo_mempool_New(mempool, size)) : (eo_mempool_GetMemory(mempool, eo_mempool_align_64bit, (uint16_t)size, 1));
+            worker->dirty += (eobool_true == s_check_pooled_content(worker->blocks[slot], size, 0)) ? (0) : (1);
+            worker->sizes[slot] = size;
+            memset(worker->blocks[slot], (uint8_t)(slot + 128*worker->number), size);
+        }
+        if(0 == (i % CHECK_POOLED_BURST))
+        {
+            sched_yield();
+        }
+    }
+
+    return(NULL);
+}
+
+
+static eObool_t s_check_pooled_content(const void *m, uint32_t size, uint8_t value)
+{
+    const uint8_t *data = (const uint8_t*)m;
+    uint32_t i = 0;
+
+    for(i=0; i<size; i++)
+    {
+        if(value != data[i])
+        {
+            return(eobool_false);
+        }
+    }
+
+    return(eobool_true);
+}
+
+
+static void s_check_arena(void)
+{
+    EOtheMemoryPool *mempool = eo_mempool_GetHandle();
+    check_context_t ctx;
+    check_arena_worker_t workers[2];
+    pthread_t threads[2];
+    eOmempool_arena_t *arena = NULL;
+    eOmempool_arena_t *previous = NULL;
+    eOmempool_arena_stats_t stats;
+    uint32_t heapblocks = 0;
+    uint8_t *heap = NULL;
+    uint8_t *x = NULL;
+    uint8_t *y = NULL;
+    uint8_t *z = NULL;
+    uint8_t *w = NULL;
+    uint8_t c = 0;
+
+    // the heap tells what the EOtheMemoryPool takes from it and gives back
+    heapblocks = s_check_heap_blocks;
+    CHECK(NULL == eo_mempool_arena_New(mempool, 0));
+    arena = eo_mempool_arena_New(mempool, CHECK_ARENA_SIZE);
+    CHECK((eores_OK == eo_mempool_arena_Stats_Get(mempool, arena, &stats)) && (CHECK_ARENA_CAPACITY == stats.capacity));
+    CHECK((heapblocks + 1) == s_check_heap_blocks);
+
+    // a block of the heap taken before entering the arena stays of the heap
+    heap = (uint8_t*) eo_mempool_New(mempool, 40);
+    memset(heap, 0xcc, 40);
+    CHECK((heapblocks + 2) == s_check_heap_blocks);
+
+    previous = eo_mempool_arena_Enter(mempool, arena);
+    CHECK(NULL == previous);
+    x = (uint8_t*) eo_mempool_GetMemory(mempool, eo_mempool_align_08bit, 3, 1);
+    CHECK(0 == ((uintptr_t)x & 7));
+    memset(x, 0xaa, 3);
+    y = (uint8_t*) eo_mempool_New(mempool, 10);
+    memset(y, 0xbb, 10);
+    CHECK(eores_OK == eo_mempool_arena_Stats_Get(mempool, arena, &stats));
+    CHECK(((CHECK_ARENA_HEADER + 8) + (CHECK_ARENA_HEADER + 16)) == stats.used);
+    CHECK(2 == stats.blocks);
+    CHECK((heapblocks + 2) == s_check_heap_blocks);
+
+    // the last block grows and shrinks in place. what it gains is zeroed
+    CHECK(y == eo_mempool_Realloc(mempool, y, 20));
+    CHECK(eobool_true == s_check_pooled_content(y, 10, 0xbb));
+    CHECK(eobool_true == s_check_pooled_content(y + 10, 10, 0));
+    CHECK(y == eo_mempool_Realloc(mempool, y, 4));
+    eo_mempool_arena_Stats_Get(mempool, arena, &stats);
+    CHECK(((CHECK_ARENA_HEADER + 8) + (CHECK_ARENA_HEADER + 8)) == stats.used);
+
+    // any other block is copied into a new one, while the old one stays where it is
+    z = (uint8_t*) eo_mempool_Realloc(mempool, x, 40);
+    CHECK((z != x) && (eobool_true == s_check_pooled_content(x, 3, 0xaa)));
+    CHECK(eobool_true == s_check_pooled_content(z, 3, 0xaa));
+    CHECK(eobool_true == s_check_pooled_content(z + 3, 37, 0));
+    eo_mempool_arena_Stats_Get(mempool, arena, &stats);
+    CHECK((3 == stats.blocks) && (((CHECK_ARENA_HEADER + 8) + (CHECK_ARENA_HEADER + 8) + (CHECK_ARENA_HEADER + 40)) == stats.used));
+
+    // the blocks of the arena are released only w/ the arena, the ones of the heap as usual also inside the arena
+    eo_mempool_Delete(mempool, x);
+    eo_mempool_Delete(mempool, z);
+    eo_mempool_arena_Stats_Get(mempool, arena, &stats);
+    CHECK((3 == stats.blocks) && (0 == stats.overflows));
+    CHECK((heapblocks + 2) == s_check_heap_blocks);
+    heap = (uint8_t*) eo_mempool_Realloc(mempool, heap, 400);
+    CHECK(eobool_true == s_check_pooled_content(heap, 40, 0xcc));
+    eo_mempool_arena_Stats_Get(mempool, arena, &stats);
+    CHECK((3 == stats.blocks) && (0 == stats.overflows));
+    CHECK((heapblocks + 2) == s_check_heap_blocks);
+    eo_mempool_Delete(mempool, heap);
+    CHECK((heapblocks + 1) == s_check_heap_blocks);
+
+    // what does not fit the arena comes from the heap
+    w = (uint8_t*) eo_mempool_New(mempool, 64);
+    eo_mempool_arena_Stats_Get(mempool, arena, &stats);
+    CHECK((1 == stats.overflows) && (64 == stats.overflowbytes) && (3 == stats.blocks));
+    CHECK((heapblocks + 2) == s_check_heap_blocks);
+    eo_mempool_Delete(mempool, w);
+    CHECK((heapblocks + 1) == s_check_heap_blocks);
+    eo_mempool_arena_Leave(mempool, previous);
+
+    // outside the arena its blocks are still recognised: released w/ the arena, copied into the heap if reallocated
+    eo_mempool_Delete(mempool, y);
+    CHECK((heapblocks + 1) == s_check_heap_blocks);
+    w = (uint8_t*) eo_mempool_Realloc(mempool, x, 2);
+    CHECK((NULL != w) && (w != x) && (0xaa == w[0]) && (0xaa == w[1]));
+    CHECK((heapblocks + 2) == s_check_heap_blocks);
+    eo_mempool_Delete(mempool, w);
+    eo_mempool_arena_Delete(mempool, arena);
+    CHECK(heapblocks == s_check_heap_blocks);
+
+    // each thread takes its blocks from its own arena
+    for(c=0; c<2; c++)
+    {
+        memset(&workers[c], 0, sizeof(check_arena_worker_t));
+        workers[c].arena = eo_mempool_arena_New(mempool, CHECK_ARENA_BLOCKS * (CHECK_ARENA_HEADER + 8));
+        workers[c].number = c;
+        pthread_create(&threads[c], NULL, s_check_arena_worker, &workers[c]);
+    }
+    for(c=0; c<2; c++)
+    {
+        pthread_join(threads[c], NULL);
+        CHECK((0 == workers[c].outside) && (0 == workers[c].corrupted));
+        eo_mempool_arena_Stats_Get(mempool, workers[c].arena, &stats);
+        CHECK((CHECK_ARENA_BLOCKS == stats.blocks) && (stats.capacity == stats.used) && (0 == stats.overflows));
+        eo_mempool_arena_Delete(mempool, workers[c].arena);
+    }
+    CHECK(heapblocks == s_check_heap_blocks);
+
+    // a host transceiver in an arena works as one outside and, deleted w/ it, it leaves nothing behind in the heap
+    s_check_context_init(&ctx, NULL);
+    heapblocks = s_check_heap_blocks;
+    s_check_arena_transceiver(&ctx, CHECK_ARENA_BIG, &stats);
+    CHECK((0 == stats.overflows) && (stats.used > 0));
+    CHECK(heapblocks == s_check_heap_blocks);
+    s_check_arena_transceiver(&ctx, CHECK_ARENA_SMALL, &stats);
+    CHECK(stats.overflows > 0);
+    CHECK(heapblocks == s_check_heap_blocks);
+    s_check_context_deinit(&ctx);
+}
+
+
+static void s_check_arena_transceiver(check_context_t *ctx, uint32_t arenasize, eOmempool_arena_stats_t *stats)
+{
+    eOhosttransceiver_cfg_t hostcfg = eo_hosttransceiver_cfg_default;
+    EOhostTransceiver *host = NULL;
+
+    hostcfg.nvsetbrdcfg         = &ctx->brdcfg;
+    hostcfg.remoteboardipv4addr = CHECK_IPADDR_BOARD;
+    hostcfg.remoteboardipv4port = CHECK_PORT;
+    hostcfg.arenasize           = arenasize;
+    host = eo_hosttransceiver_New(&hostcfg);
+
+    CHECK(eores_OK == eo_mempool_arena_Stats_Get(eo_mempool_GetHandle(), eo_hosttransceiver_GetArena(host), stats));
+    CHECK(ctx->numofregulars == s_check_transfer(ctx->device, CHECK_IPADDR_BOARD, eo_hosttransceiver_GetTransceiver(host), eobool_true));
+
+    eo_hosttransceiver_Delete(host);
+}
+
+
+static void* s_check_arena_worker(void *arg)
+{
+    check_arena_worker_t *worker = (check_arena_worker_t*)arg;
+    EOtheMemoryPool *mempool = eo_mempool_GetHandle();
+    eOmempool_arena_t *previous = NULL;
+    uint8_t *blocks[CHECK_ARENA_BLOCKS];
+    eOmempool_arena_stats_t stats;
+    uint16_t i = 0;
+
+    previous = eo_mempool_arena_Enter(mempool, worker->arena);
+    for(i=0; i<CHECK_ARENA_BLOCKS; i++)
+    {
+        blocks[i] = (uint8_t*) eo_mempool_New(mempool, 8);
+        eo_mempool_arena_Stats_Get(mempool, worker->arena, &stats);
+        worker->outside += ((i + 1) == stats.blocks) ? (0) : (1);
+        memset(blocks[i], worker->number + 1, 8);
+        if(0 == (i % 64))
+        {
+            sched_yield();
+        }
+    }
+    eo_mempool_arena_Leave(mempool, previous);
+
+    for(i=0; i<CHECK_ARENA_BLOCKS; i++)
+    {
+        worker->corrupted += (eobool_true == s_check_pooled_content(blocks[i], 8, worker->number + 1)) ? (0) : (1);
+    }
+
+    return(NULL);
+}
+
+
+static void* s_check_heap_allocate(uint32_t size)
+{
+    pthread_mutex_lock(&s_check_heap_mutex);
+    s_check_heap_blocks ++;
+    pthread_mutex_unlock(&s_check_heap_mutex);
+    return(calloc(size, 1));
+}
+
+
+static void* s_check_heap_reallocate(void *m, uint32_t size)
+{
+    if(NULL == m)
+    {
+        return(s_check_heap_allocate(size));
+    }
+    return(realloc(m, size));
+}
+
+
+static void s_check_heap_release(void *m)
+{
+    if(NULL == m)
+    {
+        return;
+    }
+    pthread_mutex_lock(&s_check_heap_mutex);
+    s_check_heap_blocks --;
+    pthread_mutex_unlock(&s_check_heap_mutex);
+    free(m);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
@@ -162,7 +162,7 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     
     if(eo_listcapacity_dynamic == retptr->capacity)
     {
-        eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_list_New(): eo_vectorcapacity_dynamic only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+        eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_CanDelete(eo_mempool_GetHandle())), "eo_list_New(): eo_vectorcapacity_dynamic only if eo_mempool_CanDelete()", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
         retptr->freeiters = NULL;        
     }
     else
@@ -403,6 +403,12 @@ extern EOlistIter* eo_list_Begin(EOlist *list)
 {
     return((NULL == list) ? (NULL) :(s_eo_list_front(list)));         
 }
+
+
+extern EOlistIter* eo_list_Last(EOlist *list) 
+{
+    return((NULL == list) ? (NULL) :(s_eo_list_back(list)));         
+}
  
 
 extern EOlistIter* eo_list_Next(EOlist *list, EOlistIter *li) 
@@ -741,7 +747,7 @@ extern void eo_list_Delete(EOlist *list)
         return;    
     }   
     
-    eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_list_Delete(): only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_CanDelete(eo_mempool_GetHandle())), "eo_list_Delete(): only if eo_mempool_CanDelete()", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
   
     // destroy every item. in case of eo_listcapacity_dynamic, each internal listiter is properly deleted and freeiters is NULL
     eo_list_Clear(list);
@@ -233,6 +233,14 @@ extern void eo_list_Clear(EOlist *list);
 extern EOlistIter* eo_list_Begin(EOlist *list);
 
 
+/** @fn         extern EOlistIter* eo_list_Last(EOlist *list)
+    @brief      Returns a list iterator pointing to the last item of the list.
+    @param      list            Pointer to the EOlist object.
+    @return     The list iterator (or NULL if the list is empty).
+ **/
+extern EOlistIter* eo_list_Last(EOlist *list);
+
+
 /** @fn         extern EOlistIter* eo_list_Next(EOlist *list, EOlistIter *li)
     @brief      Increments the iterator to next position in the list. 
     @param      list            Pointer to the EOlist object.
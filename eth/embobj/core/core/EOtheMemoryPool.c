@@ -45,7 +45,48 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the bytes carved at once for a size class of eo_mempool_alloc_pooled mode, unless a single block is bigger 
+#define EOMEMPOOL_POOLED_CHUNK      (4096)
+
+// the current arena is per thread on the hosts (also on windows w/ mingw). elsewhere, e.g. on the boards w/ armcc, it is 
+// a plain variable shared by all the threads: there only one thread at a time can use arenas (see eo_mempool_arena_Enter()).
+#if     defined(_MSC_VER)
+    #define EOMEMPOOL_THREADLOCAL                   __declspec(thread)
+#elif   (defined(__linux__) || defined(__APPLE__) || defined(_WIN32)) && (defined(__GNUC__) || defined(__clang__))
+    #define EOMEMPOOL_THREADLOCAL                   __thread
+#else
+    #define EOMEMPOOL_THREADLOCAL                   
+#endif
+
+// the ranges of the arenas change only under the mutex. eo_mempool_Delete() reads them w/out it as in a seqlock (see 
+// EOnv.c) where we have the memory fences, else and after EOMEMPOOL_ARENAS_ATTEMPTS torn reads it takes the mutex.
+#if     defined(__ATOMIC_ACQUIRE)
+    #define EOMEMPOOL_ARENAS_LOCKFREE
+    #define EOMEMPOOL_ACQUIRE()                     __atomic_thread_fence(__ATOMIC_ACQUIRE)
+    #define EOMEMPOOL_RELEASE()                     __atomic_thread_fence(__ATOMIC_RELEASE)
+#elif   defined(__GNUC__) || defined(__clang__)
+    #define EOMEMPOOL_ARENAS_LOCKFREE
+    #define EOMEMPOOL_ACQUIRE()                     __sync_synchronize()
+    #define EOMEMPOOL_RELEASE()                     __sync_synchronize()
+#elif   defined(_MSC_VER)
+    #include <intrin.h>
+    #define EOMEMPOOL_ARENAS_LOCKFREE
+    #define EOMEMPOOL_ACQUIRE()                     _ReadWriteBarrier()
+    #define EOMEMPOOL_RELEASE()                     _ReadWriteBarrier()
+#elif   defined(__ARMCC_VERSION) && (defined(__TARGET_ARCH_7_M) || defined(__TARGET_ARCH_7E_M))
+    #define EOMEMPOOL_ARENAS_LOCKFREE
+    #define EOMEMPOOL_ACQUIRE()                     __dmb(0xF)
+    #define EOMEMPOOL_RELEASE()                     __dmb(0xF)
+#else
+    #define EOMEMPOOL_ACQUIRE()                     
+    #define EOMEMPOOL_RELEASE()                     
+#endif
+
+#define EOMEMPOOL_ARENAS_ATTEMPTS   (4)
+
+#define EOMEMPOOL_ALIGN8(s)         (((s) + 7UL) & ~7UL)
+
 
  // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
@@ -71,6 +112,23 @@ const eOmempool_cfg_t eom_mempool_DefaultCfg =
 
 static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, uint32_t* usedbytes);
 
+static void * s_eo_mempool_get_pooled(uint32_t size);
+
+static void s_eo_mempool_release_pooled(void *m);
+
+static eObool_t s_eo_mempool_pooled_refill(uint8_t sizeclass);
+
+static void * s_eo_mempool_arena_get(eOmempool_arena_t *arena, uint32_t size);
+
+static eOmempool_arena_t * s_eo_mempool_arena_of(void *m);
+
+static eOmempool_arena_t * s_eo_mempool_arena_search(const uint8_t *m);
+
+static uint32_t s_eo_mempool_arena_position(const uint8_t *begin);
+
+static void * s_eo_mempool_arena_realloc(eOmempool_arena_t *arena, void *m, uint32_t size);
+
+
 static void * s_memallocator(uint32_t s);
 
 static void s_memfree(void *p);
@@ -130,9 +188,20 @@ static EOtheMemoryPool s_the_mempool =
     {
         EO_INIT(.usedbytesheap)     0,
         EO_INIT(.usedbytespool)     0
-    }
+    },
+    EO_INIT(.pooled)
+    {
+        EO_INIT(.freelist)          {NULL},
+        EO_INIT(.stats)             {{0}}
+    },
+    EO_INIT(.arenasseq)     0,
+    EO_INIT(.arenas)        0,
+    EO_INIT(.arenaranges)   {{NULL}}
 };
 
+static EOMEMPOOL_THREADLOCAL eOmempool_arena_t * s_eo_mempool_arena_current = NULL;
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern public functions
@@ -223,6 +292,33 @@ extern EOtheMemoryPool * eo_mempool_Initialise(const eOmempool_cfg_t *cfg)
                        
         } break;
         
+        case eo_mempool_alloc_pooled:
+        {
+            uint8_t i = 0;
+            
+            if(NULL != cfg->conf)
+            {   // the size classes take their blocks from the 64-bit pool if it is defined, else from the heap
+                memcpy(&s_the_mempool.thepool.config, &cfg->conf->pool, sizeof(eOmempool_pool_config_t));
+                if((0 != s_the_mempool.thepool.config.size64) && (NULL != s_the_mempool.thepool.config.data64))
+                {
+                    s_the_mempool.thepool.status.poolsmask |= 8;
+                    s_the_mempool.thepool.status.uint64index = 0;
+                }
+                
+                s_the_mempool.theheap.allocate      =   cfg->conf->heap.allocate;
+                s_the_mempool.theheap.reallocate    =   cfg->conf->heap.reallocate;
+                s_the_mempool.theheap.release       =   cfg->conf->heap.release;
+            }
+            
+            for(i=0; i<eo_mempool_pooled_classes_numberof; i++)
+            {
+                s_the_mempool.pooled.freelist[i] = NULL;
+                memset(&s_the_mempool.pooled.stats[i], 0, sizeof(eOmempool_pooled_stats_t));
+                s_the_mempool.pooled.stats[i].sizeofblock = 8UL << i;
+            }
+            
+        } break;
+        
         default:
         {
             
@@ -290,6 +386,15 @@ extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t ali
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_GetMemory() is asked 0 bytes", s_eobj_ownname, &errdes);        
         return(NULL);
     }
+    
+    if(NULL != s_eo_mempool_arena_current)
+    {   // the thread is inside an arena: no mutex and no pools. only if the arena is full we go on as usual
+        ret = s_eo_mempool_arena_get(s_eo_mempool_arena_current, (uint32_t)number*size);
+        if(NULL != ret)
+        {
+            return(ret);
+        }
+    }
    
 
     if(NULL == p)
@@ -334,6 +439,11 @@ extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t ali
             //size = s_align_size(alignmode, size);  // alignment is internal to s_eo_mempool_get_static()
             ret = s_eo_mempool_get_static(alignmode, size, number, &usedbytespool);
         } break;
+        
+        case eo_mempool_alloc_pooled:
+        {   // every block is 8-byte aligned, thus it is good for any alignmode. it updates the stats by itself
+            ret = s_eo_mempool_get_pooled((uint32_t)number*size);
+        } break;
     
     }
     
@@ -365,9 +475,52 @@ extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p)
 }
 
 
+extern eObool_t eo_mempool_CanDelete(EOtheMemoryPool *p)
+{
+    eOmempool_alloc_mode_t mode = s_the_mempool.config.mode;
+    return(((eo_mempool_alloc_dynamic == mode) || (eo_mempool_alloc_pooled == mode)) ? (eobool_true) : (eobool_false));
+}
+
+
+extern eOresult_t eo_mempool_pooled_Stats_Get(EOtheMemoryPool *p, uint8_t sizeclass, eOmempool_pooled_stats_t *stats)
+{
+    if((NULL == stats) || (eo_mempool_alloc_pooled != s_the_mempool.config.mode) || (sizeclass >= eo_mempool_pooled_classes_numberof))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    memcpy(stats, &s_the_mempool.pooled.stats[sizeclass], sizeof(eOmempool_pooled_stats_t));
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(eores_OK);
+}
+
+
 extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
 {
-    void *ret = s_the_mempool.theheap.allocate(size);
+    void *ret = NULL;
+    uint32_t usedbytespool = 0;
+    uint32_t usedbytesheap = 0;
+    
+    if(NULL != s_eo_mempool_arena_current)
+    {
+        ret = s_eo_mempool_arena_get(s_eo_mempool_arena_current, size);
+        if(NULL != ret)
+        {
+            return(ret);
+        }
+    }
+    
+    if(eo_mempool_alloc_pooled == s_the_mempool.config.mode)
+    {   // so that eo_mempool_Delete() can release it. it updates the stats by itself
+        ret = s_eo_mempool_get_pooled(size);
+    }
+    else
+    {
+        ret = s_the_mempool.theheap.allocate(size);
+        usedbytesheap = eo_common_msize(ret);
+    }
 
     if(NULL == ret)
     {   // manage the fatal error in case memory could not be achieved
@@ -379,7 +532,8 @@ extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_New() no more memory", s_eobj_ownname, &errdes);
     }
     
-    s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);      
+    s_the_mempool.stats.usedbytespool += usedbytespool;      
+    s_the_mempool.stats.usedbytesheap += usedbytesheap;      
 
     return(ret);   
 }
@@ -388,12 +542,40 @@ extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
 extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
 {  
     void *ret = NULL;
+    eOmempool_arena_t *arena = NULL;
     if(0 == size)
     {
         eo_mempool_Delete(p, m);
         return(NULL);
     }
     
+    arena = s_eo_mempool_arena_of(m);
+    if((NULL != arena) || ((NULL == m) && (NULL != s_eo_mempool_arena_current)))
+    {   // m is inside an arena or it is NULL and the thread is inside an arena
+        return(s_eo_mempool_arena_realloc(arena, m, size));
+    }
+    
+    if(eo_mempool_alloc_pooled == s_the_mempool.config.mode)
+    {   // a new block (maybe of the same class) which takes the old content
+        ret = s_eo_mempool_get_pooled(size);
+        if(NULL == ret)
+        {
+            eOerrmanDescriptor_t errdes = {0};
+            errdes.code             = eo_errman_code_sys_memory_missing;
+            errdes.par16            = size;
+            errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+            errdes.sourceaddress    = 0;         
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() no more memory", s_eobj_ownname, &errdes);
+            return(NULL);
+        }
+        if(NULL != m)
+        {
+            uint32_t oldsize = ((eOmempool_pooled_header_t*)m - 1)->size;
+            memcpy(ret, m, (oldsize < size) ? (oldsize) : (size));
+            s_eo_mempool_release_pooled(m);
+        }
+        return(ret);
+    }
     
     if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
     {
@@ -437,6 +619,17 @@ extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m)
         return;
     }
     
+    if(NULL != s_eo_mempool_arena_of(m))
+    {   // it goes away with its arena
+        return;
+    }
+    
+    if(eo_mempool_alloc_pooled == s_the_mempool.config.mode)
+    {
+        s_eo_mempool_release_pooled(m);
+        return;
+    }
+    
     if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
     {        
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_Delete(): only w/ eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);       
@@ -449,6 +642,129 @@ extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m)
 }
 
 
+extern eOmempool_arena_t * eo_mempool_arena_New(EOtheMemoryPool *p, uint32_t capacity)
+{
+    eOmempool_arena_t *arena = NULL;
+    uint32_t offset = EOMEMPOOL_ALIGN8(sizeof(eOmempool_arena_t));
+    uint32_t pos = 0;
+    
+    if(0 == capacity)
+    {
+        return(NULL);
+    }
+    
+    capacity = EOMEMPOOL_ALIGN8(capacity);
+    
+    // the arena and its memory are a single block of the heap
+    arena = (eOmempool_arena_t*) s_the_mempool.theheap.allocate(offset + capacity);
+    
+    if(NULL == arena)
+    {
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_memory_missing;
+        errdes.par16            = 0;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0; 
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_arena_New() no more memory", s_eobj_ownname, &errdes);
+        return(NULL);
+    }
+    
+    // the blocks of the arena are zeroed only now, as they are never reused
+    memset(arena, 0, offset + capacity);
+    arena->data = (uint8_t*)arena + offset;
+    arena->stats.capacity = capacity;
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    if(EOMEMPOOL_ARENAS_MAX == s_the_mempool.arenas)
+    {
+        eov_mutex_Release(s_the_mempool.mutex);
+        s_the_mempool.theheap.release(arena);
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_arena_New() too many arenas", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+        return(NULL);
+    }
+    
+    // the range of the arena goes in its sorted position, while the sequence number is odd
+    pos = s_eo_mempool_arena_position(arena->data);
+    s_the_mempool.arenasseq ++;
+    EOMEMPOOL_RELEASE();
+    memmove(&s_the_mempool.arenaranges[pos+1], &s_the_mempool.arenaranges[pos], (s_the_mempool.arenas - pos)*sizeof(eOmempool_arena_range_t));
+    s_the_mempool.arenaranges[pos].begin = arena->data;
+    s_the_mempool.arenaranges[pos].end = arena->data + capacity;
+    s_the_mempool.arenaranges[pos].arena = arena;
+    s_the_mempool.arenas ++;
+    EOMEMPOOL_RELEASE();
+    s_the_mempool.arenasseq ++;
+    
+    s_the_mempool.stats.usedbytesheap += offset + capacity;
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(arena);
+}
+
+
+extern void eo_mempool_arena_Delete(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+{
+    uint32_t pos = 0;
+    
+    if(NULL == arena)
+    {
+        return;
+    }
+    
+    if(arena == s_eo_mempool_arena_current)
+    {
+        s_eo_mempool_arena_current = NULL;
+    }
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    pos = s_eo_mempool_arena_position(arena->data);
+    if((pos < s_the_mempool.arenas) && (arena == s_the_mempool.arenaranges[pos].arena))
+    {
+        s_the_mempool.arenasseq ++;
+        EOMEMPOOL_RELEASE();
+        memmove(&s_the_mempool.arenaranges[pos], &s_the_mempool.arenaranges[pos+1], (s_the_mempool.arenas - pos - 1)*sizeof(eOmempool_arena_range_t));
+        s_the_mempool.arenas --;
+        EOMEMPOOL_RELEASE();
+        s_the_mempool.arenasseq ++;
+    }
+    
+    s_the_mempool.stats.usedbytesheap -= EOMEMPOOL_ALIGN8(sizeof(eOmempool_arena_t)) + arena->stats.capacity;
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    s_the_mempool.theheap.release(arena);
+}
+
+
+extern eOmempool_arena_t * eo_mempool_arena_Enter(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+{
+    eOmempool_arena_t *previous = s_eo_mempool_arena_current;
+    s_eo_mempool_arena_current = arena;
+    return(previous);
+}
+
+
+extern void eo_mempool_arena_Leave(EOtheMemoryPool *p, eOmempool_arena_t *previous)
+{
+    s_eo_mempool_arena_current = previous;
+}
+
+
+extern eOresult_t eo_mempool_arena_Stats_Get(EOtheMemoryPool *p, eOmempool_arena_t *arena, eOmempool_arena_stats_t *stats)
+{
+    if((NULL == arena) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    memcpy(stats, &arena->stats, sizeof(eOmempool_arena_stats_t));
+    
+    return(eores_OK);
+}
+
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -551,6 +867,302 @@ static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t
     return(ret);
 }
 
+// it updates the stats of the singleton under its mutex, as the pooled mode is used by concurrent threads
+static void * s_eo_mempool_get_pooled(uint32_t size)
+{
+    eOmempool_pooled_header_t *h = NULL;
+    eOmempool_pooled_stats_t *stats = NULL;
+    uint8_t sizeclass = 0;
+    
+    while((sizeclass < eo_mempool_pooled_classes_numberof) && ((8UL << sizeclass) < size))
+    {
+        sizeclass ++;
+    }
+    
+    if(eo_mempool_pooled_classes_numberof == sizeclass)
+    {   // too big for the classes: it comes directly from the heap
+        h = (eOmempool_pooled_header_t*) s_the_mempool.theheap.allocate(sizeof(eOmempool_pooled_header_t) + size);
+        if(NULL == h)
+        {
+            return(NULL);
+        }
+        h->sizeclass = sizeclass;
+        h->size = size;
+        eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+        s_the_mempool.stats.usedbytesheap += size;
+        eov_mutex_Release(s_the_mempool.mutex);
+        return(h + 1);
+    }
+    
+    if(eores_NOK_timeout == eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout))
+    {
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_mutex_timeout;
+        errdes.par16            = s_the_mempool.tout / 1000;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "s_eo_mempool_get_pooled(): mutex_take() tout", s_eobj_ownname, &errdes);
+    }
+    
+    if((NULL == s_the_mempool.pooled.freelist[sizeclass]) && (eobool_false == s_eo_mempool_pooled_refill(sizeclass)))
+    {
+        eov_mutex_Release(s_the_mempool.mutex);
+        return(NULL);
+    }
+    
+    // pop the first free block
+    h = (eOmempool_pooled_header_t*) s_the_mempool.pooled.freelist[sizeclass];
+    s_the_mempool.pooled.freelist[sizeclass] = *((void**)(h + 1));
+    h->sizeclass = sizeclass;
+    h->size = size;
+    
+    stats = &s_the_mempool.pooled.stats[sizeclass];
+    stats->inuse ++;
+    stats->requestedbytes += size;
+    if(stats->inuse > stats->highwatermark)
+    {
+        stats->highwatermark = stats->inuse;
+    }
+    s_the_mempool.stats.usedbytespool += size;
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    // as calloc() does
+    memset(h + 1, 0, size);
+    
+    return(h + 1);
+}
+
+
+static void s_eo_mempool_release_pooled(void *m)
+{
+    eOmempool_pooled_header_t *h = (eOmempool_pooled_header_t*)m - 1;
+    eOmempool_pooled_stats_t *stats = NULL;
+    
+    if(eo_mempool_pooled_classes_numberof == h->sizeclass)
+    {
+        eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+        s_the_mempool.stats.usedbytesheap -= h->size;
+        eov_mutex_Release(s_the_mempool.mutex);
+        s_the_mempool.theheap.release(h);
+        return;
+    }
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    // push the block in front of the free list
+    *((void**)m) = s_the_mempool.pooled.freelist[h->sizeclass];
+    s_the_mempool.pooled.freelist[h->sizeclass] = h;
+    
+    stats = &s_the_mempool.pooled.stats[h->sizeclass];
+    stats->inuse --;
+    stats->requestedbytes -= h->size;
+    s_the_mempool.stats.usedbytespool -= h->size;
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+}
+
+
+static eObool_t s_eo_mempool_pooled_refill(uint8_t sizeclass)
+{   // it is called with the mutex taken
+    eOmempool_the_pool_t* pool = &s_the_mempool.thepool;
+    uint32_t sizeofblock = sizeof(eOmempool_pooled_header_t) + (8UL << sizeclass);
+    uint32_t number = (sizeofblock < EOMEMPOOL_POOLED_CHUNK) ? (EOMEMPOOL_POOLED_CHUNK / sizeofblock) : (1);
+    uint8_t *chunk = NULL;
+    uint32_t i = 0;
+    
+    if(0 != (pool->status.poolsmask & 8))
+    {   // from the 64-bit pool. if it is exhausted we dont go to the heap, as in eo_mempool_alloc_static mode
+        uint32_t numentries = number * (sizeofblock / 8);
+        if((uint32_t)(pool->status.uint64index + numentries) <= (pool->config.size64/8)) 
+        {
+            chunk = (uint8_t*) &pool->config.data64[pool->status.uint64index];
+            pool->status.uint64index += numentries;
+        }  
+    }
+    else
+    {
+        chunk = (uint8_t*) s_the_mempool.theheap.allocate(number * sizeofblock);
+    }
+    
+    if(NULL == chunk)
+    {
+        return(eobool_false);
+    }
+    
+    for(i=0; i<number; i++)
+    {
+        eOmempool_pooled_header_t *h = (eOmempool_pooled_header_t*) &chunk[i*sizeofblock];
+        *((void**)(h + 1)) = s_the_mempool.pooled.freelist[sizeclass];
+        s_the_mempool.pooled.freelist[sizeclass] = h;
+    }
+    
+    s_the_mempool.pooled.stats[sizeclass].blocks += number;
+    
+    return(eobool_true);
+}
+
+
+static void * s_eo_mempool_arena_get(eOmempool_arena_t *arena, uint32_t size)
+{   // only the thread inside the arena calls it, hence no lock
+    uint32_t sizeofblock = sizeof(eOmempool_arena_header_t) + EOMEMPOOL_ALIGN8(size);
+    eOmempool_arena_header_t *h = NULL;
+    
+    if(sizeofblock > (arena->stats.capacity - arena->stats.used))
+    {
+        arena->stats.overflows ++;
+        arena->stats.overflowbytes += size;
+        return(NULL);
+    }
+    
+    h = (eOmempool_arena_header_t*) &arena->data[arena->stats.used];
+    h->size = size;
+    arena->stats.used += sizeofblock;
+    arena->stats.blocks ++;
+    
+    return(h + 1);
+}
+
+
+static eOmempool_arena_t * s_eo_mempool_arena_of(void *m)
+{   // m is of an arena only if it is inside the memory of a registered arena: the bytes around m are never read
+    const uint8_t *b = (const uint8_t*)m;
+    eOmempool_arena_t *current = s_eo_mempool_arena_current;
+    eOmempool_arena_t *arena = NULL;
+#if defined(EOMEMPOOL_ARENAS_LOCKFREE)
+    uint32_t seq = 0;
+    uint8_t i = 0;
+#endif
+    
+    if(NULL == m)
+    {
+        return(NULL);
+    }
+    
+    // most often the block is of the arena of the thread
+    if((NULL != current) && (b > current->data) && (b < &current->data[current->stats.capacity]))
+    {
+        return(current);
+    }
+    
+    if(0 == s_the_mempool.arenas)
+    {
+        return(NULL);
+    }
+    
+#if defined(EOMEMPOOL_ARENAS_LOCKFREE)
+    for(i=0; i<EOMEMPOOL_ARENAS_ATTEMPTS; i++)
+    {
+        seq = s_the_mempool.arenasseq;
+        EOMEMPOOL_ACQUIRE();
+        if(0 == (seq & 1))
+        {
+            arena = s_eo_mempool_arena_search(b);
+            EOMEMPOOL_ACQUIRE();
+            if(seq == s_the_mempool.arenasseq)
+            {
+                return(arena);
+            }
+        }
+    }
+#endif
+    
+    // the ranges are changing too often (or we dont have the fences): we read them under the mutex
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    arena = s_eo_mempool_arena_search(b);
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(arena);
+}
+
+
+static eOmempool_arena_t * s_eo_mempool_arena_search(const uint8_t *m)
+{   // it may read a torn arenaranges[], hence it never dereferences what it finds and it stays inside the array
+    uint32_t n = s_the_mempool.arenas;
+    uint32_t lo = 0;
+    uint32_t hi = (n > EOMEMPOOL_ARENAS_MAX) ? (EOMEMPOOL_ARENAS_MAX) : (n);
+    uint32_t mid = 0;
+    const eOmempool_arena_range_t *r = NULL;
+    
+    while(lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        r = &s_the_mempool.arenaranges[mid];
+        if(m <= r->begin)
+        {   // the first block of an arena starts after its header
+            hi = mid;
+        }
+        else if(m >= r->end)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            return(r->arena);
+        }
+    }
+    
+    return(NULL);
+}
+
+
+static uint32_t s_eo_mempool_arena_position(const uint8_t *begin)
+{   // called w/ the mutex taken: the position of the first range which does not start before begin
+    uint32_t lo = 0;
+    uint32_t hi = s_the_mempool.arenas;
+    uint32_t mid = 0;
+    
+    while(lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if(s_the_mempool.arenaranges[mid].begin < begin)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    
+    return(lo);
+}
+
+
+static void * s_eo_mempool_arena_realloc(eOmempool_arena_t *arena, void *m, uint32_t size)
+{
+    eOmempool_arena_header_t *h = (NULL == m) ? (NULL) : ((eOmempool_arena_header_t*)m - 1);
+    void *ret = NULL;
+    
+    if((NULL != h) && (arena == s_eo_mempool_arena_current) && 
+       (((uint8_t*)m + EOMEMPOOL_ALIGN8(h->size)) == &arena->data[arena->stats.used]) &&
+       ((arena->stats.used - EOMEMPOOL_ALIGN8(h->size) + EOMEMPOOL_ALIGN8(size)) <= arena->stats.capacity))
+    {   // the last block of the arena of the thread grows or shrinks in place. what is given or taken back is zeroed
+        if(size > h->size)
+        {
+            memset((uint8_t*)m + h->size, 0, size - h->size);
+        }
+        else
+        {
+            memset((uint8_t*)m + size, 0, h->size - size);
+        }
+        arena->stats.used = arena->stats.used - EOMEMPOOL_ALIGN8(h->size) + EOMEMPOOL_ALIGN8(size);
+        h->size = size;
+        return(m);
+    }
+    
+    // a new block from the arena of the thread (or from the EOtheMemoryPool) takes the content. the old block stays where it is
+    ret = eo_mempool_New(eo_mempool_GetHandle(), size);
+    if((NULL != ret) && (NULL != h))
+    {
+        memcpy(ret, m, (h->size < size) ? (h->size) : (size));
+    }
+    
+    return(ret);
+}
+
+
+
 static void * s_memallocator(uint32_t s)
 {
     return(calloc(s, 1));
@@ -41,6 +41,14 @@ extern "C" {
     If initialised to work in static mode, the user must pass to the singleton some memory pools where to get memory. If it is
     defined the mixed mode, the singleton shall get memory from the heap if the pool is not defined.
     In static and mixed mode it is possible to allocate memory but not to reallocate and release it.
+    In pooled mode (eo_mempool_alloc_pooled) the memory is given in blocks of a few size classes, each with its own
+    free list, so that it can be released and reused in constant time. The blocks are carved from the user-defined 
+    64-bit aligned pool (if any) or else from the heap, which is used directly only for what is bigger than the biggest class.
+    In every mode a thread can enter an arena (eo_mempool_arena_Enter()): a private region of memory from which the 
+    EOtheMemoryPool gives what that thread asks until it leaves the arena, without the mutex and without touching the pools. 
+    The memory of an arena is never released one block at a time: eo_mempool_Delete() recognises it by 
+    its address and ignores it, and it all goes away with eo_mempool_arena_Delete(). Hence an object with everything it owns can be placed in consecutive memory and removed in 
+    one shot.
         
     It is responsibility of the object EOVtheSystem (via its derived object) to initialise the EOtheMemoryPool. 
 
@@ -80,9 +88,50 @@ typedef enum
 {
     eo_mempool_alloc_dynamic    = 0,
     eo_mempool_alloc_static     = 1,
-    eo_mempool_alloc_mixed      = 2
+    eo_mempool_alloc_mixed      = 2,
+    eo_mempool_alloc_pooled     = 3
 } eOmempool_alloc_mode_t;
 
+
+// the size classes of eo_mempool_alloc_pooled mode: class k has blocks of 8*2^k bytes, so that the biggest one has blocks 
+// of 4096 bytes. every block is 8-byte aligned, thus a single set of classes serves every eOmempool_alignment_t.
+enum { eo_mempool_pooled_classes_numberof = 10 };
+
+
+/**	@typedef    typedef struct eOmempool_pooled_stats_t 
+ 	@brief      The statistics of a size class of eo_mempool_alloc_pooled mode. the bytes lost inside the blocks in use 
+                (internal fragmentation) are inuse*sizeofblock - requestedbytes. the bytes kept in the free list 
+                (external fragmentation) are (blocks - inuse)*sizeofblock. 
+ **/
+typedef struct
+{
+    uint32_t                    sizeofblock;
+    uint32_t                    blocks;             // the blocks carved so far. they are never given back to the heap or to the pool
+    uint32_t                    inuse;
+    uint32_t                    highwatermark;      // the maximum of inuse
+    uint32_t                    requestedbytes;     // the bytes requested for the blocks in use
+} eOmempool_pooled_stats_t;
+
+
+/** @typedef    typedef struct eOmempool_arena_hid eOmempool_arena_t
+ 	@brief      eOmempool_arena_t is an opaque struct which holds a private region of memory. 
+ **/
+typedef struct eOmempool_arena_hid eOmempool_arena_t;
+
+
+/**	@typedef    typedef struct eOmempool_arena_stats_t 
+ 	@brief      The statistics of an arena. when used gets close to capacity the arena should be created bigger. 
+ **/
+typedef struct
+{
+    uint32_t                    capacity;
+    uint32_t                    used;               // the bytes given so far, including a header of 8 bytes per block
+    uint32_t                    blocks;
+    uint32_t                    overflows;          // the requests which did not fit and were served by the EOtheMemoryPool 
+    uint32_t                    overflowbytes;
+} eOmempool_arena_stats_t;
+
+
 typedef struct 
 {
     eOvoidp_fp_uint32_t         allocate;
@@ -217,6 +266,25 @@ extern uint32_t eo_mempool_SizeOfAllocated(EOtheMemoryPool *p);
 extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p);
 
 
+/** @fn         extern eObool_t eo_mempool_CanDelete(EOtheMemoryPool *p)
+    @brief      Tells if the memory given by the EOtheMemoryPool can be released with eo_mempool_Delete() and reallocated
+                with eo_mempool_Realloc(). It is true in eo_mempool_alloc_dynamic and eo_mempool_alloc_pooled modes.
+    @param      p               The mempool singleton                
+    @return     eobool_true or eobool_false.
+ **/ 
+extern eObool_t eo_mempool_CanDelete(EOtheMemoryPool *p);
+
+
+/** @fn         extern eOresult_t eo_mempool_pooled_Stats_Get(EOtheMemoryPool *p, uint8_t sizeclass, eOmempool_pooled_stats_t *stats)
+    @brief      Gives back the statistics of a size class of eo_mempool_alloc_pooled mode.
+    @param      p               The mempool singleton                
+    @param      sizeclass       The size class, lower than eo_mempool_pooled_classes_numberof.
+    @param      stats           The statistics.
+    @return     eores_OK, or eores_NOK_generic if the mode is not eo_mempool_alloc_pooled or sizeclass is wrong.
+ **/ 
+extern eOresult_t eo_mempool_pooled_Stats_Get(EOtheMemoryPool *p, uint8_t sizeclass, eOmempool_pooled_stats_t *stats);
+
+
 /** @fn         extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
     @brief      Gives back memory using heap. If the singleton handler is NULL or if it was not initialised in dynamic mode,
                 it uses the default calloc() function. 
@@ -258,6 +326,60 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size);
 extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m);
 
 
+/** @fn         extern eOmempool_arena_t * eo_mempool_arena_New(EOtheMemoryPool *p, uint32_t capacity)
+    @brief      Creates an arena: a single block of capacity bytes taken from the heap (also in eo_mempool_alloc_static or 
+                eo_mempool_alloc_mixed modes). its memory is given only to the threads which enter it.
+    @param      p               The mempool singleton                
+    @param      capacity        The size of the arena. Every block given by the arena takes 8 bytes more than requested 
+                                and its size is rounded up to a multiple of 8.
+    @return     The arena or NULL if capacity is zero or if EOMEMPOOL_ARENAS_MAX arenas already exist (w/ a warning). 
+                Issues a fatal error to the EOtheErrorManager if there is no memory.
+ **/ 
+extern eOmempool_arena_t * eo_mempool_arena_New(EOtheMemoryPool *p, uint32_t capacity);
+
+
+/** @fn         extern void eo_mempool_arena_Delete(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+    @brief      Releases in one shot all the memory of the arena. It must be called after the objects allocated inside it
+                have been deleted (so that they can release what they hold outside the arena, e.g., the blocks which did
+                not fit it) and when no thread is inside it.
+    @param      p               The mempool singleton                
+    @param      arena           The arena.
+ **/ 
+extern void eo_mempool_arena_Delete(EOtheMemoryPool *p, eOmempool_arena_t *arena);
+
+
+/** @fn         extern eOmempool_arena_t * eo_mempool_arena_Enter(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+    @brief      Makes the calling thread take its memory from the arena: eo_mempool_GetMemory(), eo_mempool_New() and 
+                eo_mempool_Realloc() serve the thread from the arena without any mutex. If the arena has no more room 
+                the request is served by the EOtheMemoryPool as usual. An arena must be entered by one thread at a time.
+                On hosts (linux, macos, windows w/ msvc or mingw) the current arena is per thread. Elsewhere, e.g., on the 
+                boards, it is the same for all threads, hence there only one thread at a time can use arenas.
+    @param      p               The mempool singleton                
+    @param      arena           The arena. NULL makes the thread use the EOtheMemoryPool again.
+    @return     The arena which was current before, to be passed to eo_mempool_arena_Leave().
+ **/ 
+extern eOmempool_arena_t * eo_mempool_arena_Enter(EOtheMemoryPool *p, eOmempool_arena_t *arena);
+
+
+/** @fn         extern void eo_mempool_arena_Leave(EOtheMemoryPool *p, eOmempool_arena_t *previous)
+    @brief      Makes the calling thread go back to the arena it had before eo_mempool_arena_Enter().
+    @param      p               The mempool singleton                
+    @param      previous        The value returned by eo_mempool_arena_Enter().
+ **/ 
+extern void eo_mempool_arena_Leave(EOtheMemoryPool *p, eOmempool_arena_t *previous);
+
+
+/** @fn         extern eOresult_t eo_mempool_arena_Stats_Get(EOtheMemoryPool *p, eOmempool_arena_t *arena, eOmempool_arena_stats_t *stats)
+    @brief      Gives back the statistics of an arena. They are consistent only if no thread is inside the arena. 
+    @param      p               The mempool singleton                
+    @param      arena           The arena.
+    @param      stats           The statistics.
+    @return     eores_OK, or eores_NOK_nullpointer.
+ **/ 
+extern eOresult_t eo_mempool_arena_Stats_Get(EOtheMemoryPool *p, eOmempool_arena_t *arena, eOmempool_arena_stats_t *stats);
+
+
+
 
 /** @}            
     end of group eo_thememorypool  
@@ -56,6 +56,48 @@ typedef struct
     uint32_t    usedbytespool;
 } eOmempool_stats_t;
 
+// every block of eo_mempool_alloc_pooled mode starts with it. the memory given to the user follows it.
+typedef struct
+{
+    uint32_t    sizeclass;      // eo_mempool_pooled_classes_numberof if the block comes directly from the heap 
+    uint32_t    size;           // the requested bytes
+} eOmempool_pooled_header_t;
+
+typedef struct
+{
+    void*                       freelist[eo_mempool_pooled_classes_numberof];   // the free blocks are linked through their first bytes
+    eOmempool_pooled_stats_t    stats[eo_mempool_pooled_classes_numberof];
+} eOmempool_pooled_t;
+
+// the arenas which can exist at the same time
+#if !defined(EOMEMPOOL_ARENAS_MAX)
+    #define EOMEMPOOL_ARENAS_MAX    (64)
+#endif
+
+// every block given by an arena starts with it. the memory given to the user follows it, 8-byte aligned.
+typedef struct
+{
+    uint32_t                    size;           // the requested bytes
+    uint32_t                    dummy;          // so that the memory given to the user is 8-byte aligned
+} eOmempool_arena_header_t;
+
+// it is at the start of the block taken from the heap. the memory of the arena follows it.
+struct eOmempool_arena_hid
+{
+    uint8_t*                    data;
+    eOmempool_arena_stats_t     stats;
+};
+
+// the memory of an arena as registered in the EOtheMemoryPool: eo_mempool_Delete() and eo_mempool_Realloc() recognise 
+// the blocks of the arenas by their address
+typedef struct
+{
+    const uint8_t*              begin;
+    const uint8_t*              end;
+    eOmempool_arena_t*          arena;
+} eOmempool_arena_range_t;
+
+
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
 struct EOtheMemoryPool_hid 
@@ -67,6 +109,10 @@ struct EOtheMemoryPool_hid
     EOVmutex                        *mutex;
     eOreltime_t                     tout;
     eOmempool_stats_t               stats;
+    eOmempool_pooled_t              pooled;
+    volatile uint32_t               arenasseq;  // odd while arenaranges[] changes, so that it can be read w/out the mutex
+    volatile uint32_t               arenas;     // how many are in arenaranges[]
+    eOmempool_arena_range_t         arenaranges[EOMEMPOOL_ARENAS_MAX];  // sorted by address
 }; 
 
 
@@ -144,7 +144,7 @@ extern EOvector* eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     
     if(eo_vectorcapacity_dynamic == retptr->capacity)
     {      
-        eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_vector_New(): cannot use eo_vectorcapacity_dynamic", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+        eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_CanDelete(eo_mempool_GetHandle())), "eo_vector_New(): cannot use eo_vectorcapacity_dynamic", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
         retptr->stored_items = NULL;
     }
     else
@@ -89,7 +89,7 @@ typedef uint32_t eOprotIP_t;
 typedef uint8_t eOprotBRD_t;
 
 #if defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
-enum { eoprot_board_remotes_maxnumberof = 128 };    // this number just limits the max number of allocable remote boards
+enum { eoprot_board_remotes_maxnumberof = 254 };    // all the numbers below eoprot_board_localboard. the memory of a board is allocated only when reserved
 #else
 enum { eoprot_board_remotes_maxnumberof = 32 };    // this number forces static allocation of some data structure, thus keep it low
 #endif
@@ -409,6 +409,15 @@ extern eOresult_t eoprot_ID2information(eOprotID32_t id, char* string, uint16_t
 
 extern eObool_t eoprot_EPcfg_isvalid(eOprot_EPcfg_t *cfgofep);
 
+/** @fn         extern uint16_t eoprot_EPcfg_sizeof_get(const eOprot_EPcfg_t *cfgofep)
+    @brief      it tells the size of the ram of an endpoint with the multiplicity of entities in cfgofep. it is the value which
+                eoprot_endpoint_sizeof_get() returns after eoprot_config_endpoint_entities(), but it does not need any board.
+    @param      cfgofep         the configuration of the endpoint
+    @return     the size in bytes or 0 if cfgofep is NULL or has an invalid endpoint.
+ **/
+extern uint16_t eoprot_EPcfg_sizeof_get(const eOprot_EPcfg_t *cfgofep);
+
+
 // functions which manage protocol version
 
 
@@ -427,20 +436,30 @@ extern const eoprot_version_t * eoprot_version_of_endpoint_get(eOprotEndpoint_t
 /** @fn         extern eOresult_t eoprot_config_board_reserve(eOprotBRD_t brd)
     @brief      it configures the library so that this particular board can be managed.
                 if the board is eoprot_board_localboard then the space is already allocated.
-                if instead is a given number then if we use dynamic mode then the memory is allocated / reallocated
-                to host an array index of value equal to brd. thus if we reserve for brd = 2, then 4, then 0, then 1
-                the memory is allocated to host 3 boards, then 4, then nothing is done because 0 and 1 are already supported.
+                if instead is a given number then if we use dynamic mode then the memory is allocated for that board only,
+                if not already done. the memory of a board is never moved, thus the lookup of a board is always a direct 
+                access and other threads can use the boards already reserved while a new one is reserved.
                 in case of static allocation we never allocate.
-                in both cases we retrun error if brd >= eoprot_boards_maxnumberof
+                in both cases we retrun error if brd >= eoprot_board_remotes_maxnumberof
     @param      brd                 the number of board 
     @return     eores_OK or eores_NOK_generic upon failure.
  **/
 extern eOresult_t eoprot_config_board_reserve(eOprotBRD_t brd);
 
 
+/** @fn         extern eOresult_t eoprot_config_board_reserve_range(eOprotBRD_t first, uint8_t numberof)
+    @brief      it reserves the boards from first to first+numberof-1 as eoprot_config_board_reserve() does, but in dynamic 
+                mode it allocates the memory of all of them at once. 
+    @param      first               the number of the first board 
+    @param      numberof            the number of boards
+    @return     eores_OK or eores_NOK_generic upon failure, in which case no board is reserved.
+ **/
+extern eOresult_t eoprot_config_board_reserve_range(eOprotBRD_t first, uint8_t numberof);
+
+
 /** @fn         extern eOresult_t eoprot_config_board_numberof(uint8_t numofboards)
     @brief      it configures the library to use a given number of boards. it is the same as calling
-                eoprot_config_board_reserve(numofboards-1);
+                eoprot_config_board_reserve_range(0, numofboards);
     @param      numofboards         the number of boards.
     @return     eores_OK or eores_NOK_generic upon failure.
  **/
@@ -728,6 +747,18 @@ extern uint16_t eoprot_entity_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, e
 extern uint8_t eoprot_entity_numberof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity);
 
 
+/** @fn         extern uint64_t eoprot_entity_tags_withinit_get(eOprotEndpoint_t ep, eOprotEntity_t entity)
+    @brief      it tells which variables of an entity have an init() callback. the result is the same for every board. it is 
+                computed from the rom the first time and then it is kept updated by eoprot_config_callbacks_variable_set().
+    @param      ep              the endpoint.
+    @param      entity          the entity.
+    @return     a mask where bit (1 << tag) is set if the variable with that tag has an init() callback. a tag beyond 63 
+                sets all the bits. 0 in case of invalid parameters.
+ **/
+extern uint64_t eoprot_entity_tags_withinit_get(eOprotEndpoint_t ep, eOprotEntity_t entity);
+
+
+
 /** @fn         extern eObool_t eoprot_id_isvalid(eOprotBRD_t brd, eOprotID32_t id)
     @brief      it tells if a given ID is valid on that board.
     @param      brd             the number of the board.
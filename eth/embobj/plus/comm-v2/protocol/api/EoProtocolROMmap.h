@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPROTOCOLROMMAP_H_
+#define _EOPROTOCOLROMMAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       EoProtocolROMmap.h
+    @brief      This header file gives the map of the variables of every entity inside the entity itself.
+    @author     marco.accame@iit.it
+    @date       06/05/2013
+**/
+
+/** @defgroup eo_EoProtocolROMmap Map of the variables of the entities 
+    For every entity of the endpoints MN, MC, AS, SK there is a macro EOPROT_ROMMAP_<EP>_<ENTITY>(W, M) which lists all its 
+    variables in order of tag. The whole entity is listed as W(tag, type-of-entity) and every other variable is listed as 
+    M(tag, type-of-entity, member-of-entity). The list is the same as the descriptors in EoProtocol<EP>_rom.c, thus when a 
+    tag is added or changed it must be changed in both places.
+    The macros expand to whatever the W and M passed to them expand. With EOPROT_ROMMAP_OFFSETOF_W / _M and 
+    EOPROT_ROMMAP_SIZEOF_W / _M they become the initialisers of tables of offsets and of sizes which the compiler computes. 
+    They are used by EoProtocol<EP>_rom.c and by the C++ header EoProtocolROMmap.hpp.
+    
+    @{        
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "stddef.h"
+#include "EoCommon.h"
+#include "EoProtocolMN.h"
+#include "EoProtocolMC.h"
+#include "EoProtocolAS.h"
+#include "EoProtocolSK.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+// the expansions for a table of the offsets of the variables inside their entity
+#define EOPROT_ROMMAP_OFFSETOF_W(tag, type)             0,
+#define EOPROT_ROMMAP_OFFSETOF_M(tag, type, member)     offsetof(type, member),
+
+// the expansions for a table of the sizes of the variables
+#define EOPROT_ROMMAP_SIZEOF_W(tag, type)               sizeof(type),
+#define EOPROT_ROMMAP_SIZEOF_M(tag, type, member)       sizeof(((type*)0)->member),
+
+
+// - management
+
+#define EOPROT_ROMMAP_MN_COMM(W, M) \
+    W(eoprot_tag_mn_comm_wholeitem,                        eOmn_comm_t) \
+    M(eoprot_tag_mn_comm_status,                           eOmn_comm_t, status) \
+    M(eoprot_tag_mn_comm_status_managementprotocolversion, eOmn_comm_t, status.managementprotocolversion) \
+    M(eoprot_tag_mn_comm_cmmnds_command_querynumof,        eOmn_comm_t, cmmnds.command.cmd.querynumof) \
+    M(eoprot_tag_mn_comm_cmmnds_command_queryarray,        eOmn_comm_t, cmmnds.command.cmd.queryarray) \
+    M(eoprot_tag_mn_comm_cmmnds_command_replynumof,        eOmn_comm_t, cmmnds.command.cmd.replynumof) \
+    M(eoprot_tag_mn_comm_cmmnds_command_replyarray,        eOmn_comm_t, cmmnds.command.cmd.replyarray) \
+    M(eoprot_tag_mn_comm_cmmnds_command_config,            eOmn_comm_t, cmmnds.command.cmd.config)
+
+#define EOPROT_ROMMAP_MN_APPL(W, M) \
+    W(eoprot_tag_mn_appl_wholeitem,            eOmn_appl_t) \
+    M(eoprot_tag_mn_appl_config,               eOmn_appl_t, config) \
+    M(eoprot_tag_mn_appl_config_txratedivider, eOmn_appl_t, config.txratedivider) \
+    M(eoprot_tag_mn_appl_status,               eOmn_appl_t, status) \
+    M(eoprot_tag_mn_appl_cmmnds_go2state,      eOmn_appl_t, cmmnds.go2state)
+
+#define EOPROT_ROMMAP_MN_INFO(W, M) \
+    W(eoprot_tag_mn_info_wholeitem,      eOmn_info_t) \
+    M(eoprot_tag_mn_info_config,         eOmn_info_t, config) \
+    M(eoprot_tag_mn_info_config_enabled, eOmn_info_t, config.enabled) \
+    M(eoprot_tag_mn_info_status,         eOmn_info_t, status) \
+    M(eoprot_tag_mn_info_status_basic,   eOmn_info_t, status.basic)
+
+#define EOPROT_ROMMAP_MN_SERVICE(W, M) \
+    W(eoprot_tag_mn_service_wholeitem,            eOmn_service_t) \
+    M(eoprot_tag_mn_service_status_commandresult, eOmn_service_t, status.commandresult) \
+    M(eoprot_tag_mn_service_cmmnds_command,       eOmn_service_t, cmmnds.command)
+
+
+// - motion control
+
+#define EOPROT_ROMMAP_MC_JOINT(W, M) \
+    W(eoprot_tag_mc_joint_wholeitem,                               eOmc_joint_t) \
+    M(eoprot_tag_mc_joint_config,                                  eOmc_joint_t, config) \
+    M(eoprot_tag_mc_joint_config_pidposition,                      eOmc_joint_t, config.pidposition) \
+    M(eoprot_tag_mc_joint_config_pidvelocity,                      eOmc_joint_t, config.pidvelocity) \
+    M(eoprot_tag_mc_joint_config_pidtorque,                        eOmc_joint_t, config.pidtorque) \
+    M(eoprot_tag_mc_joint_config_userlimits,                       eOmc_joint_t, config.userlimits) \
+    M(eoprot_tag_mc_joint_config_impedance,                        eOmc_joint_t, config.impedance) \
+    M(eoprot_tag_mc_joint_config_motor_params,                     eOmc_joint_t, config.motor_params) \
+    M(eoprot_tag_mc_joint_config_tcfiltertype,                     eOmc_joint_t, config.tcfiltertype) \
+    M(eoprot_tag_mc_joint_status,                                  eOmc_joint_t, status) \
+    M(eoprot_tag_mc_joint_status_core,                             eOmc_joint_t, status.core) \
+    M(eoprot_tag_mc_joint_status_target,                           eOmc_joint_t, status.target) \
+    M(eoprot_tag_mc_joint_status_core_modes_controlmodestatus,     eOmc_joint_t, status.core.modes.controlmodestatus) \
+    M(eoprot_tag_mc_joint_status_core_modes_interactionmodestatus, eOmc_joint_t, status.core.modes.interactionmodestatus) \
+    M(eoprot_tag_mc_joint_status_core_modes_ismotiondone,          eOmc_joint_t, status.core.modes.ismotiondone) \
+    M(eoprot_tag_mc_joint_status_addinfo_multienc,                 eOmc_joint_t, status.addinfo.multienc) \
+    M(eoprot_tag_mc_joint_inputs,                                  eOmc_joint_t, inputs) \
+    M(eoprot_tag_mc_joint_inputs_externallymeasuredtorque,         eOmc_joint_t, inputs.externallymeasuredtorque) \
+    M(eoprot_tag_mc_joint_cmmnds_calibration,                      eOmc_joint_t, cmmnds.calibration) \
+    M(eoprot_tag_mc_joint_cmmnds_setpoint,                         eOmc_joint_t, cmmnds.setpoint) \
+    M(eoprot_tag_mc_joint_cmmnds_stoptrajectory,                   eOmc_joint_t, cmmnds.stoptrajectory) \
+    M(eoprot_tag_mc_joint_cmmnds_controlmode,                      eOmc_joint_t, cmmnds.controlmode) \
+    M(eoprot_tag_mc_joint_cmmnds_interactionmode,                  eOmc_joint_t, cmmnds.interactionmode)
+
+#define EOPROT_ROMMAP_MC_MOTOR(W, M) \
+    W(eoprot_tag_mc_motor_wholeitem,               eOmc_motor_t) \
+    M(eoprot_tag_mc_motor_config,                  eOmc_motor_t, config) \
+    M(eoprot_tag_mc_motor_config_currentlimits,    eOmc_motor_t, config.currentLimits) \
+    M(eoprot_tag_mc_motor_config_gearboxratio,     eOmc_motor_t, config.gearbox_M2J) \
+    M(eoprot_tag_mc_motor_config_rotorencoder,     eOmc_motor_t, config.rotorEncoderResolution) \
+    M(eoprot_tag_mc_motor_config_pwmlimit,         eOmc_motor_t, config.pwmLimit) \
+    M(eoprot_tag_mc_motor_config_temperaturelimit, eOmc_motor_t, config.temperatureLimit) \
+    M(eoprot_tag_mc_motor_status,                  eOmc_motor_t, status) \
+    M(eoprot_tag_mc_motor_status_basic,            eOmc_motor_t, status.basic)
+
+#define EOPROT_ROMMAP_MC_CONTROLLER(W, M) \
+    W(eoprot_tag_mc_controller_wholeitem, eOmc_controller_t) \
+    M(eoprot_tag_mc_controller_config,    eOmc_controller_t, config) \
+    M(eoprot_tag_mc_controller_status,    eOmc_controller_t, status)
+
+
+// - analog sensors
+
+#define EOPROT_ROMMAP_AS_STRAIN(W, M) \
+    W(eoprot_tag_as_strain_wholeitem,                 eOas_strain_t) \
+    M(eoprot_tag_as_strain_config,                    eOas_strain_t, config) \
+    M(eoprot_tag_as_strain_status,                    eOas_strain_t, status) \
+    M(eoprot_tag_as_strain_status_fullscale,          eOas_strain_t, status.fullscale) \
+    M(eoprot_tag_as_strain_status_calibratedvalues,   eOas_strain_t, status.calibratedvalues) \
+    M(eoprot_tag_as_strain_status_uncalibratedvalues, eOas_strain_t, status.uncalibratedvalues)
+
+#define EOPROT_ROMMAP_AS_MAIS(W, M) \
+    W(eoprot_tag_as_mais_wholeitem,          eOas_mais_t) \
+    M(eoprot_tag_as_mais_config,             eOas_mais_t, config) \
+    M(eoprot_tag_as_mais_config_mode,        eOas_mais_t, config.mode) \
+    M(eoprot_tag_as_mais_config_datarate,    eOas_mais_t, config.datarate) \
+    M(eoprot_tag_as_mais_config_resolution,  eOas_mais_t, config.resolution) \
+    M(eoprot_tag_as_mais_status,             eOas_mais_t, status) \
+    M(eoprot_tag_as_mais_status_the15values, eOas_mais_t, status.the15values)
+
+#define EOPROT_ROMMAP_AS_TEMPERATURE(W, M) \
+    W(eoprot_tag_as_temperature_wholeitem,     eOas_temperature_t) \
+    M(eoprot_tag_as_temperature_config,        eOas_temperature_t, config) \
+    M(eoprot_tag_as_temperature_status,        eOas_temperature_t, status) \
+    M(eoprot_tag_as_temperature_cmmnds_enable, eOas_temperature_t, cmmnds.enable)
+
+#define EOPROT_ROMMAP_AS_INERTIAL(W, M) \
+    W(eoprot_tag_as_inertial_wholeitem,       eOas_inertial_t) \
+    M(eoprot_tag_as_inertial_config,          eOas_inertial_t, config) \
+    M(eoprot_tag_as_inertial_config_datarate, eOas_inertial_t, config.datarate) \
+    M(eoprot_tag_as_inertial_config_enabled,  eOas_inertial_t, config.enabled) \
+    M(eoprot_tag_as_inertial_status,          eOas_inertial_t, status) \
+    M(eoprot_tag_as_inertial_cmmnds_enable,   eOas_inertial_t, cmmnds.enable)
+
+#define EOPROT_ROMMAP_AS_INERTIAL3(W, M) \
+    W(eoprot_tag_as_inertial3_wholeitem,     eOas_inertial3_t) \
+    M(eoprot_tag_as_inertial3_config,        eOas_inertial3_t, config) \
+    M(eoprot_tag_as_inertial3_status,        eOas_inertial3_t, status) \
+    M(eoprot_tag_as_inertial3_cmmnds_enable, eOas_inertial3_t, cmmnds.enable)
+
+
+// - skin
+
+#define EOPROT_ROMMAP_SK_SKIN(W, M) \
+    W(eoprot_tag_sk_skin_wholeitem,             eOsk_skin_t) \
+    M(eoprot_tag_sk_skin_config_sigmode,        eOsk_skin_t, config.sigmode) \
+    M(eoprot_tag_sk_skin_status_arrayofcandata, eOsk_skin_t, status.arrayofcandata) \
+    M(eoprot_tag_sk_skin_cmmnds_boardscfg,      eOsk_skin_t, cmmnds.boardscfg) \
+    M(eoprot_tag_sk_skin_cmmnds_trianglescfg,   eOsk_skin_t, cmmnds.trianglescfg)
+
+
+// - declaration of public user-defined types ------------------------------------------------------------------------- 
+// empty-section
+
+    
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+// empty-section
+
+
+/** @}            
+    end of group eo_EoProtocolROMmap  
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+ 
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2026 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  iCub Facility
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPROTOCOLROMMAP_HPP_
+#define _EOPROTOCOLROMMAP_HPP_
+
+
+/** @file       EoProtocolROMmap.hpp
+    @brief      This header file gives to C++ host code the id arithmetic of the protocol as constexpr functions.
+    @author     iCub Facility
+    @date       10/16/2026
+**/
+
+/** @defgroup eo_EoProtocolROMmap_hpp Constexpr id arithmetic of the protocol 
+    The tables are built by the compiler from the lists in EoProtocolROMmap.h, thus they are the same used by the eoprot 
+    library. The functions do not need any initialisation of the eoprot library and can be used also inside constant 
+    expressions, for instance to decode a ROP w/out any table walk:
+    
+        constexpr uint16_t off = eoprot::rommap::offset(id32);   // offset of the variable inside its entity
+        constexpr uint16_t siz = eoprot::rommap::size(id32);     // its size in bytes
+        
+    What depends on the board (the progressive number and the offset inside the ram of the endpoint) needs the 
+    multiplicity of each entity, which is the numberofentities[] of the eOprot_EPcfg_t of the endpoint.
+    It requires C++14.
+    
+    @{        
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoProtocolROMmap.h"
+
+#if !defined(__cplusplus) || (__cplusplus < 201402L)
+    #error EoProtocolROMmap.hpp requires C++14
+#endif
+
+
+namespace eoprot { namespace rommap {
+
+
+// - declaration of public user-defined types ------------------------------------------------------------------------- 
+
+struct variable_t
+{
+    uint8_t     tag;
+    uint16_t    offset;     // offset of the variable inside its entity
+    uint16_t    size;       // size of the variable
+};
+
+struct entity_t
+{
+    const variable_t*   variables;
+    uint8_t             tagsnumberof;
+};
+
+enum : uint16_t { invalid = EOK_uint16dummy };
+
+
+// - the tables. dont use them directly but with the functions -------------------------------------------------------
+
+#define EOPROT_ROMMAP_HPP_VARIABLE_W(tag, type)             { tag, 0, sizeof(type) },
+#define EOPROT_ROMMAP_HPP_VARIABLE_M(tag, type, member)     { tag, offsetof(type, member), sizeof(((type*)0)->member) },
+
+constexpr bool tags_are_in_order(const variable_t *variables, uint8_t number)
+{
+    for(uint8_t t=0; t<number; t++)
+    {
+        if(t != variables[t].tag)
+        {
+            return(false);
+        }
+    }
+    return(true);
+}
+
+constexpr variable_t mn_comm[] =
+{
+    EOPROT_ROMMAP_MN_COMM(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(mn_comm)/sizeof(variable_t) == eoprot_tags_mn_comm_numberof, "EOPROT_ROMMAP_MN_COMM() is not aligned w/ the tags");
+static_assert(tags_are_in_order(mn_comm, eoprot_tags_mn_comm_numberof), "EOPROT_ROMMAP_MN_COMM() is not in order of tag");
+
+constexpr variable_t mn_appl[] =
+{
+    EOPROT_ROMMAP_MN_APPL(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(mn_appl)/sizeof(variable_t) == eoprot_tags_mn_appl_numberof, "EOPROT_ROMMAP_MN_APPL() is not aligned w/ the tags");
+static_assert(tags_are_in_order(mn_appl, eoprot_tags_mn_appl_numberof), "EOPROT_ROMMAP_MN_APPL() is not in order of tag");
+
+constexpr variable_t mn_info[] =
+{
+    EOPROT_ROMMAP_MN_INFO(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(mn_info)/sizeof(variable_t) == eoprot_tags_mn_info_numberof, "EOPROT_ROMMAP_MN_INFO() is not aligned w/ the tags");
+static_assert(tags_are_in_order(mn_info, eoprot_tags_mn_info_numberof), "EOPROT_ROMMAP_MN_INFO() is not in order of tag");
+
+constexpr variable_t mn_service[] =
+{
+    EOPROT_ROMMAP_MN_SERVICE(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(mn_service)/sizeof(variable_t) == eoprot_tags_mn_service_numberof, "EOPROT_ROMMAP_MN_SERVICE() is not aligned w/ the tags");
+static_assert(tags_are_in_order(mn_service, eoprot_tags_mn_service_numberof), "EOPROT_ROMMAP_MN_SERVICE() is not in order of tag");
+
+constexpr entity_t mn[] =
+{
+    { mn_comm, eoprot_tags_mn_comm_numberof },
+    { mn_appl, eoprot_tags_mn_appl_numberof },
+    { mn_info, eoprot_tags_mn_info_numberof },
+    { mn_service, eoprot_tags_mn_service_numberof }
+};
+static_assert(sizeof(mn)/sizeof(entity_t) == eoprot_entities_mn_numberof, "the entities of the management endpoint are not all in here");
+
+constexpr variable_t mc_joint[] =
+{
+    EOPROT_ROMMAP_MC_JOINT(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(mc_joint)/sizeof(variable_t) == eoprot_tags_mc_joint_numberof, "EOPROT_ROMMAP_MC_JOINT() is not aligned w/ the tags");
+static_assert(tags_are_in_order(mc_joint, eoprot_tags_mc_joint_numberof), "EOPROT_ROMMAP_MC_JOINT() is not in order of tag");
+
+constexpr variable_t mc_motor[] =
+{
+    EOPROT_ROMMAP_MC_MOTOR(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(mc_motor)/sizeof(variable_t) == eoprot_tags_mc_motor_numberof, "EOPROT_ROMMAP_MC_MOTOR() is not aligned w/ the tags");
+static_assert(tags_are_in_order(mc_motor, eoprot_tags_mc_motor_numberof), "EOPROT_ROMMAP_MC_MOTOR() is not in order of tag");
+
+constexpr variable_t mc_controller[] =
+{
+    EOPROT_ROMMAP_MC_CONTROLLER(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(mc_controller)/sizeof(variable_t) == eoprot_tags_mc_controller_numberof, "EOPROT_ROMMAP_MC_CONTROLLER() is not aligned w/ the tags");
+static_assert(tags_are_in_order(mc_controller, eoprot_tags_mc_controller_numberof), "EOPROT_ROMMAP_MC_CONTROLLER() is not in order of tag");
+
+constexpr entity_t mc[] =
+{
+    { mc_joint, eoprot_tags_mc_joint_numberof },
+    { mc_motor, eoprot_tags_mc_motor_numberof },
+    { mc_controller, eoprot_tags_mc_controller_numberof }
+};
+static_assert(sizeof(mc)/sizeof(entity_t) == eoprot_entities_mc_numberof, "the entities of the motioncontrol endpoint are not all in here");
+
+constexpr variable_t as_strain[] =
+{
+    EOPROT_ROMMAP_AS_STRAIN(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(as_strain)/sizeof(variable_t) == eoprot_tags_as_strain_numberof, "EOPROT_ROMMAP_AS_STRAIN() is not aligned w/ the tags");
+static_assert(tags_are_in_order(as_strain, eoprot_tags_as_strain_numberof), "EOPROT_ROMMAP_AS_STRAIN() is not in order of tag");
+
+constexpr variable_t as_mais[] =
+{
+    EOPROT_ROMMAP_AS_MAIS(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(as_mais)/sizeof(variable_t) == eoprot_tags_as_mais_numberof, "EOPROT_ROMMAP_AS_MAIS() is not aligned w/ the tags");
+static_assert(tags_are_in_order(as_mais, eoprot_tags_as_mais_numberof), "EOPROT_ROMMAP_AS_MAIS() is not in order of tag");
+
+constexpr variable_t as_temperature[] =
+{
+    EOPROT_ROMMAP_AS_TEMPERATURE(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(as_temperature)/sizeof(variable_t) == eoprot_tags_as_temperature_numberof, "EOPROT_ROMMAP_AS_TEMPERATURE() is not aligned w/ the tags");
+static_assert(tags_are_in_order(as_temperature, eoprot_tags_as_temperature_numberof), "EOPROT_ROMMAP_AS_TEMPERATURE() is not in order of tag");
+
+constexpr variable_t as_inertial[] =
+{
+    EOPROT_ROMMAP_AS_INERTIAL(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(as_inertial)/sizeof(variable_t) == eoprot_tags_as_inertial_numberof, "EOPROT_ROMMAP_AS_INERTIAL() is not aligned w/ the tags");
+static_assert(tags_are_in_order(as_inertial, eoprot_tags_as_inertial_numberof), "EOPROT_ROMMAP_AS_INERTIAL() is not in order of tag");
+
+constexpr variable_t as_inertial3[] =
+{
+    EOPROT_ROMMAP_AS_INERTIAL3(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(as_inertial3)/sizeof(variable_t) == eoprot_tags_as_inertial3_numberof, "EOPROT_ROMMAP_AS_INERTIAL3() is not aligned w/ the tags");
+static_assert(tags_are_in_order(as_inertial3, eoprot_tags_as_inertial3_numberof), "EOPROT_ROMMAP_AS_INERTIAL3() is not in order of tag");
+
+constexpr entity_t as[] =
+{
+    { as_strain, eoprot_tags_as_strain_numberof },
+    { as_mais, eoprot_tags_as_mais_numberof },
+    { as_temperature, eoprot_tags_as_temperature_numberof },
+    { as_inertial, eoprot_tags_as_inertial_numberof },
+    { as_inertial3, eoprot_tags_as_inertial3_numberof }
+};
+static_assert(sizeof(as)/sizeof(entity_t) == eoprot_entities_as_numberof, "the entities of the analogsensors endpoint are not all in here");
+
+constexpr variable_t sk_skin[] =
+{
+    EOPROT_ROMMAP_SK_SKIN(EOPROT_ROMMAP_HPP_VARIABLE_W, EOPROT_ROMMAP_HPP_VARIABLE_M)
+};
+static_assert(sizeof(sk_skin)/sizeof(variable_t) == eoprot_tags_sk_skin_numberof, "EOPROT_ROMMAP_SK_SKIN() is not aligned w/ the tags");
+static_assert(tags_are_in_order(sk_skin, eoprot_tags_sk_skin_numberof), "EOPROT_ROMMAP_SK_SKIN() is not in order of tag");
+
+constexpr entity_t sk[] =
+{
+    { sk_skin, eoprot_tags_sk_skin_numberof }
+};
+static_assert(sizeof(sk)/sizeof(entity_t) == eoprot_entities_sk_numberof, "the entities of the skin endpoint are not all in here");
+
+constexpr const entity_t* endpoints[] = { mn, mc, as, sk };
+constexpr uint8_t entitiesnumberof[] = { eoprot_entities_mn_numberof, eoprot_entities_mc_numberof, eoprot_entities_as_numberof, eoprot_entities_sk_numberof };
+static_assert(sizeof(endpoints)/sizeof(endpoints[0]) == eoprot_endpoints_numberof, "the endpoints are not all in here");
+
+#undef EOPROT_ROMMAP_HPP_VARIABLE_W
+#undef EOPROT_ROMMAP_HPP_VARIABLE_M
+
+
+// - declaration of public functions ----------------------------------------------------------------------------------
+
+// the fields of the id32 as in eoprot_ID2endpoint() etc.
+constexpr uint8_t endpoint(uint32_t id32)   { return(static_cast<uint8_t>((id32 >> 24) & 0xff)); }
+constexpr uint8_t entity(uint32_t id32)     { return(static_cast<uint8_t>((id32 >> 16) & 0xff)); }
+constexpr uint8_t index(uint32_t id32)      { return(static_cast<uint8_t>((id32 >> 8) & 0xff)); }
+constexpr uint8_t tag(uint32_t id32)        { return(static_cast<uint8_t>(id32 & 0xff)); }
+
+// it tells if endpoint, entity and tag exist in the protocol. the index depends on the board, thus it is not verified.
+constexpr bool isvalid(uint32_t id32)
+{
+    return( (endpoint(id32) < eoprot_endpoints_numberof) && 
+            (entity(id32) < entitiesnumberof[endpoint(id32)]) && 
+            (tag(id32) < endpoints[endpoint(id32)][entity(id32)].tagsnumberof) );
+}
+
+// the offset of the variable inside its entity, or invalid
+constexpr uint16_t offset(uint32_t id32)
+{
+    return(isvalid(id32) ? endpoints[endpoint(id32)][entity(id32)].variables[tag(id32)].offset : static_cast<uint16_t>(invalid));
+}
+
+// the size of the variable, or invalid
+constexpr uint16_t size(uint32_t id32)
+{
+    return(isvalid(id32) ? endpoints[endpoint(id32)][entity(id32)].variables[tag(id32)].size : static_cast<uint16_t>(invalid));
+}
+
+// the size of an entity
+constexpr uint16_t entitysize(uint8_t ep, uint8_t ent)
+{
+    return(((ep < eoprot_endpoints_numberof) && (ent < entitiesnumberof[ep])) ? endpoints[ep][ent].variables[0].size : static_cast<uint16_t>(invalid));
+}
+
+// the progressive number of the variable inside its endpoint as eoprot_endpoint_id2prognum(), or invalid. 
+// numberofentities[] is the multiplicity of each entity in the endpoint of the board (see eOprot_EPcfg_t).
+constexpr uint16_t prognum(uint32_t id32, const uint8_t *numberofentities)
+{
+    uint16_t prog = 0;
+    
+    if((false == isvalid(id32)) || (index(id32) >= numberofentities[entity(id32)]))
+    {
+        return(invalid);
+    }
+    
+    for(uint8_t i=0; i<entity(id32); i++)
+    {
+        prog += endpoints[endpoint(id32)][i].tagsnumberof * numberofentities[i];
+    }
+    
+    return(prog + index(id32)*endpoints[endpoint(id32)][entity(id32)].tagsnumberof + tag(id32));
+}
+
+// the offset of the variable inside the ram of its endpoint as eoprot_variable_ramof_get() does, or invalid.
+constexpr uint16_t ramoffset(uint32_t id32, const uint8_t *numberofentities)
+{
+    uint16_t off = 0;
+    
+    if((false == isvalid(id32)) || (index(id32) >= numberofentities[entity(id32)]))
+    {
+        return(invalid);
+    }
+    
+    for(uint8_t i=0; i<entity(id32); i++)
+    {
+        off += entitysize(endpoint(id32), i) * numberofentities[i];
+    }
+    
+    return(off + index(id32)*entitysize(endpoint(id32), entity(id32)) + offset(id32));
+}
+
+
+} } // namespace eoprot::rommap
+
+
+/** @}            
+    end of group eo_EoProtocolROMmap_hpp  
+ **/
+ 
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
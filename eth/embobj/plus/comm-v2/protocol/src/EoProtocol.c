@@ -57,6 +57,26 @@
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
 
+#if     defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
+// the remote boards are reserved under a spinlock, whereas s_eoprot_board_data_get() never locks: a board is published only 
+// after its data is zeroed and it is never moved or released. with compilers other than gcc, clang or msvc the boards must
+// be reserved by a single thread.
+#if defined(__GNUC__) || defined(__clang__)
+    #define EOPROT_BOARDS_LOCK(l)                       while(__sync_lock_test_and_set((l), 1)) {}
+    #define EOPROT_BOARDS_UNLOCK(l)                     __sync_lock_release((l))
+    #define EOPROT_BOARDS_PUBLISH()                     __sync_synchronize()
+#elif defined(_MSC_VER)
+    #include <intrin.h>
+    #define EOPROT_BOARDS_LOCK(l)                       while(_InterlockedExchange((l), 1)) {}
+    #define EOPROT_BOARDS_UNLOCK(l)                     _InterlockedExchange((l), 0)
+    #define EOPROT_BOARDS_PUBLISH()                     _ReadWriteBarrier()
+#else
+    #define EOPROT_BOARDS_LOCK(l)                       
+    #define EOPROT_BOARDS_UNLOCK(l)                     
+    #define EOPROT_BOARDS_PUBLISH()                     
+#endif
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
@@ -67,6 +87,11 @@ typedef struct
     const uint8_t*      numberofeachentity[eoprot_endpoints_numberof];   
     void*               ramofeachendpoint[eoprot_endpoints_numberof];   
     eObool_fp_uint32_t  isvarproxied_fn[eoprot_endpoints_numberof];        
+    // computed by eoprot_config_endpoint_entities() so that the id arithmetic does not loop over the entities
+    uint16_t            entityprognum[eoprot_endpoints_numberof][eoprot_maxvalueof_entity+1];   // prognum of the first variable of each entity
+    uint16_t            entityramoffset[eoprot_endpoints_numberof][eoprot_maxvalueof_entity+1]; // offset in the ram of the endpoint of each entity
+    uint16_t            endpointsizeof[eoprot_endpoints_numberof];                              // the size of the ram of each endpoint
+    uint16_t            endpointnumberofvariables[eoprot_endpoints_numberof];                   // the number of variables of each endpoint
 } eOprot_board_data_t;
 
 
@@ -92,12 +117,28 @@ static eOresult_t s_eoprot_config_variable_callback(eOprotID32_t id, eOvoid_fp_c
 
 static eOprot_board_data_t* s_eoprot_board_data_get(eOprotBRD_t brd);
 
+static void s_eoprot_entities_offsets_compute(eOprot_board_data_t *data, uint8_t epi);
+
+static void s_eoprot_tags_withinit_compute(uint8_t epi);
+static void s_eoprot_tags_withinit_set(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag);
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
 static eOprotBRD_t s_eoprot_localboard = eo_prot_BRDdummy; // initted as 255. however, in runtime we assign a specific number to it.
 
+// bit (1 << tag) of s_eoprot_tags_withinit[epi][entity] is set if that variable has an init() callback. the row of an endpoint 
+// is valid only if bit (1 << epi) of s_eoprot_tags_withinit_computed is set.
+static uint64_t s_eoprot_tags_withinit[eoprot_endpoints_numberof][eoprot_maxvalueof_entity+1] = {{0}};
+static uint8_t s_eoprot_tags_withinit_computed = 0;
+
+#if     defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
+static volatile long s_eoprot_boards_lock = 0;
+#endif
+
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -108,8 +149,9 @@ static eOprotBRD_t s_eoprot_localboard = eo_prot_BRDdummy; // initted as 255. ho
 eOprot_board_data_t eoprot_loc_board_data = { NULL };
 
 #if     defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
-eOprot_board_data_t * eoprot_rem_board_data =  NULL ;
-uint8_t eoprot_rem_board_data_size = 0;
+// the data of the remote board brd is pointed by eoprot_rem_board_data[brd], which is NULL until the board is reserved
+eOprot_board_data_t * volatile eoprot_rem_board_data[eoprot_board_remotes_maxnumberof] = { NULL };
+uint8_t eoprot_rem_board_data_size = 0; // the highest reserved board + 1
 #else
 eOprot_board_data_t eoprot_rem_board_data[eoprot_board_remotes_maxnumberof] = { NULL };
 uint8_t eoprot_rem_board_data_size = eoprot_board_remotes_maxnumberof;
@@ -353,6 +395,41 @@ extern eObool_t eoprot_EPcfg_isvalid(eOprot_EPcfg_t *cfgofep)
     
     return(eobool_true);
 }
+
+
+extern uint16_t eoprot_EPcfg_sizeof_get(const eOprot_EPcfg_t *cfgofep)
+{
+    uint16_t size = 0;
+    uint8_t epi = 0;
+    uint8_t max = 0;
+    uint8_t i = 0;
+    
+    if(NULL == cfgofep)
+    {
+        return(0);
+    }
+    
+    if(cfgofep->endpoint >= eoprot_endpoints_numberof)
+    {
+        return(0);
+    }
+    
+    epi = eoprot_ep_ep2index(cfgofep->endpoint);
+    
+    // the same computation as in eoprot_endpoint_sizeof_get() but on the multiplicity inside cfgofep
+    max = eoprot_ep_entities_numberof[epi];
+    if(max > eoprot_maxvalueof_entity+1)
+    {
+        max = eoprot_maxvalueof_entity+1;
+    }
+    
+    for(i=0; i<max; i++)
+    {
+        size += eoprot_ep_entities_sizeof[epi][i] * cfgofep->numberofentities[i];
+    }
+    
+    return(size);
+}
     
 
 extern const eoprot_version_t * eoprot_version_of_endpoint_get(eOprotEndpoint_t ep)
@@ -376,62 +453,80 @@ extern eOresult_t eoprot_config_board_reserve(eOprotBRD_t brd)
         return(eores_OK);
     }
     
-#if     defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
-    
-    if(brd >= eoprot_board_remotes_maxnumberof)
+    return(eoprot_config_board_reserve_range(brd, 1));
+}
+
+
+extern eOresult_t eoprot_config_board_reserve_range(eOprotBRD_t first, uint8_t numberof)
+{
+    if((0 == numberof) || (((uint16_t)first + numberof) > eoprot_board_remotes_maxnumberof))
     {
         return(eores_NOK_generic);
     }
     
-    if(brd < eoprot_rem_board_data_size)
-    {   // already allocated
-        return(eores_OK);        
-    }
-    else
-    {   
-        // ok. just realloc   
-        uint8_t oldsize = eoprot_rem_board_data_size;
-        eOprot_board_data_t *p = (eOprot_board_data_t*)realloc(eoprot_rem_board_data, (brd+1)*sizeof(eOprot_board_data_t));  
-        if(NULL == p)
+#if     defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
+    {
+        eOprot_board_data_t *block = NULL;
+        uint16_t missing = 0;
+        uint16_t brd = 0;
+        
+        EOPROT_BOARDS_LOCK(&s_eoprot_boards_lock);
+        
+        for(brd=first; brd<(uint16_t)first+numberof; brd++)
+        {
+            if(NULL == eoprot_rem_board_data[brd])
+            {
+                missing++;
+            }
+        }
+        
+        if(0 == missing)
+        {   // already allocated
+            EOPROT_BOARDS_UNLOCK(&s_eoprot_boards_lock);
+            return(eores_OK); 
+        }
+        
+        // a single allocation for all the missing boards. it is zeroed, thus the boards have no endpoint yet
+        block = (eOprot_board_data_t*)calloc(missing, sizeof(eOprot_board_data_t));  
+        if(NULL == block)
         {
+            EOPROT_BOARDS_UNLOCK(&s_eoprot_boards_lock);
             return(eores_NOK_generic);
         }
-        // if we can reallocate ...
-        eoprot_rem_board_data_size = (brd+1);
-        eoprot_rem_board_data = p;        
-        memset(&eoprot_rem_board_data[oldsize], 0, (eoprot_rem_board_data_size-oldsize)*sizeof(eOprot_board_data_t));          
-        return(eores_OK);
+        
+        // the zeroed data must be visible before the pointers
+        EOPROT_BOARDS_PUBLISH();
+        
+        for(brd=first; brd<(uint16_t)first+numberof; brd++)
+        {
+            if(NULL == eoprot_rem_board_data[brd])
+            {
+                eoprot_rem_board_data[brd] = block++;
+            }
+        }
+        
+        if(((uint16_t)first + numberof) > eoprot_rem_board_data_size)
+        {
+            eoprot_rem_board_data_size = first + numberof;
+        }
+        
+        EOPROT_BOARDS_UNLOCK(&s_eoprot_boards_lock);
     }
-    
-#else
+#endif
 
-    if(brd >= eoprot_board_remotes_maxnumberof)
-    {
-        return(eores_NOK_generic);
-    }
     return(eores_OK);
-    
-#endif       
 }
 
+
 extern eOresult_t eoprot_config_board_numberof(uint8_t numofboards)
 {   
-    return(eoprot_config_board_reserve(numofboards-1)); 
+    return(eoprot_config_board_reserve_range(0, numofboards)); 
 }
 
+
 extern eObool_t eoprot_board_can_be_managed(eOprotBRD_t brd)
 {
-    if(eoprot_board_localboard == brd)
-    {
-        return(eobool_true);
-    }    
-
-    if(brd >= eoprot_rem_board_data_size)
-    {
-        return(eobool_false);
-    }  
- 
-    return(eobool_true);    
+    return((NULL != s_eoprot_board_data_get(brd)) ? (eobool_true) : (eobool_false));    
 }
 
 extern eOresult_t eoprot_config_board_local(eOprotBRD_t brd)
@@ -459,6 +554,8 @@ extern eOresult_t eoprot_config_endpoint_entities(eOprotBRD_t brd, eOprotEndpoin
     epi = eoprot_ep_ep2index(ep);
             
     data->numberofeachentity[epi] = numberofentities;    
+    
+    s_eoprot_entities_offsets_compute(data, epi);
         
     return(res);
 }
@@ -971,7 +1068,6 @@ extern uint16_t eoprot_endpoint_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep)
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
     uint16_t size = 0;
     uint8_t epi = 0;
-    uint8_t i;
     
     if(NULL == data)
     {
@@ -990,11 +1086,8 @@ extern uint16_t eoprot_endpoint_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep)
         return(0);
     }
     
-    
-    for(i=0; i<eoprot_ep_entities_numberof[epi]; i++)
-    {
-        size += eoprot_ep_entities_sizeof[epi][i] * data->numberofeachentity[epi][i];
-    }
+    // computed by eoprot_config_endpoint_entities()
+    size = data->endpointsizeof[epi];
     
     return(size);
 }
@@ -1258,6 +1351,31 @@ extern uint8_t eoprot_entity_numberof_get(eOprotBRD_t brd, eOprotEndpoint_t ep,
 }
 
 
+extern uint64_t eoprot_entity_tags_withinit_get(eOprotEndpoint_t ep, eOprotEntity_t entity)
+{
+    uint8_t epi = 0;
+    
+    if(ep >= eoprot_endpoints_numberof)
+    {
+        return(0);
+    }
+    
+    epi = eoprot_ep_ep2index(ep);
+    
+    if((entity >= eoprot_ep_entities_numberof[epi]) || (entity > eoprot_maxvalueof_entity))
+    {
+        return(0);
+    }
+    
+    if(0 == (s_eoprot_tags_withinit_computed & (1 << epi)))
+    {
+        s_eoprot_tags_withinit_compute(epi);
+    }
+    
+    return(s_eoprot_tags_withinit[epi][entity]);
+}
+
+
 extern eObool_t eoprot_id_isvalid(eOprotBRD_t brd, eOprotID32_t id)
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
@@ -1358,7 +1476,6 @@ extern eOprotProgNumber_t eoprot_endpoint_id2prognum(eOprotBRD_t brd, eOprotID32
     uint8_t epi = 0;
     eOprotEntity_t entity = eoprot_ID2entity(id);
     eOprotIndex_t  index  = eoprot_ID2index(id);
-    uint8_t i;
     eOprotEndpoint_t ep;
 
     if(NULL == data)
@@ -1386,10 +1503,8 @@ extern eOprotProgNumber_t eoprot_endpoint_id2prognum(eOprotBRD_t brd, eOprotID32
         return(EOK_uint32dummy);
     }
     
-    for(i=0; i<entity; i++)
-    {   // we add all the tags in the entities below
-        prog += (eoprot_ep_tags_numberof[epi][i] * data->numberofeachentity[epi][i]);
-    }
+    // all the tags in the entities below are already summed
+    prog = data->entityprognum[epi][entity];
     // then we add only the tags of the entities equal to the current one + the progressive number of the tag
     prog += (index*eoprot_ep_tags_numberof[epi][entity] + s_eoprot_rom_get_prognum(id));
 
@@ -1442,7 +1557,6 @@ static uint16_t s_eoprot_endpoint_numberofvariables_get(eOprotBRD_t brd, eOprotE
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
     uint16_t num = 0;
     uint8_t epi = 0;
-    uint8_t i = 0;
 
     if(NULL == data)
     {
@@ -1461,12 +1575,9 @@ static uint16_t s_eoprot_endpoint_numberofvariables_get(eOprotBRD_t brd, eOprotE
         return(0);
     }
     
-    for(i=0; i<eoprot_ep_entities_numberof[epi]; i++)
-    {   
-        // simply the sum for each entity of the number of tags multiplied the number of each entity. 
-        // it also works if an entity is not present in the board
-        num += (eoprot_ep_tags_numberof[epi][i] * data->numberofeachentity[epi][i]);
-    }
+    // the sum for each entity of the number of tags multiplied the number of each entity. it is computed by 
+    // eoprot_config_endpoint_entities()
+    num = data->endpointnumberofvariables[epi];
 
     return(num);
 }
@@ -1475,7 +1586,6 @@ static uint16_t s_eoprot_brdentityindex2ramoffset(eOprotBRD_t brd, uint8_t epi,
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
     uint16_t offset = 0;
-    uint8_t i = 0;
     
     if(NULL == data)
     {
@@ -1497,10 +1607,8 @@ static uint16_t s_eoprot_brdentityindex2ramoffset(eOprotBRD_t brd, uint8_t epi,
         return(EOK_uint16dummy);
     }
         
-    for(i=0; i<entity; i++)
-    {   // we sum the size of all the entities before the current one
-        offset += (data->numberofeachentity[epi][i] * eoprot_ep_entities_sizeof[epi][i]);
-    }
+    // the size of all the entities before the current one is already summed
+    offset = data->entityramoffset[epi][entity];
     // then we add the offset of the current entity
     offset += (index*eoprot_ep_entities_sizeof[epi][entity]);
 
@@ -1540,25 +1648,9 @@ static eObool_t s_eoprot_entity_tag_is_valid(uint8_t epi, eOprotEntity_t entity,
 // returns the offset of the variable with a given tag from the start of the entity
 static uint16_t s_eoprot_rom_entity_offset_of_tag(uint8_t epi, uint8_t ent, eOprotTag_t tag)
 {
-    uint32_t i, tag_aux = 0;
-    uint8_t *one = NULL;
-    uint8_t *two = NULL;
-    int res = 0;
-
-    tag_aux = 0;
-    for(i=0; i<ent; i++)
-    {
-        tag_aux += eoprot_ep_tags_numberof[epi][i];
-    }
-    // one contains the address of the default value of the entire entity (eg: &MYdefentity = 0x08001200).
-    one = (uint8_t*) eoprot_ep_entities_defval[epi][ent];
-    // two contains the address of the default value of the variable, but inside the default value of the entire entity (eg: &MYdefentity.var = 0x08001220)  
-    two = (uint8_t*) eoprot_ep_descriptors[epi][ent][tag]->resetval;
-    // if we want to know how many bytes they are fare aways we simply cast them to pointers of 1 byte and make the difference.
-    // the C standard assures that the result is an integer containing the distance between the pointers expressed in object pointed. in our case 1 byte.
-    res = two - one;
-    // and now we cast result to 16 bits because we dont have big entities.
-    return((uint16_t)res); 
+    // the offsets are computed by the compiler from the lists in EoProtocolROMmap.h. they are the same as the distance of 
+    // eoprot_ep_descriptors[epi][ent][tag]->resetval from eoprot_ep_entities_defval[epi][ent]
+    return(eoprot_ep_tags_offset[epi][ent][tag]); 
 }
 
 static uint16_t s_eoprot_rom_get_offset(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag)
@@ -1633,6 +1725,7 @@ static eOresult_t s_eoprot_config_variable_callback(eOprotID32_t id, eOvoid_fp_c
     if(NULL != init)
     {
         nvrom->init = init;
+        s_eoprot_tags_withinit_set(eoprot_ep_ep2index(eoprot_ID2endpoint(id)), eoprot_ID2entity(id), eoprot_ID2tag(id));
     }
     
     if(NULL != update)
@@ -1648,6 +1741,75 @@ static eOresult_t s_eoprot_config_variable_callback(eOprotID32_t id, eOvoid_fp_c
 
 
 
+static void s_eoprot_entities_offsets_compute(eOprot_board_data_t *data, uint8_t epi)
+{
+    uint16_t prog = 0;
+    uint16_t offset = 0;
+    uint8_t i = 0;
+    
+    for(i=0; i<=eoprot_maxvalueof_entity; i++)
+    {
+        data->entityprognum[epi][i] = prog;
+        data->entityramoffset[epi][i] = offset;
+        
+        if((NULL != data->numberofeachentity[epi]) && (i < eoprot_ep_entities_numberof[epi]))
+        {
+            prog += (eoprot_ep_tags_numberof[epi][i] * data->numberofeachentity[epi][i]);
+            offset += (data->numberofeachentity[epi][i] * eoprot_ep_entities_sizeof[epi][i]);
+        }
+    }
+    
+    // after the last entity we have the totals of the endpoint
+    data->endpointnumberofvariables[epi] = prog;
+    data->endpointsizeof[epi] = offset;
+}
+
+
+static void s_eoprot_tags_withinit_compute(uint8_t epi)
+{
+    uint8_t ent = 0;
+    uint8_t tag = 0;
+    uint8_t maxent = eoprot_ep_entities_numberof[epi];
+    uint64_t withinit = 0;
+    
+    if(maxent > eoprot_maxvalueof_entity+1)
+    {
+        maxent = eoprot_maxvalueof_entity+1;
+    }
+    
+    // a row only gains bits: another caller which computes the same endpoint at the same time or a concurrent 
+    // s_eoprot_tags_withinit_set() cannot make it lose any
+    for(ent=0; ent<maxent; ent++)
+    {
+        withinit = 0;
+        for(tag=0; tag<eoprot_ep_tags_numberof[epi][ent]; tag++)
+        {
+            const EOnv_rom_t* rom = eoprot_ep_descriptors[epi][ent][tag];
+            if((NULL != rom) && (NULL != rom->init))
+            {
+                withinit |= (tag < 64) ? (((uint64_t)1) << tag) : (~((uint64_t)0));
+            }
+        }
+        s_eoprot_tags_withinit[epi][ent] |= withinit;
+    }
+    
+    // it is done once per endpoint and only now the rows are valid. later changes come through s_eoprot_tags_withinit_set()
+    s_eoprot_tags_withinit_computed |= (1 << epi);
+}
+
+
+static void s_eoprot_tags_withinit_set(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag)
+{
+    if((epi >= eoprot_endpoints_numberof) || (entity > eoprot_maxvalueof_entity))
+    {
+        return;
+    }
+    
+    // if the row is not computed yet, the scan of the rom will find the callback anyway
+    s_eoprot_tags_withinit[epi][entity] |= (tag < 64) ? (((uint64_t)1) << tag) : (~((uint64_t)0));
+}
+
+
 static eOprot_board_data_t* s_eoprot_board_data_get(eOprotBRD_t brd)
 {
     if(eoprot_board_localboard == brd)
@@ -1660,7 +1822,12 @@ static eOprot_board_data_t* s_eoprot_board_data_get(eOprotBRD_t brd)
     } 
     else
     {
-        return(&eoprot_rem_board_data[brd]);        
+#if     defined(EOPROT_CFG_REMOTE_BOARDS_USE_DYNAMIC_MODE)
+        // NULL if the board is not reserved
+        return(eoprot_rem_board_data[brd]);
+#else
+        return(&eoprot_rem_board_data[brd]);
+#endif        
     }    
 }
 
@@ -36,6 +36,7 @@
 //#include "EOconstvector_hid.h"
 
 #include "EoProtocolAS.h"
+#include "EoProtocolROMmap.h"
 #include "EoAnalogSensors.h"
 
 
@@ -625,6 +626,43 @@ const void* const eoprot_as_rom_entities_defval[] =
 };  EO_VERIFYsizeof(eoprot_as_rom_entities_defval, eoprot_entities_as_numberof*sizeof(const void*)) 
 
 
+// the offset of each variable inside its entity. the compiler computes them from the lists in EoProtocolROMmap.h
+
+static const uint16_t s_eoprot_as_rom_strain_tags_offset[] =
+{
+    EOPROT_ROMMAP_AS_STRAIN(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_strain_tags_offset, eoprot_tags_as_strain_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_mais_tags_offset[] =
+{
+    EOPROT_ROMMAP_AS_MAIS(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_mais_tags_offset, eoprot_tags_as_mais_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_temperature_tags_offset[] =
+{
+    EOPROT_ROMMAP_AS_TEMPERATURE(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_temperature_tags_offset, eoprot_tags_as_temperature_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_inertial_tags_offset[] =
+{
+    EOPROT_ROMMAP_AS_INERTIAL(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_inertial_tags_offset, eoprot_tags_as_inertial_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_as_rom_inertial3_tags_offset[] =
+{
+    EOPROT_ROMMAP_AS_INERTIAL3(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_inertial3_tags_offset, eoprot_tags_as_inertial3_numberof*sizeof(uint16_t))
+
+const uint16_t* const eoprot_as_rom_tags_offset[] = 
+{
+    s_eoprot_as_rom_strain_tags_offset,
+    s_eoprot_as_rom_mais_tags_offset,
+    s_eoprot_as_rom_temperature_tags_offset,
+    s_eoprot_as_rom_inertial_tags_offset,
+    s_eoprot_as_rom_inertial3_tags_offset
+};  EO_VERIFYsizeof(eoprot_as_rom_tags_offset, eoprot_entities_as_numberof*sizeof(const uint16_t*))
+
+
 // the strings of the endpoint
 
 const char * const eoprot_as_strings_entity[] =
@@ -68,6 +68,7 @@ extern const uint8_t eoprot_ep_entities_numberof[];                 // eoprot_en
 extern const uint16_t* const eoprot_ep_entities_sizeof[];           // eoprot_endpoints_numberof
 extern const void** const eoprot_ep_entities_defval[];              // eoprot_endpoints_numberof
 extern const uint8_t* const eoprot_ep_tags_numberof[];              // eoprot_endpoints_numberof
+extern const uint16_t* const * const eoprot_ep_tags_offset[];       // eoprot_endpoints_numberof
 extern const char * const eoprot_strings_endpoint[];                // eoprot_endpoints_numberof
 extern const char ** const eoprot_strings_entity[];                 // eoprot_endpoints_numberof
 extern const char *** const eoprot_strings_tag[];                   // eoprot_endpoints_numberof
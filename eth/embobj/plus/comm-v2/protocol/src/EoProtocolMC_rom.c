@@ -36,6 +36,7 @@
 //#include "EOconstvector_hid.h"
 
 #include "EoProtocolMC.h"
+#include "EoProtocolROMmap.h"
 #include "EoMotionControl.h"
 
 
@@ -752,6 +753,31 @@ const void* const eoprot_mc_rom_entities_defval[] =
 };  EO_VERIFYsizeof(eoprot_mc_rom_entities_defval, eoprot_entities_mc_numberof*sizeof(const void*)) 
 
 
+// the offset of each variable inside its entity. the compiler computes them from the lists in EoProtocolROMmap.h
+
+static const uint16_t s_eoprot_mc_rom_joint_tags_offset[] =
+{
+    EOPROT_ROMMAP_MC_JOINT(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_joint_tags_offset, eoprot_tags_mc_joint_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mc_rom_motor_tags_offset[] =
+{
+    EOPROT_ROMMAP_MC_MOTOR(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_motor_tags_offset, eoprot_tags_mc_motor_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mc_rom_controller_tags_offset[] =
+{
+    EOPROT_ROMMAP_MC_CONTROLLER(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_controller_tags_offset, eoprot_tags_mc_controller_numberof*sizeof(uint16_t))
+
+const uint16_t* const eoprot_mc_rom_tags_offset[] = 
+{
+    s_eoprot_mc_rom_joint_tags_offset,
+    s_eoprot_mc_rom_motor_tags_offset,
+    s_eoprot_mc_rom_controller_tags_offset
+};  EO_VERIFYsizeof(eoprot_mc_rom_tags_offset, eoprot_entities_mc_numberof*sizeof(const uint16_t*))
+
+
 // the strings of the endpoint
 
 const char * const eoprot_mc_strings_entity[] =
@@ -36,6 +36,7 @@
 //#include "EOconstvector_hid.h"
 
 #include "EoProtocolMN.h"
+#include "EoProtocolROMmap.h"
 #include "EoMotionControl.h"
 
 
@@ -529,6 +530,37 @@ const void* const eoprot_mn_rom_entities_defval[] =
 };  EO_VERIFYsizeof(eoprot_mn_rom_entities_defval, eoprot_entities_mn_numberof*sizeof(const void*)) 
 
 
+// the offset of each variable inside its entity. the compiler computes them from the lists in EoProtocolROMmap.h
+
+static const uint16_t s_eoprot_mn_rom_comm_tags_offset[] =
+{
+    EOPROT_ROMMAP_MN_COMM(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_comm_tags_offset, eoprot_tags_mn_comm_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mn_rom_appl_tags_offset[] =
+{
+    EOPROT_ROMMAP_MN_APPL(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_appl_tags_offset, eoprot_tags_mn_appl_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mn_rom_info_tags_offset[] =
+{
+    EOPROT_ROMMAP_MN_INFO(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_info_tags_offset, eoprot_tags_mn_info_numberof*sizeof(uint16_t))
+
+static const uint16_t s_eoprot_mn_rom_service_tags_offset[] =
+{
+    EOPROT_ROMMAP_MN_SERVICE(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_service_tags_offset, eoprot_tags_mn_service_numberof*sizeof(uint16_t))
+
+const uint16_t* const eoprot_mn_rom_tags_offset[] = 
+{
+    s_eoprot_mn_rom_comm_tags_offset,
+    s_eoprot_mn_rom_appl_tags_offset,
+    s_eoprot_mn_rom_info_tags_offset,
+    s_eoprot_mn_rom_service_tags_offset
+};  EO_VERIFYsizeof(eoprot_mn_rom_tags_offset, eoprot_entities_mn_numberof*sizeof(const uint16_t*))
+
+
 // the strings of the endpoint
 
 const char * const eoprot_mn_strings_entity[] =
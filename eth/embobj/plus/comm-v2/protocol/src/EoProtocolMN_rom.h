@@ -63,6 +63,7 @@ extern EOPROT_ROMmap EOnv_rom_t * const * const eoprot_mn_rom_descriptors[];
 extern const uint8_t eoprot_mn_rom_tags_numberof[];                         // size: eoprot_entities_mn_numberof
 extern const uint16_t eoprot_mn_rom_entities_sizeof[];                      // size: eoprot_entities_mn_numberof  
 extern const void* const eoprot_mn_rom_entities_defval[];                   // size: eoprot_entities_mn_numberof
+extern const uint16_t* const eoprot_mn_rom_tags_offset[];                   // size: eoprot_entities_mn_numberof
 extern const char * const eoprot_mn_strings_entity[];                       // size: eoprot_entities_mn_numberof
 extern const char ** const eoprot_mn_strings_tags[];                        // size: eoprot_entities_mn_numberof
 
@@ -36,6 +36,7 @@
 //#include "EOconstvector_hid.h"
 
 #include "EoProtocolSK.h"
+#include "EoProtocolROMmap.h"
 #include "EoMotionControl.h"
 
 
@@ -217,6 +218,19 @@ const void* const eoprot_sk_rom_entities_defval[] =
     (const void*)&eoprot_sk_rom_skin_defaultvalue
 };  EO_VERIFYsizeof(eoprot_sk_rom_entities_defval, eoprot_entities_sk_numberof*sizeof(const void*)) 
 
+
+// the offset of each variable inside its entity. the compiler computes them from the lists in EoProtocolROMmap.h
+
+static const uint16_t s_eoprot_sk_rom_skin_tags_offset[] =
+{
+    EOPROT_ROMMAP_SK_SKIN(EOPROT_ROMMAP_OFFSETOF_W, EOPROT_ROMMAP_OFFSETOF_M)
+};  EO_VERIFYsizeof(s_eoprot_sk_rom_skin_tags_offset, eoprot_tags_sk_skin_numberof*sizeof(uint16_t))
+
+const uint16_t* const eoprot_sk_rom_tags_offset[] = 
+{
+    s_eoprot_sk_rom_skin_tags_offset
+};  EO_VERIFYsizeof(eoprot_sk_rom_tags_offset, eoprot_entities_sk_numberof*sizeof(const uint16_t*))
+
 // the strings of the endpoint
 
 const char * const eoprot_sk_strings_entity[] =
@@ -28,6 +28,8 @@
 #include "EOtheErrorManager.h"
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
+#include "EOnvSet_hid.h"
+
 
 #include "EOVtheSystem.h"
 
@@ -70,8 +72,8 @@
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
 
-static eOresult_t s_eo_agent_rop_process(EOrop *p, EOrop *replyrop, EOproxy* proxy);
-static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o);
+static eOresult_t s_eo_agent_rop_process(EOrop *p, EOrop *replyrop, EOproxy* proxy, EOnvSet* nvset);
+static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o, EOnvSet* nvset);
 
 static EOrop * s_eo_agent_rop_prepare_reply(EOrop *ropin, EOrop *ropout);
 static eObool_t s_eo_agent_rop_cannot_manage(EOrop *ropin);
@@ -225,7 +227,7 @@ extern eOresult_t eo_agent_InpROPprocess(EOagent *p, EOrop *ropin, eOipv4addr_t
         
         // process the rop even if the netvar is not found (res is not eores_OK)
         // because we may need to send back a nack. 
-        s_eo_agent_rop_process(ropin, replyrop, p->config.proxy);
+        s_eo_agent_rop_process(ropin, replyrop, p->config.proxy, p->config.nvset);
 
         return(eores_OK);
     }
@@ -324,7 +326,7 @@ extern eOresult_t eo_agent_OutROPprepare(EOagent* p, EOnv* nv, eOropdescriptor_t
 // --------------------------------------------------------------------------------------------------------------------
 
 
-static eOresult_t s_eo_agent_rop_process(EOrop *p, EOrop *replyrop, EOproxy* proxy) 
+static eOresult_t s_eo_agent_rop_process(EOrop *p, EOrop *replyrop, EOproxy* proxy, EOnvSet* nvset) 
 {
     EOrop *rop_o = NULL;
     EOnv *thenv = &p->netvar;
@@ -356,7 +358,7 @@ static eOresult_t s_eo_agent_rop_process(EOrop *p, EOrop *replyrop, EOproxy* pro
     }
     else
     {   
-        s_eo_agent_rop_exec(p, rop_o);
+        s_eo_agent_rop_exec(p, rop_o, nvset);
     }
 
 
@@ -364,7 +366,7 @@ static eOresult_t s_eo_agent_rop_process(EOrop *p, EOrop *replyrop, EOproxy* pro
 }
 
 
-static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o)
+static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o, EOnvSet* nvset)
 {
     eOresult_t res = eores_NOK_generic;
     const uint8_t *source = NULL;
@@ -401,7 +403,7 @@ static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o)
             {   // set
                 
                 // get the data to be set and its size.
-                source = rop_in->stream.data;
+                source = theropdes->data;   // it is rop_in->stream.data or points inside the received ropframe if parsed w/ zerocopy
                 if(rop_in->stream.head.dsiz == thenv->rom->capacity)
                 {
                     res = eo_nv_hid_SetROP(thenv, source, eo_nv_upd_ifneeded, theropdes);
@@ -457,9 +459,12 @@ static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o)
     
 
             // force write also if an input, force update.
-            source = rop_in->stream.data;
+            source = theropdes->data;   // it is rop_in->stream.data or points inside the received ropframe if parsed w/ zerocopy
             eo_nv_hid_remoteSetROP(thenv, source, eo_nv_upd_always, theropdes);
             
+            // the consumers of the change queue and of the snapshots of the nvset (if any) learn that the netvar has changed
+            eo_nvset_hid_NV_Changed(nvset, thenv->id32);
+            
             // if a say, then call the onsay() if not NULL
             if(eo_ropcode_say == rop_in->stream.head.ropc)
             {
@@ -24,6 +24,8 @@
 #include "EoCommon.h"
 #include "string.h"
 #include "EOtheMemoryPool.h"
+#include "EOVtheSystem.h"
+
 
 
 
@@ -56,6 +58,9 @@
     #define eov_mutex_Release(a)
 #endif
 
+// eo_confman_Status_Wait() checks the status of the rop at least as often as that
+#define EOCONFMAN_WAIT_STEP     EOK_reltime1ms
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
 // --------------------------------------------------------------------------------------------------------------------
@@ -75,6 +80,24 @@
 
 static void s_eo_confman_default_rop_conf_requested(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
 static void s_eo_confman_default_rop_conf_received(eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
+static void s_eo_confman_default_rop_conf_timeout(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
+
+static eOconfman_tracker_t * s_eo_confman_tracker_new(const eOconfman_cfg_t *cfg);
+static void s_eo_confman_tracker_delete(eOconfman_tracker_t *t);
+static uint32_t s_eo_confman_signature(const eOropdescriptor_t *ropdes);
+static eOconfman_inflight_t * s_eo_confman_inflight_find(eOconfman_tracker_t *t, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature);
+static eOresult_t s_eo_confman_inflight_insert(EOconfirmationManager *p, eOropdescriptor_t* ropdesc, eOconfman_queue_t queue);
+static void s_eo_confman_inflight_release(eOconfman_tracker_t *t, eOconfman_inflight_t *item);
+static void s_eo_confman_inflight_arm(EOconfirmationManager *p, eOipv4addr_t toipaddr);
+static void s_eo_confman_inflight_complete(EOconfirmationManager *p, eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
+static uint16_t s_eo_confman_table_bucket(eOconfman_tracker_t *t, eOnvID32_t id32, uint32_t signature);
+static void s_eo_confman_table_add(eOconfman_tracker_t *t, uint16_t index);
+static void s_eo_confman_table_remove(eOconfman_tracker_t *t, uint16_t index);
+static void s_eo_confman_heap_push(eOconfman_tracker_t *t, uint16_t index);
+static void s_eo_confman_heap_remove(eOconfman_tracker_t *t, uint16_t position);
+static void s_eo_confman_heap_set(eOconfman_tracker_t *t, uint16_t position, uint16_t index);
+static eObool_t s_eo_confman_heap_less(eOconfman_tracker_t *t, uint16_t pos0, uint16_t pos1);
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -89,7 +112,13 @@ const eOconfman_cfg_t eOconfman_cfg_default =
     EO_INIT(.maxnumberofconfreqrops)        16,
     EO_INIT(.mutex_fn_new)                  NULL,
     EO_INIT(.on_rop_conf_requested)         s_eo_confman_default_rop_conf_requested, 
-    EO_INIT(.on_rop_conf_received)          s_eo_confman_default_rop_conf_received
+    EO_INIT(.on_rop_conf_received)          s_eo_confman_default_rop_conf_received,
+    EO_INIT(.maxnumberofinflight)           0,
+    EO_INIT(.maxsizeofropdata)              32,
+    EO_INIT(.timeout)                       EOK_reltime100ms,
+    EO_INIT(.maxretransmissions)            3,
+    EO_INIT(.on_rop_conf_timeout)           s_eo_confman_default_rop_conf_timeout,
+    EO_INIT(.wait_fn)                       NULL
 };
 
 
@@ -123,6 +152,8 @@ extern EOconfirmationManager* eo_confman_New(const eOconfman_cfg_t *cfg)
 
     retptr->mtx = (NULL == cfg->mutex_fn_new) ? (NULL) : (cfg->mutex_fn_new());
     
+    retptr->tracker = (0 == cfg->maxnumberofinflight) ? (NULL) : (s_eo_confman_tracker_new(cfg));
+    
     return(retptr);
 }
 
@@ -143,6 +174,11 @@ extern void eo_confman_Delete(EOconfirmationManager *p)
     {
         eo_vector_Delete(p->confrequests);
     }
+    
+    if(NULL != p->tracker)
+    {
+        s_eo_confman_tracker_delete(p->tracker);
+    }
    
     memset(p, 0, sizeof(EOconfirmationManager));
     eo_mempool_Delete(eo_mempool_GetHandle(), p);
@@ -171,6 +207,12 @@ extern eOresult_t eo_confman_ConfirmationRequests_Process(EOconfirmationManager
         eo_vector_Clear(p->confrequests);   // remove the conf requests
     }
     
+    // the rops loaded so far are now inside a packet: they start to wait for their ack/nak
+    if(NULL != p->tracker)
+    {
+        s_eo_confman_inflight_arm(p, toipaddr);
+    }
+    
     eov_mutex_Release(p->mtx);
     
     return(eores_OK);    
@@ -179,33 +221,7 @@ extern eOresult_t eo_confman_ConfirmationRequests_Process(EOconfirmationManager
 
 extern eOresult_t eo_confman_ConfirmationRequest_Insert(EOconfirmationManager *p, eOropdescriptor_t* ropdesc)
 {   
-    if((NULL == p) || (NULL == ropdesc))
-    {
-        return(eores_NOK_generic);  
-    }
-    
-    // if conf request is flagged on
-    if(1 == ropdesc->control.rqstconf)
-    {
-        if(NULL != p->confrequests)
-        { 
-            eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
-            
-            if(eobool_false == eo_vector_Full(p->confrequests))
-            {
-                eo_vector_PushBack(p->confrequests, ropdesc);
-            }
-            else
-            {
-                eov_mutex_Release(p->mtx);
-                return(eores_NOK_generic); 
-            }
-            
-            eov_mutex_Release(p->mtx);
-        }        
-    }
-    
-    return(eores_OK);
+    return(eo_confman_hid_ConfirmationRequest_Queue(p, ropdesc, eoconfman_queue_occasionals));
 }
 
 
@@ -243,6 +259,13 @@ extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOi
 
     if(eo_ropconf_none != confinfo)
     {
+        if(NULL != p->tracker)
+        {
+            eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+            s_eo_confman_inflight_complete(p, fromipaddr, ropdes);
+            eov_mutex_Release(p->mtx);
+        }
+        
         // received a confirmation ack/nak: execute the callback
         if(NULL != p->config.on_rop_conf_received)
         {
@@ -256,11 +279,285 @@ extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOi
 }
 
 
+extern eOresult_t eo_confman_Status_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature, eOconfman_status_t *status)
+{
+    eOconfman_inflight_t *item = NULL;
+    
+    if((NULL == p) || (NULL == status))
+    {
+        return(eores_NOK_nullpointer);  
+    }
+    
+    *status = eoconfman_status_none;
+    
+    if(NULL == p->tracker)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    
+    item = s_eo_confman_inflight_find(p->tracker, ipaddr, id32, signature);
+    
+    if(NULL != item)
+    {
+        *status = (eOconfman_status_t)item->status;
+        
+        // a completed rop is given back only once
+        if(eoconfman_inflight_done == item->state)
+        {
+            s_eo_confman_inflight_release(p->tracker, item);
+        }
+    }
+    
+    eov_mutex_Release(p->mtx);
+    
+    return((NULL == item) ? (eores_NOK_generic) : (eores_OK));
+}
+
+
+extern eOresult_t eo_confman_Status_Wait(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature, eOreltime_t timeout, eOconfman_status_t *status)
+{
+    eOresult_t res = eores_NOK_generic;
+    eOabstime_t start = 0;
+    eOabstime_t elapsed = 0;
+    eOreltime_t remaining = 0;
+    
+    if((NULL == p) || (NULL == status))
+    {
+        return(eores_NOK_nullpointer);  
+    }
+    
+    start = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    
+    for(;;)
+    {
+        res = eo_confman_Status_Get(p, ipaddr, id32, signature, status);
+        
+        if((eores_OK != res) || (eoconfman_status_pending != *status))
+        {
+            return(res);
+        }
+        
+        elapsed = eov_sys_LifeTimeGet(eov_sys_GetHandle()) - start;
+        
+        if((NULL == p->config.wait_fn) || (elapsed >= timeout))
+        {
+            return(eores_NOK_timeout);
+        }
+        
+        // the transmitter and the receiver of another thread move the rop on
+        remaining = timeout - (eOreltime_t)elapsed;
+        p->config.wait_fn((remaining < EOCONFMAN_WAIT_STEP) ? (remaining) : (EOCONFMAN_WAIT_STEP));
+    }
+}
+
+
+extern uint16_t eo_confman_Pending_Numberof(EOconfirmationManager *p)
+{
+    uint16_t n = 0;
+    
+    if((NULL == p) || (NULL == p->tracker))
+    {
+        return(0);  
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    n = p->tracker->numberofpending;
+    eov_mutex_Release(p->mtx);
+    
+    return(n);
+}
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+
+extern eObool_t eo_confman_hid_ConfirmationRequest_HasRoom(EOconfirmationManager *p, const eOropdescriptor_t* ropdesc)
+{
+    eObool_t room = eobool_true;
+    
+    if((NULL == p) || (NULL == ropdesc) || (1 != ropdesc->control.rqstconf))
+    {
+        return(eobool_true);  
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    
+    if((NULL != p->confrequests) && (eobool_true == eo_vector_Full(p->confrequests)))
+    {
+        room = eobool_false;
+    }
+    else if((NULL != p->tracker) && (eo_ropcode_ask != ropdesc->ropcode) && (p->tracker->numberofpending == p->tracker->capacity) &&
+            (NULL == s_eo_confman_inflight_find(p->tracker, 0, ropdesc->id32, s_eo_confman_signature(ropdesc))))
+    {   // the same rules of s_eo_confman_inflight_insert(): a free item or else a completed one
+        room = eobool_false;
+    }
+    
+    eov_mutex_Release(p->mtx);
+    
+    return(room);
+}
+
+
+extern eOresult_t eo_confman_hid_Retransmission_Get(EOconfirmationManager *p, eOropdescriptor_t* ropdes)
+{
+    eOconfman_tracker_t *t = NULL;
+    eOconfman_inflight_t *item = NULL;
+    eOabstime_t now = 0;
+    eOipv4addr_t ipaddr = 0;
+    
+    if((NULL == p) || (NULL == p->tracker) || (NULL == ropdes))
+    {
+        return(eores_NOK_generic);  
+    }
+    
+    t = p->tracker;
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    
+    now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    
+    // the root of the heap has the earliest deadline
+    while((t->heapsize > 0) && (t->items[t->heap[0]].deadline <= now))
+    {
+        item = &t->items[t->heap[0]];
+        s_eo_confman_heap_remove(t, 0);
+        
+        // we give out a copy of the rop, so that it can be used after we have released the mutex
+        memcpy(ropdes, &item->ropdes, sizeof(eOropdescriptor_t));
+        if(NULL != item->ropdes.data)
+        {
+            memcpy(t->retxdata, item->ropdes.data, item->ropdes.size);
+            ropdes->data = t->retxdata;
+        }
+        
+        if((eobool_true == item->retransmittable) && (item->retransmissions < p->config.maxretransmissions))
+        {   // it waits for the transmitter to load it again. the retransmission is counted only then: see 
+            // s_eo_confman_inflight_insert(). if the transmitter cannot, see eo_confman_hid_Retransmission_Failed()
+            item->state = eoconfman_inflight_expired;
+            
+            eov_mutex_Release(p->mtx);
+            return(eores_OK);
+        }
+        
+        item->state = eoconfman_inflight_done;
+        item->status = eoconfman_status_timedout;
+        t->numberofpending --;
+        ipaddr = item->ipaddr;
+        
+        // the callback of the user runs w/out the mutex: it may well call the confirmation manager or the transmitter
+        if(NULL != p->config.on_rop_conf_timeout)
+        {
+            eov_mutex_Release(p->mtx);
+            p->config.on_rop_conf_timeout(ipaddr, ropdes);
+            eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+        }
+    }
+    
+    eov_mutex_Release(p->mtx);
+    
+    return(eores_NOK_generic);
+}
+
+
+extern void eo_confman_hid_Retransmission_Failed(EOconfirmationManager *p, const eOropdescriptor_t* ropdes)
+{
+    eOconfman_tracker_t *t = NULL;
+    eOconfman_inflight_t *item = NULL;
+    
+    if((NULL == p) || (NULL == p->tracker) || (NULL == ropdes))
+    {
+        return;  
+    }
+    
+    t = p->tracker;
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    
+    item = s_eo_confman_inflight_find(t, 0, ropdes->id32, s_eo_confman_signature(ropdes));
+    
+    // meanwhile its ack/nak may have arrived
+    if((NULL != item) && (eoconfman_inflight_expired == item->state))
+    {
+        item->state = eoconfman_inflight_pending;
+        item->deadline = eov_sys_LifeTimeGet(eov_sys_GetHandle()) + p->config.timeout;
+        s_eo_confman_heap_push(t, (uint16_t)(item - t->items));
+    }
+    
+    eov_mutex_Release(p->mtx);
+}
+
+
+extern eOresult_t eo_confman_hid_ConfirmationRequest_Queue(EOconfirmationManager *p, eOropdescriptor_t* ropdesc, eOconfman_queue_t queue)
+{
+    eOresult_t res = eores_OK;
+    
+    if((NULL == p) || (NULL == ropdesc))
+    {
+        return(eores_NOK_generic);  
+    }
+    
+    // if conf request is flagged on
+    if(1 == ropdesc->control.rqstconf)
+    {
+        eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+        
+        if(NULL != p->confrequests)
+        { 
+            if(eobool_false == eo_vector_Full(p->confrequests))
+            {
+                eo_vector_PushBack(p->confrequests, ropdesc);
+            }
+            else
+            {
+                res = eores_NOK_generic; 
+            }
+        }
+        
+        // the ask<> is not tracked because its confirmation is the say<> and not a ack/nak
+        if((eores_OK == res) && (NULL != p->tracker) && (eo_ropcode_ask != ropdesc->ropcode))
+        {
+            res = s_eo_confman_inflight_insert(p, ropdesc, queue);
+        }
+        
+        eov_mutex_Release(p->mtx);
+    }
+    
+    return(res);
+}
+
+
+extern void eo_confman_hid_ConfirmationRequests_Sent(EOconfirmationManager *p, eOconfman_queue_t queue)
+{
+    eOconfman_tracker_t *t = NULL;
+    uint16_t i = 0;
+    
+    if((NULL == p) || (NULL == p->tracker))
+    {
+        return;  
+    }
+    
+    t = p->tracker;
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    
+    for(i=0; (i<t->capacity) && (0 != t->numberofqueued[queue]); i++)
+    {
+        if((eoconfman_inflight_queued == t->items[i].state) && (queue == t->items[i].queue))
+        {
+            t->items[i].state = eoconfman_inflight_sent;
+            t->numberofqueued[queue] --;
+            t->numberofsent ++;
+        }
+    }
+    
+    eov_mutex_Release(p->mtx);
+}
+
 
 
 
@@ -279,6 +576,399 @@ static void s_eo_confman_default_rop_conf_received(eOipv4addr_t fromipaddr, eOro
     // do nothing
 }
 
+static void s_eo_confman_default_rop_conf_timeout(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes)
+{
+    // do nothing
+}
+
+
+static eOconfman_tracker_t * s_eo_confman_tracker_new(const eOconfman_cfg_t *cfg)
+{
+    eOconfman_tracker_t *t = NULL;
+    uint16_t i = 0;
+    uint32_t numberofbuckets = 1;
+    uint8_t *datapool = NULL;
+    
+    t = (eOconfman_tracker_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOconfman_tracker_t), 1);
+    t->capacity = cfg->maxnumberofinflight;
+    t->items = (eOconfman_inflight_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOconfman_inflight_t), t->capacity);
+    t->heap = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), t->capacity);
+    t->heapsize = 0;
+    t->numberofpending = 0;
+    t->numberofqueued[eoconfman_queue_occasionals] = 0;
+    t->numberofqueued[eoconfman_queue_replies] = 0;
+    t->numberofsent = 0;
+    t->retxdata = NULL;
+    
+    // as many buckets as items, rounded up to a power of two
+    while(numberofbuckets < t->capacity)
+    {
+        numberofbuckets <<= 1;
+    }
+    t->mask = (uint16_t)(numberofbuckets - 1);
+    t->buckets = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), numberofbuckets);
+    memset(t->buckets, 0xff, numberofbuckets*sizeof(uint16_t));
+    
+    if(0 != cfg->maxsizeofropdata)
+    {
+        t->retxdata = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->maxsizeofropdata, 1);
+        datapool = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->maxsizeofropdata, t->capacity);
+    }
+    
+    for(i=0; i<t->capacity; i++)
+    {
+        t->items[i].state = eoconfman_inflight_free;
+        t->items[i].data = (NULL == datapool) ? (NULL) : (&datapool[i*cfg->maxsizeofropdata]);
+        t->items[i].next = ((i+1) == t->capacity) ? (EOK_uint16dummy) : (i+1);
+    }
+    t->freelist = 0;
+    
+    return(t);
+}
+
+
+static void s_eo_confman_tracker_delete(eOconfman_tracker_t *t)
+{
+    if(NULL != t->retxdata)
+    {   // the data of the items is a single block which starts with the data of item 0
+        eo_mempool_Delete(eo_mempool_GetHandle(), t->items[0].data);
+        eo_mempool_Delete(eo_mempool_GetHandle(), t->retxdata);
+    }
+    
+    eo_mempool_Delete(eo_mempool_GetHandle(), t->buckets);
+    eo_mempool_Delete(eo_mempool_GetHandle(), t->heap);
+    eo_mempool_Delete(eo_mempool_GetHandle(), t->items);
+    
+    memset(t, 0, sizeof(eOconfman_tracker_t));
+    eo_mempool_Delete(eo_mempool_GetHandle(), t);
+}
+
+
+// the ack/nak has the signature of the rop only if the rop has it
+static uint32_t s_eo_confman_signature(const eOropdescriptor_t *ropdes)
+{
+    return((1 == ropdes->control.plussign) ? (ropdes->signature) : (EOK_uint32dummy));
+}
+
+
+// the address of a rop is known only after it is sent, so a queued rop (address 0) matches any address. 
+// the same for a search with address 0. 
+static eOconfman_inflight_t * s_eo_confman_inflight_find(eOconfman_tracker_t *t, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature)
+{
+    uint16_t i = t->buckets[s_eo_confman_table_bucket(t, id32, signature)];
+    eOconfman_inflight_t *item = NULL;
+    
+    for(; EOK_uint16dummy != i; i = item->next)
+    {
+        item = &t->items[i];
+        
+        if((id32 != item->ropdes.id32) || (signature != s_eo_confman_signature(&item->ropdes)))
+        {
+            continue;
+        }
+        
+        if((0 == ipaddr) || (0 == item->ipaddr) || (ipaddr == item->ipaddr))
+        {
+            return(item);
+        }
+    }
+    
+    return(NULL);
+}
+
+
+static eOresult_t s_eo_confman_inflight_insert(EOconfirmationManager *p, eOropdescriptor_t* ropdesc, eOconfman_queue_t queue)
+{
+    eOconfman_tracker_t *t = p->tracker;
+    eOconfman_inflight_t *item = NULL;
+    uint16_t i = 0;
+    
+    item = s_eo_confman_inflight_find(t, 0, ropdesc->id32, s_eo_confman_signature(ropdesc));
+    
+    if(NULL == item)
+    {   // a free item or else a completed one which nobody has retrieved
+        if(EOK_uint16dummy != t->freelist)
+        {
+            item = &t->items[t->freelist];
+            t->freelist = item->next;
+        }
+        else
+        {
+            for(i=0; i<t->capacity; i++)
+            {
+                if(eoconfman_inflight_done == t->items[i].state)
+                {
+                    item = &t->items[i];
+                    s_eo_confman_table_remove(t, i);
+                    break;
+                }
+            }
+        }
+        
+        if(NULL == item)
+        {
+            return(eores_NOK_generic);
+        }
+        
+        item->state = eoconfman_inflight_free;
+        memcpy(&item->ropdes, ropdesc, sizeof(eOropdescriptor_t));
+        s_eo_confman_table_add(t, (uint16_t)(item - t->items));
+    }
+    
+    switch(item->state)
+    {
+        case eoconfman_inflight_pending:
+        {   // sent again before its ack/nak: it waits for a new deadline
+            s_eo_confman_heap_remove(t, item->heapindex);
+        } break;
+        
+        case eoconfman_inflight_queued:
+        {
+            t->numberofqueued[item->queue] --;
+        } break;
+        
+        case eoconfman_inflight_sent:
+        {
+            t->numberofsent --;
+        } break;
+        
+        case eoconfman_inflight_expired:
+        {   // the transmitter has loaded the rop given back by eo_confman_hid_Retransmission_Get(): only now it counts
+            item->retransmissions ++;
+        } break;
+        
+        default:
+        {   // a new rop or a completed one sent again
+            item->retransmissions = 0;
+            item->status = eoconfman_status_pending;
+            t->numberofpending ++;
+        } break;
+    }
+    
+    item->state = eoconfman_inflight_queued;
+    item->queue = (uint8_t)queue;
+    t->numberofqueued[queue] ++;
+    item->ipaddr = 0;
+    memcpy(&item->ropdes, ropdesc, sizeof(eOropdescriptor_t));
+    
+    // we keep a copy of the data because the caller may reuse it. if the data is NULL the rop takes the value of the netvar
+    item->retransmittable = eobool_true;
+    if(NULL != ropdesc->data)
+    {
+        if((NULL != item->data) && (ropdesc->size <= p->config.maxsizeofropdata))
+        {
+            memcpy(item->data, ropdesc->data, ropdesc->size);
+            item->ropdes.data = item->data;
+        }
+        else
+        {
+            item->ropdes.data = NULL;
+            item->retransmittable = eobool_false;
+        }
+    }
+    
+    return(eores_OK);
+}
+
+
+static void s_eo_confman_inflight_release(eOconfman_tracker_t *t, eOconfman_inflight_t *item)
+{
+    uint16_t index = (uint16_t)(item - t->items);
+    
+    s_eo_confman_table_remove(t, index);
+    item->state = eoconfman_inflight_free;
+    item->next = t->freelist;
+    t->freelist = index;
+}
+
+
+static void s_eo_confman_inflight_arm(EOconfirmationManager *p, eOipv4addr_t toipaddr)
+{
+    eOconfman_tracker_t *t = p->tracker;
+    eOabstime_t deadline = 0;
+    uint16_t i = 0;
+    
+    if(0 == t->numberofsent)
+    {   // no rops inside the packet
+        return;
+    }
+    
+    deadline = eov_sys_LifeTimeGet(eov_sys_GetHandle()) + p->config.timeout;
+    
+    for(i=0; (i<t->capacity) && (0 != t->numberofsent); i++)
+    {
+        if(eoconfman_inflight_sent == t->items[i].state)
+        {
+            t->items[i].state = eoconfman_inflight_pending;
+            t->items[i].ipaddr = toipaddr;
+            t->items[i].deadline = deadline;
+            s_eo_confman_heap_push(t, i);
+            t->numberofsent --;
+        }
+    }
+}
+
+
+static void s_eo_confman_inflight_complete(EOconfirmationManager *p, eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes)
+{
+    eOconfman_tracker_t *t = p->tracker;
+    eOconfman_inflight_t *item = NULL;
+    
+    item = s_eo_confman_inflight_find(t, fromipaddr, ropdes->id32, s_eo_confman_signature(ropdes));
+    
+    if((NULL == item) || (eoconfman_inflight_done == item->state))
+    {   // a late or duplicated ack/nak
+        return;
+    }
+    
+    switch(item->state)
+    {
+        case eoconfman_inflight_pending:
+        {
+            s_eo_confman_heap_remove(t, item->heapindex);
+        } break;
+        
+        case eoconfman_inflight_queued:
+        {
+            t->numberofqueued[item->queue] --;
+        } break;
+        
+        case eoconfman_inflight_sent:
+        {
+            t->numberofsent --;
+        } break;
+        
+        default:
+        {   // the expired one is not inside the heap
+        } break;
+    }
+    
+    item->state = eoconfman_inflight_done;
+    item->status = (eo_ropconf_ack == ropdes->control.confinfo) ? (eoconfman_status_acked) : (eoconfman_status_nacked);
+    t->numberofpending --;
+}
+
+
+static uint16_t s_eo_confman_table_bucket(eOconfman_tracker_t *t, eOnvID32_t id32, uint32_t signature)
+{   // the id32 of the same entity differ only in a few bits: we mix them before we take the bucket
+    uint32_t h = (id32 ^ (signature * 0x9E3779B1UL)) * 0x85EBCA6BUL;
+    return((uint16_t)((h ^ (h >> 16)) & t->mask));
+}
+
+
+static void s_eo_confman_table_add(eOconfman_tracker_t *t, uint16_t index)
+{
+    eOconfman_inflight_t *item = &t->items[index];
+    uint16_t bucket = s_eo_confman_table_bucket(t, item->ropdes.id32, s_eo_confman_signature(&item->ropdes));
+    
+    item->next = t->buckets[bucket];
+    t->buckets[bucket] = index;
+}
+
+
+static void s_eo_confman_table_remove(eOconfman_tracker_t *t, uint16_t index)
+{
+    eOconfman_inflight_t *item = &t->items[index];
+    uint16_t *link = &t->buckets[s_eo_confman_table_bucket(t, item->ropdes.id32, s_eo_confman_signature(&item->ropdes))];
+    
+    while((EOK_uint16dummy != *link) && (index != *link))
+    {
+        link = &t->items[*link].next;
+    }
+    
+    if(index == *link)
+    {
+        *link = item->next;
+    }
+}
+
+
+static void s_eo_confman_heap_push(eOconfman_tracker_t *t, uint16_t index)
+{
+    uint16_t pos = t->heapsize++;
+    uint16_t parent = 0;
+    
+    s_eo_confman_heap_set(t, pos, index);
+    
+    while(pos > 0)
+    {
+        parent = (pos - 1) / 2;
+        if(eobool_false == s_eo_confman_heap_less(t, pos, parent))
+        {
+            break;
+        }
+        index = t->heap[parent];
+        s_eo_confman_heap_set(t, parent, t->heap[pos]);
+        s_eo_confman_heap_set(t, pos, index);
+        pos = parent;
+    }
+}
+
+
+static void s_eo_confman_heap_remove(eOconfman_tracker_t *t, uint16_t position)
+{
+    uint16_t pos = position;
+    uint16_t child = 0;
+    uint16_t index = 0;
+    
+    t->heapsize --;
+    
+    if(pos == t->heapsize)
+    {
+        return;
+    }
+    
+    // the last one takes the place of the removed one and then moves down or up
+    s_eo_confman_heap_set(t, pos, t->heap[t->heapsize]);
+    
+    for(;;)
+    {
+        child = 2*pos + 1;
+        if(child >= t->heapsize)
+        {
+            break;
+        }
+        if(((child+1) < t->heapsize) && (eobool_true == s_eo_confman_heap_less(t, child+1, child)))
+        {
+            child ++;
+        }
+        if(eobool_false == s_eo_confman_heap_less(t, child, pos))
+        {
+            break;
+        }
+        index = t->heap[child];
+        s_eo_confman_heap_set(t, child, t->heap[pos]);
+        s_eo_confman_heap_set(t, pos, index);
+        pos = child;
+    }
+    
+    while(pos > 0)
+    {
+        child = pos;
+        pos = (child - 1) / 2;
+        if(eobool_false == s_eo_confman_heap_less(t, child, pos))
+        {
+            break;
+        }
+        index = t->heap[pos];
+        s_eo_confman_heap_set(t, pos, t->heap[child]);
+        s_eo_confman_heap_set(t, child, index);
+    }
+}
+
+
+static void s_eo_confman_heap_set(eOconfman_tracker_t *t, uint16_t position, uint16_t index)
+{
+    t->heap[position] = index;
+    t->items[index].heapindex = position;
+}
+
+
+static eObool_t s_eo_confman_heap_less(eOconfman_tracker_t *t, uint16_t pos0, uint16_t pos1)
+{
+    return((t->items[t->heap[pos0]].deadline < t->items[t->heap[pos1]].deadline) ? (eobool_true) : (eobool_false));
+}
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -67,6 +67,15 @@ typedef enum
     eoconfman_mode_enabled      = 1   
 } eOconfmanmode_t;
 
+typedef enum 
+{
+    eoconfman_status_none       = 0,    /**< the operation is not tracked (or its result was already retrieved) */
+    eoconfman_status_pending    = 1,    /**< the operation waits for its ack/nak */
+    eoconfman_status_acked      = 2,
+    eoconfman_status_nacked     = 3,
+    eoconfman_status_timedout   = 4     /**< no ack/nak has arrived even after all the retransmissions */
+} eOconfman_status_t;
+
 typedef struct
 {
     eOconfmanmode_t                     mode;
@@ -74,6 +83,12 @@ typedef struct
     eov_mutex_fn_mutexderived_new       mutex_fn_new;
     void (*on_rop_conf_requested)(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
     void (*on_rop_conf_received)(eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
+    uint16_t                            maxnumberofinflight;    // the outstanding confirmations which are tracked. 0 disables the tracking
+    uint16_t                            maxsizeofropdata;       // a rop with more data is tracked but never retransmitted
+    eOreltime_t                         timeout;                // the time allowed for an ack/nak before a retransmission
+    uint8_t                             maxretransmissions;
+    void (*on_rop_conf_timeout)(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
+    void (*wait_fn)(eOreltime_t tout);  // it suspends the caller of eo_confman_Status_Wait() for tout. NULL: it does not wait
 } eOconfman_cfg_t;
  
 
@@ -105,6 +120,49 @@ extern eOresult_t eo_confman_Confirmation_Requested(EOconfirmationManager *p, eO
 extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
 
 
+/** @fn         extern eOresult_t eo_confman_Status_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature, eOconfman_status_t *status)
+    @brief      Polls the completion of a rop sent with a confirmation request. The rop is identified by the remote address,
+                its id32 and its signature (use EOK_uint32dummy if the rop has no signature). Once a completed status
+                (acked, nacked or timedout) is retrieved, the rop is not tracked anymore. The tracking must be enabled with
+                a non-zero eOconfman_cfg_t::maxnumberofinflight. A set<>, rst<> or sig<> is tracked but not an ask<>, as 
+                its confirmation is the say<> itself. Timeouts and retransmissions are managed by the EOtransmitter 
+                each time it prepares a packet.
+    @param      p           The object.
+    @param      ipaddr      The address of the remote board.
+    @param      id32        The id32 of the rop.
+    @param      signature   The signature of the rop.
+    @param      status      Contains the status of the rop. eoconfman_status_none if it is not tracked.
+    @return     eores_OK if the rop is tracked, eores_NOK_generic if not, eores_NOK_nullpointer on NULL params.
+ **/
+extern eOresult_t eo_confman_Status_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature, eOconfman_status_t *status);
+
+
+/** @fn         extern eOresult_t eo_confman_Status_Wait(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature, eOreltime_t timeout, eOconfman_status_t *status)
+    @brief      As eo_confman_Status_Get() but it waits until the rop is completed or timeout has elapsed. Between one check 
+                and the next it calls eOconfman_cfg_t::wait_fn, hence another thread must keep on transmitting and 
+                receiving. If wait_fn is NULL it does not wait.
+    @param      p           The object.
+    @param      ipaddr      The address of the remote board.
+    @param      id32        The id32 of the rop.
+    @param      signature   The signature of the rop.
+    @param      timeout     The maximum time to wait.
+    @param      status      Contains the status of the rop. eoconfman_status_none if it is not tracked.
+    @return     eores_OK if the rop is completed, eores_NOK_timeout if it is still pending, eores_NOK_generic if it is
+                not tracked, eores_NOK_nullpointer on NULL params.
+ **/
+extern eOresult_t eo_confman_Status_Wait(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature, eOreltime_t timeout, eOconfman_status_t *status);
+
+
+/** @fn         extern uint16_t eo_confman_Pending_Numberof(EOconfirmationManager *p)
+    @brief      Tells how many of the tracked rops still wait for an ack/nak. A host can load the confirmed set<> of
+                many boards at once and then poll this function on each of them until it reaches zero.
+    @param      p           The object.
+    @return     The number of pending rops.
+ **/
+extern uint16_t eo_confman_Pending_Numberof(EOconfirmationManager *p);
+
+
+
 
 
 /** @}            
@@ -47,6 +47,61 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+typedef enum
+{
+    eoconfman_inflight_free     = 0,
+    eoconfman_inflight_queued   = 1,    // loaded in the transmitter but not yet inside a packet
+    eoconfman_inflight_sent     = 2,    // inside the packet being prepared: eo_confman_ConfirmationRequests_Process() arms it
+    eoconfman_inflight_pending  = 3,    // sent: it has a deadline inside the heap
+    eoconfman_inflight_expired  = 4,    // given back for retransmission but not yet loaded again
+    eoconfman_inflight_done     = 5     // acked, nacked or timed out: it waits for eo_confman_Status_Get()
+} eOconfman_inflightstate_t;
+
+
+// the ropframes of the transmitter which hold the rops w/ a confirmation request until they go inside a packet
+typedef enum
+{
+    eoconfman_queue_occasionals = 0,
+    eoconfman_queue_replies     = 1
+} eOconfman_queue_t;
+
+enum { eoconfman_queues_numberof = 2 };
+
+
+typedef struct
+{
+    eOropdescriptor_t               ropdes;             // its data points to data or is NULL
+    eOipv4addr_t                    ipaddr;
+    eOabstime_t                     deadline;
+    uint8_t*                        data;               // maxsizeofropdata bytes
+    uint8_t                         state;              // use eOconfman_inflightstate_t
+    uint8_t                         status;             // use eOconfman_status_t
+    uint8_t                         retransmissions;    // the ones which the transmitter has loaded
+    eObool_t                        retransmittable;
+    uint8_t                         queue;              // use eOconfman_queue_t
+    uint16_t                        heapindex;          // the position in the heap when it is pending
+    uint16_t                        next;               // the next item in the same bucket, or in the free list if free
+} eOconfman_inflight_t;
+
+
+// the rops sent with a confirmation request. the ones which are not free are found by id32 and signature in a hash 
+// table w/ a chain for each bucket, and the pending ones are kept inside a min-heap ordered by deadline
+typedef struct
+{
+    eOconfman_inflight_t*           items;
+    uint16_t*                       heap;
+    uint16_t*                       buckets;            // the first item of each bucket, EOK_uint16dummy if empty
+    uint16_t                        mask;               // the number of buckets minus one
+    uint16_t                        freelist;           // the first free item, EOK_uint16dummy if none
+    uint16_t                        heapsize;
+    uint16_t                        capacity;
+    uint16_t                        numberofpending;    // the ones which are neither free nor done
+    uint16_t                        numberofqueued[eoconfman_queues_numberof];
+    uint16_t                        numberofsent;
+    uint8_t*                        retxdata;           // the data of the rop given back by eo_confman_hid_Retransmission_Get() or timed out
+} eOconfman_tracker_t;
+
+
 
 
 /** @struct     EOconfirmationManager_hid
@@ -57,14 +112,38 @@ extern "C" {
  
 struct EOconfirmationManager_hid 
 {
-    eOconfman_cfg_t     config;
-    EOvector*           confrequests;
-    EOVmutexDerived*    mtx;
+    eOconfman_cfg_t         config;
+    EOvector*               confrequests;
+    EOVmutexDerived*        mtx;
+    eOconfman_tracker_t*    tracker;    // NULL if config.maxnumberofinflight is zero
 }; 
 
 
 // - declaration of extern hidden functions ---------------------------------------------------------------------------
 
+// the transmitter calls it before it prepares a packet. it times out the pending rops which have no retransmissions left 
+// and it gives back one expired rop at a time in ropdes, which must be loaded again as an occasional rop. its data 
+// stays valid until the next call. it returns eores_NOK_generic when there is nothing to retransmit.
+// the retransmission is counted only when the rop is inserted again. the on_rop_conf_timeout() callback is called 
+// w/out the internal mutex.
+extern eOresult_t eo_confman_hid_Retransmission_Get(EOconfirmationManager *p, eOropdescriptor_t* ropdes);
+
+// the transmitter calls it if it cannot load the rop given back by eo_confman_hid_Retransmission_Get(): the rop waits
+// for another timeout w/out counting a retransmission.
+extern void eo_confman_hid_Retransmission_Failed(EOconfirmationManager *p, const eOropdescriptor_t* ropdes);
+
+// as eo_confman_ConfirmationRequest_Insert() but for a rop loaded in the given queue of the transmitter, which must 
+// call it while it holds the mutex of that queue.
+extern eOresult_t eo_confman_hid_ConfirmationRequest_Queue(EOconfirmationManager *p, eOropdescriptor_t* ropdesc, eOconfman_queue_t queue);
+
+// the transmitter calls it when it takes the rops of a queue inside the packet it prepares, while it holds the mutex 
+// of that queue. only those rops are armed by the next eo_confman_ConfirmationRequests_Process().
+extern void eo_confman_hid_ConfirmationRequests_Sent(EOconfirmationManager *p, eOconfman_queue_t queue);
+
+// the transmitter calls it before it loads a rop with a confirmation request, so that a rop which cannot be tracked is 
+// not sent. it is only a check and not a reservation: the transmitter must be the only one which inserts requests.
+extern eObool_t eo_confman_hid_ConfirmationRequest_HasRoom(EOconfirmationManager *p, const eOropdescriptor_t* ropdesc);
+
 
 
 
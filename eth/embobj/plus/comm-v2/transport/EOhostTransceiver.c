@@ -49,7 +49,9 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the packets of a board which eo_hosttransceiver_ReceiveBatch() gathers on the stack for a eo_transceiver_ReceiveBatch()
+#define EOHOSTTRANSCEIVER_BATCH_GROUP       16
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -103,7 +105,11 @@ const eOhosttransceiver_cfg_t eo_hosttransceiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)      NULL,
         EO_INIT(.onerrorinvalidframe)   NULL
-    }    
+    },
+    EO_INIT(.nvsetarena)                NULL,
+    EO_INIT(.nvsetarenaslot)            0,
+    EO_INIT(.arenasize)                 0,
+    EO_INIT(.zerocopy)                  eobool_false
 };
 
 
@@ -117,6 +123,8 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
 {
     EOhostTransceiver* retptr = NULL;
     eOtransceiver_cfg_t txrxcfg = eo_transceiver_cfg_default;
+    eOmempool_arena_t* arena = NULL;
+    eOmempool_arena_t* previous = NULL;
 
     if(NULL == cfg)
     {
@@ -128,7 +136,17 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_hosttransceiver_New(): NULL nvsetbrdcfg", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
     }  
     
+    // the transceiver itself and all what it allocates come from its arena (if any), so that they are contiguous and the 
+    // threads which create transceivers of different boards do not contend the mutex of the EOtheMemoryPool
+    arena = eo_mempool_arena_New(eo_mempool_GetHandle(), cfg->arenasize);
+    if(NULL != arena)
+    {
+        previous = eo_mempool_arena_Enter(eo_mempool_GetHandle(), arena);
+    }
+    
     retptr = (EOhostTransceiver*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOhostTransceiver), 1);
+    retptr->arena = arena;
+
 
     // 1. init the proper transceiver cfg
 
@@ -149,6 +167,7 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
     txrxcfg.mutex_fn_new                        = cfg->mutex_fn_new;
     txrxcfg.protection                          = cfg->transprotection;
     memcpy(&txrxcfg.extfn, &cfg->extfn, sizeof(eOtransceiver_extfn_t));
+    txrxcfg.zerocopy                            = cfg->zerocopy;
 
     
     
@@ -158,12 +177,20 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
     
     eo_nvset_BRD_Get(retptr->nvset, &retptr->boardnumber);
     
+    if(NULL != arena)
+    {
+        eo_mempool_arena_Leave(eo_mempool_GetHandle(), previous);
+    }
+    
     return(retptr);        
 }    
 
 
 extern void eo_hosttransceiver_Delete(EOhostTransceiver *p) 
 {    
+    eOmempool_arena_t* arena = NULL;
+    eOmempool_arena_t* previous = NULL;
+    
     if(NULL == p)
     {
         return;
@@ -175,12 +202,27 @@ extern void eo_hosttransceiver_Delete(EOhostTransceiver *p)
     }
     
     
+    // inside the arena the objects release only what they hold outside of it (e.g., the blocks which did not fit the arena).
+    // the arena goes away at the end in one shot, with p itself
+    arena = p->arena;
+    if(NULL != arena)
+    {
+        previous = eo_mempool_arena_Enter(eo_mempool_GetHandle(), arena);
+    }
+    
     s_eo_hosttransceiver_nvset_release(p);
     
     eo_transceiver_Delete(p->transceiver);
    
     memset(p, 0, sizeof(EOhostTransceiver));
-    eo_mempool_Delete(eo_mempool_GetHandle(), p);    
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);  
+    
+    if(NULL != arena)
+    {
+        eo_mempool_arena_Leave(eo_mempool_GetHandle(), previous);
+        eo_mempool_arena_Delete(eo_mempool_GetHandle(), arena);
+    }
+    
     return;
 }    
 
@@ -228,6 +270,94 @@ extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p)
 }
 
 
+extern eOmempool_arena_t * eo_hosttransceiver_GetArena(EOhostTransceiver* p)
+{
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+    
+    return(p->arena);    
+}
+
+
+
+extern eOresult_t eo_hosttransceiver_ReceiveBatch(EOhostTransceiver **destinations, EOpacket **pkts, uint16_t numberofpkts, eOreceiver_result_t *results)
+{
+    eOresult_t res = eores_OK;
+    EOpacket *group[EOHOSTTRANSCEIVER_BATCH_GROUP];
+    eOreceiver_result_t groupresults[EOHOSTTRANSCEIVER_BATCH_GROUP];
+    uint16_t positions[EOHOSTTRANSCEIVER_BATCH_GROUP];
+    uint16_t i = 0;
+    uint16_t j = 0;
+    uint16_t n = 0;
+    uint16_t k = 0;
+    
+    if((NULL == destinations) || (NULL == pkts))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    for(i=0; i<numberofpkts; i++)
+    {
+        if(NULL == destinations[i])
+        {   // no board for this packet: it is discarded 
+            if(NULL != results)
+            {
+                memset(&results[i], 0, sizeof(eOreceiver_result_t));
+                results[i].result = eores_NOK_generic;
+            }
+            res = eores_NOK_generic;
+            continue;
+        }
+        
+        // the board of the packet i has been served already if it appears before i. the batches of a recvmmsg() are 
+        // short, thus we dont mind the quadratic search which spares any memory in here
+        for(j=0; (j < i) && (destinations[j] != destinations[i]); j++);
+        if(j < i)
+        {
+            continue;
+        }
+        
+        // we gather all the packets of the board from position i onwards, in their order of reception even if they are 
+        // interleaved with those of other boards, and we give them to eo_transceiver_ReceiveBatch() in groups
+        j = i;
+        while(j < numberofpkts)
+        {
+            for(n=0; (j < numberofpkts) && (n < EOHOSTTRANSCEIVER_BATCH_GROUP); j++)
+            {
+                if(destinations[j] == destinations[i])
+                {
+                    positions[n] = j;
+                    group[n] = pkts[j];
+                    n++;
+                }
+            }
+            
+            if(0 == n)
+            {
+                break;
+            }
+            
+            if(eores_OK != eo_transceiver_ReceiveBatch(destinations[i]->transceiver, group, n, groupresults))
+            {
+                res = eores_NOK_generic;
+            }
+            
+            if(NULL != results)
+            {
+                for(k=0; k<n; k++)
+                {
+                    results[positions[k]] = groupresults[k];
+                }
+            }
+        }
+    }
+    
+    return(res);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -241,6 +371,10 @@ extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p)
 static EOnvSet* s_eo_hosttransceiver_nvset_get(const eOhosttransceiver_cfg_t *cfg)
 {
     EOnvSet* nvset = eo_nvset_New(cfg->nvsetprotection, cfg->mutex_fn_new);    
+    if(NULL != cfg->nvsetarena)
+    {
+        eo_nvsetarena_Slot_Assign(cfg->nvsetarena, cfg->nvsetarenaslot, nvset);
+    }
     eo_nvset_InitBRD_LoadEPs(nvset, eo_nvset_ownership_remote, cfg->remoteboardipv4addr, (eOnvset_BRDcfg_t*)cfg->nvsetbrdcfg, eobool_true);   
     return(nvset);
 }
@@ -43,6 +43,9 @@ extern "C" {
 #include "EOtransceiver.h"
 #include "EOVmutex.h"
 #include "EOropframe.h"
+#include "EOnvSetArena.h"
+#include "EOtheMemoryPool.h"
+
 
 
 
@@ -76,6 +79,10 @@ typedef struct
     eOnvset_protection_t            nvsetprotection; 
     eOconfman_cfg_t*                confmancfg;
     eOtransceiver_extfn_t           extfn;
+    EOnvSetArena*                   nvsetarena;         /*< if not NULL the ram of the endpoints is taken from slot nvsetarenaslot of it */
+    uint8_t                         nvsetarenaslot;
+    uint32_t                        arenasize;          /*< if not 0 the transceiver and what it owns are allocated from a private arena of this size */
+    eObool_t                        zerocopy;           /*< see eOreceiver_cfg_t */
 } eOhosttransceiver_cfg_t;
 
 
@@ -117,6 +124,25 @@ extern eOnvBRD_t eo_hosttransceiver_GetBoardNumber(EOhostTransceiver *p);
 
 extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p);
 
+// the arena of the transceiver or NULL if eOhosttransceiver_cfg_t::arenasize was 0. use it with eo_mempool_arena_Stats_Get().
+extern eOmempool_arena_t * eo_hosttransceiver_GetArena(EOhostTransceiver* p);
+
+
+
+/** @fn         extern eOresult_t eo_hosttransceiver_ReceiveBatch(EOhostTransceiver **destinations, EOpacket **pkts, uint16_t numberofpkts, eOreceiver_result_t *results)
+    @brief      processes a batch of packets received from possibly different boards, for instance the result of a recvmmsg().
+                the caller demuxes each packet by its source address and tells in destinations[i] the EOhostTransceiver of
+                the board which sent pkts[i] (NULL if none). the packets of the same board are grouped in their order of 
+                reception, even if they are interleaved with those of other boards, and they are processed with as few 
+                calls of eo_transceiver_ReceiveBatch() as possible.
+    @param      destinations    array of numberofpkts host transceivers
+    @param      pkts            array of numberofpkts received packets
+    @param      results         if not NULL it must have numberofpkts items and it is filled with the outcome of each packet.
+    @return     eores_OK only if every packet is accepted and valid, eores_NOK_generic otherwise, eores_NOK_nullpointer if 
+                destinations or pkts is NULL
+ **/
+extern eOresult_t eo_hosttransceiver_ReceiveBatch(EOhostTransceiver **destinations, EOpacket **pkts, uint16_t numberofpkts, eOreceiver_result_t *results);
+
 
 
 /** @}            
@@ -62,6 +62,7 @@ struct EOhostTransceiver_hid
     EOnvSet*                nvset;
     eOnvBRD_t               boardnumber;
     eOipv4addr_t            ipaddressofboard;
+    eOmempool_arena_t*      arena;
 }; 
 
 
@@ -66,6 +66,42 @@
     #define eov_mutex_Release(a)
 #endif
 
+
+// the primitives of the seqlock: the acquire and release fences and the atomic compare-and-swap used to serialise the 
+// writers which dont have a mutex. on x86 and x64 the msvc compiler barrier is enough for the seqlock because the cpu does 
+// not reorder loads vs loads or stores vs stores. armcc 5 has the exclusive load and store only on armv7-m. with other 
+// compilers we dont have any of them, thus EONV_SEQLOCK_AVAILABLE is not defined and the EOnvSet refuses the seqlock.
+#if defined(__ATOMIC_ACQUIRE)
+    #define EONV_SEQLOCK_AVAILABLE
+    #define EONV_SEQLOCK_ACQUIRE()                      __atomic_thread_fence(__ATOMIC_ACQUIRE)
+    #define EONV_SEQLOCK_RELEASE()                      __atomic_thread_fence(__ATOMIC_RELEASE)
+    #define EONV_SEQLOCK_CAS(ptr, oldval, newval)       __sync_bool_compare_and_swap((ptr), (oldval), (newval))
+#elif defined(__GNUC__) || defined(__clang__)
+    #define EONV_SEQLOCK_AVAILABLE
+    #define EONV_SEQLOCK_ACQUIRE()                      __sync_synchronize()
+    #define EONV_SEQLOCK_RELEASE()                      __sync_synchronize()
+    #define EONV_SEQLOCK_CAS(ptr, oldval, newval)       __sync_bool_compare_and_swap((ptr), (oldval), (newval))
+#elif defined(_MSC_VER)
+    #include <intrin.h>
+    #define EONV_SEQLOCK_AVAILABLE
+    #define EONV_SEQLOCK_ACQUIRE()                      _ReadWriteBarrier()
+    #define EONV_SEQLOCK_RELEASE()                      _ReadWriteBarrier()
+    #define EONV_SEQLOCK_CAS(ptr, oldval, newval)       ((long)(oldval) == _InterlockedCompareExchange((volatile long*)(ptr), (long)(newval), (long)(oldval)))
+#elif defined(__ARMCC_VERSION) && (defined(__TARGET_ARCH_7_M) || defined(__TARGET_ARCH_7E_M))
+    #define EONV_SEQLOCK_AVAILABLE
+    #define EONV_SEQLOCK_ACQUIRE()                      __dmb(0xF)
+    #define EONV_SEQLOCK_RELEASE()                      __dmb(0xF)
+    #define EONV_SEQLOCK_CAS(ptr, oldval, newval)       s_eo_nv_seqlock_cas((ptr), (oldval), (newval))
+#else
+    #define EONV_SEQLOCK_ACQUIRE()                      
+    #define EONV_SEQLOCK_RELEASE()                      
+#endif
+
+// the seqlock of an nv needs a mutex which serialises its writers and to which the readers fall back
+#if defined(EONV_DONT_USE_EOV_MUTEX_FUNCTIONS)
+    #undef EONV_SEQLOCK_AVAILABLE
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
 // --------------------------------------------------------------------------------------------------------------------
@@ -85,6 +121,23 @@
 static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOnvUpdate_t upd, const eOropdescriptor_t *ropdes);
 static eOresult_t s_eo_nv_Set(const EOnv *nv, const void *dat, void *dst, eOnvUpdate_t upd);
 static void s_eo_nv_UpdateROP(const EOnv *nv, eOnvUpdate_t upd, const eOropdescriptor_t *ropdes);
+static eObool_t s_eo_nv_isToBeUpdated(const EOnv *nv, eOnvUpdate_t upd);
+static void s_eo_nv_WriteBegin(const EOnv *nv);
+static void s_eo_nv_WriteEnd(const EOnv *nv);
+static void s_eo_nv_Copy(const EOnv *nv, void *dest, uint16_t size);
+
+#if defined(__ARMCC_VERSION) && defined(EONV_SEQLOCK_CAS)
+EO_static_inline int s_eo_nv_seqlock_cas(volatile uint32_t *ptr, uint32_t oldval, uint32_t newval)
+{
+    if(oldval != __ldrex(ptr))
+    {
+        __clrex();
+        return(0);
+    }
+    // strex fails if anything has touched the exclusive monitor since the ldrex, also an interrupt
+    return((0 == __strex(newval, ptr)) ? (1) : (0));
+}
+#endif
 
 
 EO_static_inline uint16_t s_eo_nv_get_size2(const EOnv *nv)
@@ -123,7 +176,7 @@ extern void eo_nv_Delete(EOnv *nv)
         return;    
     }   
     
-    eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_vector_Delete(): needs eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_CanDelete(eo_mempool_GetHandle())), "eo_vector_Delete(): needs eo_mempool_CanDelete()", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
   
     // at first clear.
     eo_nv_Clear(nv);
@@ -147,6 +200,7 @@ extern eOresult_t eo_nv_Clear(EOnv *nv)
     nv->rom         = NULL;       
     nv->ram         = NULL;  
     nv->mtx         = NULL;
+    nv->seq         = NULL;
       
     return(eores_OK);
 }
@@ -227,11 +281,8 @@ extern eOresult_t eo_nv_Get(const EOnv *nv, eOnvStorage_t strg, void *data, uint
     {
         case eo_nv_strg_volatile:
         {   // better to protect so that the copy is atomic and not interrupted by other tasks which write 
-            source = nv->ram;       
             *size = s_eo_nv_get_size2(nv);  
-            eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-            memcpy(data, source, *size); 
-            eov_mutex_Release(nv->mtx);
+            s_eo_nv_Copy(nv, data, *size);
             res = eores_OK;
         } break;
 
@@ -265,9 +316,9 @@ extern eOresult_t eo_nv_Init(const EOnv *nv)
     // call the init function if existing
     if(NULL != nv->rom->init)
     {   // protect ...
-        eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+        s_eo_nv_WriteBegin(nv);
         nv->rom->init(nv);
-        eov_mutex_Release(nv->mtx);
+        s_eo_nv_WriteEnd(nv);
         res = eores_OK;
     }
 
@@ -343,7 +394,7 @@ extern eOnvOwnership_t eo_nv_GetOwnership(const EOnv *nv)
 // --------------------------------------------------------------------------------------------------------------------
 
 
-extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx)
+extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx, volatile uint32_t* seq)
 {
     nv->ip          = ip;
     nv->brd         = brd;
@@ -353,15 +404,95 @@ extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eOboo
     nv->rom         = rom;
     nv->ram         = ram; 
     nv->mtx         = mtx;
+    nv->seq         = seq;
            
     return(eores_OK);
 }
 
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest)
 {
-    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-    memcpy(dest, nv->ram, nv->rom->capacity);
-    eov_mutex_Release(nv->mtx);    
+    s_eo_nv_Copy(nv, dest, nv->rom->capacity);
+}
+
+
+extern eObool_t eo_nv_hid_Seqlock_Available(void)
+{
+#if defined(EONV_SEQLOCK_AVAILABLE)
+    return(eobool_true);
+#else
+    return(eobool_false);
+#endif
+}
+
+
+extern uint32_t eo_nv_hid_Seqlock_ReadBegin(volatile uint32_t *seq)
+{
+    // we dont wait for a writer which is inside (odd value): it may be the one we have preempted. 
+    // eo_nv_hid_Seqlock_ReadRetry() will tell to repeat the copy.
+    uint32_t begin = *seq;
+    
+    // the copy of the ram must not start before we have read the counter
+    EONV_SEQLOCK_ACQUIRE();
+    
+    return(begin);
+}
+
+
+extern eObool_t eo_nv_hid_Seqlock_ReadRetry(volatile uint32_t *seq, uint32_t begin)
+{
+    // the copy of the ram must be complete before we read the counter again
+    EONV_SEQLOCK_ACQUIRE();
+    
+    return(((0 != (begin & 1)) || (begin != *seq)) ? (eobool_true) : (eobool_false));
+}
+
+
+extern uint8_t eo_nv_hid_Seqlock_Stalls(volatile uint32_t *seq, uint32_t begin, uint8_t stalls)
+{
+    // the same odd value means that the same writer is still inside. a writer which runs on another core moves the counter
+    return((begin == *seq) ? (stalls+1) : (0));
+}
+
+
+extern void eo_nv_hid_Seqlock_WriteBegin(volatile uint32_t *seq)
+{
+#if defined(EONV_SEQLOCK_CAS)
+    uint32_t value = 0;
+    
+    // we make the counter odd. if it is already odd another writer is inside and we wait for it
+    for(;;)
+    {
+        value = *seq;
+        if((0 == (value & 1)) && (EONV_SEQLOCK_CAS(seq, value, value+1)))
+        {
+            break;
+        }
+    }
+    
+    // the readers must see the odd counter before any change of the ram
+    EONV_SEQLOCK_RELEASE();
+#else
+    // w/out the compare-and-swap the caller must serialise the writers
+    eo_nv_hid_Seqlock_WriteBeginSingle(seq);
+#endif
+}
+
+
+extern void eo_nv_hid_Seqlock_WriteBeginSingle(volatile uint32_t *seq)
+{
+    *seq = *seq + 1;
+    
+    // the readers must see the odd counter before any change of the ram
+    EONV_SEQLOCK_RELEASE();
+}
+
+
+extern void eo_nv_hid_Seqlock_WriteEnd(volatile uint32_t *seq)
+{
+    // the changes of the ram must be visible before the counter becomes even again
+    EONV_SEQLOCK_RELEASE();
+    
+    *seq = *seq + 1;
 }
 
 
@@ -462,9 +593,9 @@ extern eOresult_t eo_nv_hid_OnSay(const EOnv *nv, const eOropdescriptor_t* ropde
     // call the onsay function function if not NULL
     if(NULL != nv->onsay)
     {             
-        eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+        s_eo_nv_WriteBegin(nv);
         nv->onsay(nv, ropdes);
-        eov_mutex_Release(nv->mtx);
+        s_eo_nv_WriteEnd(nv);
     }
     
     return(eores_OK);
@@ -487,13 +618,15 @@ static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOn
 {
     uint16_t size = s_eo_nv_get_size2(nv);
 
-    // copy data
-    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    // copy data and call the update function if necessary. they are in the same write section, so that with the seqlock 
+    // the readers dont see the new value before the update function has processed it
+    s_eo_nv_WriteBegin(nv);
     memcpy(dst, dat, size);
-    eov_mutex_Release(nv->mtx);
-
-    // call the update function if necessary
-    s_eo_nv_UpdateROP(nv, upd, ropdes);
+    if(eobool_true == s_eo_nv_isToBeUpdated(nv, upd))
+    {
+        nv->rom->update(nv, ropdes);
+    }
+    s_eo_nv_WriteEnd(nv);
 
     return(eores_OK);
 }
@@ -501,19 +634,77 @@ static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOn
 static void s_eo_nv_UpdateROP(const EOnv *nv, eOnvUpdate_t upd, const eOropdescriptor_t *ropdes)
 {
     // call the update function if necessary
-    if(eo_nv_upd_dontdo != upd)
+    if(eobool_true == s_eo_nv_isToBeUpdated(nv, upd))
+    {
+        s_eo_nv_WriteBegin(nv);
+        nv->rom->update(nv, ropdes);
+        s_eo_nv_WriteEnd(nv);
+    }
+
+}
+
+static eObool_t s_eo_nv_isToBeUpdated(const EOnv *nv, eOnvUpdate_t upd)
+{
+    if((eo_nv_upd_dontdo == upd) || (NULL == nv->rom->update))
     {
-        if((eo_nv_upd_always == upd) || (eobool_true == eo_nv_hid_isUpdateable(nv))) 
+        return(eobool_false);
+    }
+    
+    return(((eo_nv_upd_always == upd) || (eobool_true == eo_nv_hid_isUpdateable(nv))) ? (eobool_true) : (eobool_false));
+}
+
+// the update(), init() and onsay() callbacks also run inside the write section: they may change the ram
+static void s_eo_nv_WriteBegin(const EOnv *nv)
+{
+    // the writers are serialised by the mutex. with the seqlock it has priority inheritance, thus a reader which falls
+    // back to it lets the writer complete. w/out the mutex the writers use the compare-and-swap of the counter
+    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    
+    if((NULL != nv->seq) && (NULL != nv->mtx))
+    {
+        eo_nv_hid_Seqlock_WriteBeginSingle(nv->seq);
+    }
+    else if(NULL != nv->seq)
+    {
+        eo_nv_hid_Seqlock_WriteBegin(nv->seq);
+    }
+}
+
+static void s_eo_nv_WriteEnd(const EOnv *nv)
+{
+    if(NULL != nv->seq)
+    {
+        eo_nv_hid_Seqlock_WriteEnd(nv->seq);
+    }
+    
+    eov_mutex_Release(nv->mtx);
+}
+
+static void s_eo_nv_Copy(const EOnv *nv, void *dest, uint16_t size)
+{
+    uint32_t begin = 0;
+    uint8_t attempts = 0;
+    
+    if(NULL != nv->seq)
+    {   // we just retry if a writer has changed the ram meanwhile ...
+        while(attempts < EONV_SEQLOCK_ATTEMPTS)
         {
-            if(NULL != nv->rom->update)
+            begin = eo_nv_hid_Seqlock_ReadBegin(nv->seq);
+            memcpy(dest, nv->ram, size);
+            if(eobool_false == eo_nv_hid_Seqlock_ReadRetry(nv->seq, begin))
             {
-                eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-                nv->rom->update(nv, ropdes);
-                eov_mutex_Release(nv->mtx);
+                return;
             }
+            // w/out the mutex we can only go on retrying
+            attempts = (NULL != nv->mtx) ? (eo_nv_hid_Seqlock_Stalls(nv->seq, begin, attempts)) : (0);
         }
+        // ... but if the writer does not complete (we may have preempted it) we wait for it on the mutex
     }
-
+    
+    // better to protect so that the copy is atomic and not interrupted by other tasks which write 
+    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    memcpy(dest, nv->ram, size);
+    eov_mutex_Release(nv->mtx);
 }
 
 
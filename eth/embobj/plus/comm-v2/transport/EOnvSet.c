@@ -33,6 +33,9 @@
 
 #include "EOconstvector_hid.h"
 
+#include "EOVtheSystem.h"
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of extern public interface
@@ -46,6 +49,7 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "EOnvSet_hid.h" 
+#include "EOnvSetArena_hid.h" 
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -124,11 +128,16 @@ static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, e
 
 static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoint, eOnvEP8_t ep08);
 
+static void s_eo_nvset_NVsOfEP_Compile(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+
+
 static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p);
 static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p);
 
 static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32);
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8);
+static void s_eo_nvset_snapshot_publish(eOnvset_ep_t* theEndpoint);
+static void s_eo_nvset_changequeue_put(EOnvSet* p, eOnvID32_t id32);
 uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08);
 
 
@@ -154,7 +163,14 @@ extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderive
     // i dont initialise yet the device. i simply rely on the fact that it contains all zero data.
     p->theboard.ipaddress       = 0;    
     p->mtxderived_new           = mtxnew; 
-    p->protection               = (NULL == mtxnew) ? (eo_nvset_protection_none) : (prot); 
+    // the seqlock also needs the atomics of the compiler. w/out them we use the mutex of the endpoint it would use anyway
+    if((eo_nvset_protection_seqlock == prot) && (eobool_false == eo_nv_hid_Seqlock_Available()))
+    {
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "EOnvSet: no seqlock, one mutex per endpoint", NULL, &eo_errman_DescrRuntimeErrorLocal);
+        prot = eo_nvset_protection_one_per_endpoint;
+    }
+    // w/out a mutex the seqlock is the only protection we can have
+    p->protection               = ((NULL == mtxnew) && (eo_nvset_protection_seqlock != prot)) ? (eo_nvset_protection_none) : (prot); 
 
     return(p);
 }
@@ -168,6 +184,12 @@ extern void eo_nvset_Delete(EOnvSet* p)
     }
     
     eo_nvset_DeinitBRD(p);
+    
+    if(NULL != p->changequeue)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->changequeue->slots);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->changequeue);
+    }
                
     memset(p, 0, sizeof(EOnvSet));
     
@@ -346,71 +368,71 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
 #define EO_NVSET_INIT_EVERY_NV
 #if defined(EO_NVSET_INIT_EVERY_NV)
     {   // put parenthesis to create a new scope and avoid errors in non c99 environments as windows
+        // we call eo_nv_Init() only for the netvars which have an init() callback: the eoprot library keeps a mask of them 
+        // for each entity. the netvars are taken from the table built by s_eo_nvset_NVsOfEP_Compile() and are visited in 
+        // order of progressive number as eoprot_endpoint_prognum2id() would do.
         EOnv thenv = {0};
-        uint16_t k = 0;
-        EOnv_rom_t* rom = NULL;
-        uint8_t* ram = NULL;
-        uint16_t nvars = theEndpoint->epnvsnumberof;
+        eOnvset_nv_t* nv = NULL;
         eOipv4addr_t ip = theBoard->ipaddress;
         uint8_t brd =  theBoard->boardnum; // local or 0, 1, 2, 3
         eOnvID32_t id32 = EOK_uint32dummy;     
-        uint32_t prog = 0;
-        eObool_t proxied = eobool_false;
-        eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
-        
-        EOVmutexDerived* mtx2use = NULL;
-
-        if(eo_nvset_protection_one_per_board == p->protection)
-        {
-            mtx2use = theBoard->mtx_board;
-        }
-        else if(eo_nvset_protection_one_per_endpoint == p->protection)
-        {
-            mtx2use = theEndpoint->mtx_endpoint;
-        }
-        // else if eo_nvset_protection_one_per_netvar ... eval foreach k
-
-        for(k=0; k<nvars; k++)
+        eOvoid_fp_cnvp_cropdesp_t onsay = eoprot_onsay_endpoint_get(ep08);
+        uint64_t withinit = 0;
+        uint16_t prog = 0;
+        uint8_t ent = 0;
+        uint8_t index = 0;
+        uint8_t tag = 0;
+
+        for(ent=0; ent<=eoprot_maxvalueof_entity; ent++)
         {
-            if(eo_nvset_protection_one_per_netvar == p->protection)
+            if((0 == theEndpoint->epcfg.numberofentities[ent]) || (0 == theEndpoint->entitytags[ent]))
             {
-                //#warning -> think of uint32 and void* maybe use uint64
-                uint32_t** addr = (uint32_t**) eo_vector_At(theEndpoint->themtxofthenvs, k);
-                mtx2use = (EOVmutexDerived*) (*addr);
+                continue;
             }
             
-            prog = k;
-            // - 0. the id32 
-            id32 = eoprot_endpoint_prognum2id(brd, ep08, prog);               
-            if(EOK_uint32dummy == id32)
-            {
+            withinit = eoprot_entity_tags_withinit_get(ep08, ent);
+            if(0 == withinit)
+            {   // the common case: no variable of this entity has an init() callback
                 continue;
             }
-
-            // - 0+. proxied?
-            proxied = eoprot_variable_is_proxied(brd, id32);                
-            // - 0++ onsay
-            onsay = eoprot_onsay_endpoint_get(ep08); 
-            // - 1. the rom
-            rom = (EOnv_rom_t*) eoprot_variable_romof_get(brd, id32);
-            // - 2. the ram
-            ram = (uint8_t*) eoprot_variable_ramof_get(brd, id32);
-            // - 3. the mtx
-            mtx2use = mtx2use;
-            // - load everything into the nv
-            eo_nv_hid_Load(     &thenv,
-                                ip, 
-                                brd,
-                                proxied,
-                                id32,
-                                onsay,
-                                rom,
-                                ram,
-                                mtx2use
-                          );                    
             
-         
-            eo_nv_Init(&thenv);                             
+            for(index=0; index<theEndpoint->epcfg.numberofentities[ent]; index++)
+            {
+                for(tag=0; tag<theEndpoint->entitytags[ent]; tag++)
+                {
+                    if((tag < 64) && (0 == (withinit & (((uint64_t)1) << tag))))
+                    {
+                        continue;
+                    }
+                    
+                    prog = theEndpoint->entityprognum[ent] + index*theEndpoint->entitytags[ent] + tag;
+                    if(prog >= theEndpoint->epnvsnumberof)
+                    {
+                        continue;
+                    }
+                    
+                    nv = &theEndpoint->thenvs[prog];
+                    if((NULL == nv->rom) || (NULL == nv->ram))
+                    {
+                        continue;
+                    }
+                    
+                    id32 = eoprot_ID_get(ep08, ent, index, tag);
+                    eo_nv_hid_Load(     &thenv,
+                                        ip, 
+                                        brd,
+                                        eoprot_variable_is_proxied(brd, id32),
+                                        id32,
+                                        onsay,
+                                        nv->rom,
+                                        nv->ram,
+                                        nv->mtx,
+                                        nv->seq
+                                  );                    
+                    
+                    eo_nv_Init(&thenv);  
+                }
+            }
         }
     }   // put parenthesis to create a new scope and avoid errors in non c99 environments as windows
 #endif //EO_NVSET_INIT_EVERY_NV                   
@@ -487,6 +509,246 @@ extern void* eo_nvset_RAMofVariable_Get(EOnvSet* p, eOnvID32_t id32)
 }
 
 
+extern eOresult_t eo_nvset_ChangeQueue_Enable(EOnvSet* p, uint16_t capacity)
+{
+    uint32_t size = 1;
+    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    if((NULL != p->changequeue) || (0 == capacity))
+    {   // already enabled or w/out room for any change
+        return(eores_NOK_generic); 
+    }
+    
+    // a power of two so that the slot of a sequence is just a mask of it, also when the sequence wraps around
+    while(size < capacity)
+    {
+        size <<= 1;
+    }
+    
+    p->changequeue = (eOnvset_changequeue_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOnvset_changequeue_t), 1);
+    p->changequeue->slots = (eOnvset_changeslot_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOnvset_changeslot_t), size);
+    memset(p->changequeue->slots, 0, size*sizeof(eOnvset_changeslot_t));
+    p->changequeue->capacity = size;
+    p->changequeue->head = 0;
+    
+    return(eores_OK);
+}
+
+
+extern uint32_t eo_nvset_ChangeQueue_Cursor_Get(EOnvSet* p)
+{
+    if((NULL == p) || (NULL == p->changequeue)) 
+    {
+        return(0); 
+    }
+    
+    return(p->changequeue->head);
+}
+
+
+extern uint32_t eo_nvset_ChangeQueue_Pending(EOnvSet* p, uint32_t cursor)
+{
+    uint32_t pending = 0;
+    
+    if((NULL == p) || (NULL == p->changequeue)) 
+    {
+        return(0); 
+    }
+    
+    // the difference is correct also when the sequence wraps around
+    pending = p->changequeue->head - cursor;
+    
+    return((pending > p->changequeue->capacity) ? (p->changequeue->capacity) : (pending));
+}
+
+
+extern uint16_t eo_nvset_ChangeQueue_Get(EOnvSet* p, uint32_t* cursor, eOnvset_change_t* changes, uint16_t maxnumber, uint32_t* lost)
+{
+    eOnvset_changequeue_t *queue = NULL;
+    eOnvset_changeslot_t *slot = NULL;
+    eOnvset_change_t change;
+    uint32_t head = 0;
+    uint32_t pos = 0;
+    uint32_t begin = 0;
+    uint32_t missed = 0;
+    uint16_t n = 0;
+    uint8_t attempts = 0;
+    
+    if(NULL != lost)
+    {
+        *lost = 0;
+    }
+    
+    if((NULL == p) || (NULL == p->changequeue) || (NULL == cursor) || (NULL == changes)) 
+    {
+        return(0); 
+    }
+    
+    queue = p->changequeue;
+    pos = *cursor;
+    head = queue->head;
+    
+    while((n < maxnumber) && (pos != head))
+    {
+        if((head - pos) > queue->capacity)
+        {   // the producer has already overwritten the change at pos: we restart from the oldest one
+            missed += (head - queue->capacity) - pos;
+            pos = head - queue->capacity;
+        }
+        
+        slot = &queue->slots[pos & (queue->capacity - 1)];
+        for(attempts=0; attempts<EONV_SEQLOCK_ATTEMPTS; attempts=eo_nv_hid_Seqlock_Stalls(&slot->seq, begin, attempts))
+        {
+            begin = eo_nv_hid_Seqlock_ReadBegin(&slot->seq);
+            memcpy(&change, &slot->change, sizeof(eOnvset_change_t));
+            if(eobool_false == eo_nv_hid_Seqlock_ReadRetry(&slot->seq, begin))
+            {
+                break;
+            }
+        }
+        
+        if(EONV_SEQLOCK_ATTEMPTS == attempts)
+        {   // the producer is writing the slot and we may have preempted it: the caller gets the change at next read
+            break;
+        }
+        else if(change.sequence == pos)
+        {
+            memcpy(&changes[n++], &change, sizeof(eOnvset_change_t));
+            pos ++;
+        }
+        else
+        {   // the slot was overwritten after we have read the head: we read it again
+            head = queue->head;
+        }
+    }
+    
+    *cursor = pos;
+    
+    if(NULL != lost)
+    {
+        *lost = missed;
+    }
+    
+    return(n);
+}
+
+
+extern eOresult_t eo_nvset_Snapshot_Enable(EOnvSet* p, eOnvEP8_t ep8, uint8_t numberofbuffers)
+{
+    eOnvset_ep_t* theEndpoint = NULL;
+    eOnvset_snapshots_t* snapshots = NULL;
+    uint8_t i = 0;
+    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+    if((NULL == theEndpoint) || (NULL != theEndpoint->snapshots) || (numberofbuffers < 2))
+    {   // not loaded, already enabled or w/out room for the consumers
+        return(eores_NOK_generic); 
+    }
+    
+    snapshots = (eOnvset_snapshots_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOnvset_snapshots_t), 1);
+    snapshots->buffers = (eOnvset_snapshotbuffer_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOnvset_snapshotbuffer_t), numberofbuffers);
+    snapshots->sizeofram = eoprot_endpoint_sizeof_get(p->theboard.boardnum, ep8);
+    snapshots->numberof = numberofbuffers;
+    snapshots->latest = 0;
+    snapshots->generation = 0;
+    for(i=0; i<numberofbuffers; i++)
+    {
+        snapshots->buffers[i].seq = 0;
+        snapshots->buffers[i].generation = 0;
+        snapshots->buffers[i].ram = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, snapshots->sizeofram, 1);
+    }
+    
+    theEndpoint->snapshots = snapshots;
+    
+    // there is always a snapshot to pin: the ram as it is now
+    s_eo_nvset_snapshot_publish(theEndpoint);
+    
+    p->snapshotsenabled |= (1 << ep8);
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_Snapshot_Pin(EOnvSet* p, eOnvEP8_t ep8, eOnvset_snapshot_t* snapshot)
+{
+    eOnvset_ep_t* theEndpoint = NULL;
+    eOnvset_snapshotbuffer_t* buffer = NULL;
+    
+    if((NULL == p) || (NULL == snapshot)) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+    if((NULL == theEndpoint) || (NULL == theEndpoint->snapshots))
+    {
+        return(eores_NOK_generic); 
+    }
+    
+    // if the receiver publishes a newer snapshot meanwhile we just get the previous one
+    snapshot->buffer = theEndpoint->snapshots->latest;
+    buffer = &theEndpoint->snapshots->buffers[snapshot->buffer];
+    snapshot->seq = eo_nv_hid_Seqlock_ReadBegin(&buffer->seq);
+    snapshot->generation = buffer->generation;
+    snapshot->ram = buffer->ram;
+    
+    return(eores_OK);
+}
+
+
+extern eObool_t eo_nvset_Snapshot_Unpin(EOnvSet* p, eOnvEP8_t ep8, const eOnvset_snapshot_t* snapshot)
+{
+    eOnvset_ep_t* theEndpoint = NULL;
+    
+    if((NULL == p) || (NULL == snapshot)) 
+    {
+        return(eobool_false); 
+    }
+    
+    theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+    if((NULL == theEndpoint) || (NULL == theEndpoint->snapshots) || (snapshot->buffer >= theEndpoint->snapshots->numberof))
+    {
+        return(eobool_false); 
+    }
+    
+    // the snapshot is consistent if the receiver has not started to overwrite its buffer since the pin
+    return((eobool_true == eo_nv_hid_Seqlock_ReadRetry(&theEndpoint->snapshots->buffers[snapshot->buffer].seq, snapshot->seq)) ? (eobool_false) : (eobool_true));
+}
+
+
+extern const void* eo_nvset_Snapshot_RAMofEntity_Get(EOnvSet* p, const eOnvset_snapshot_t* snapshot, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index)
+{
+    uint8_t* epram = NULL;
+    uint8_t* entram = NULL;
+    
+    if((NULL == p) || (NULL == snapshot) || (NULL == snapshot->ram)) 
+    {
+        return(NULL); 
+    }
+    
+    // the entity is at the same offset as inside the ram of the endpoint
+    epram = (uint8_t*) eoprot_endpoint_ramof_get(p->theboard.boardnum, ep8);
+    entram = (uint8_t*) eoprot_entity_ramof_get(p->theboard.boardnum, ep8, ent, index);
+    if((NULL == epram) || (NULL == entram))
+    {
+        return(NULL);
+    }
+    
+    return((const uint8_t*)snapshot->ram + (entram - epram));
+}
+
+
+
+
 extern eOresult_t eo_nvset_BRD_Get(EOnvSet* p, eOnvBRD_t* brd)
 { 
     if((NULL == p) || (NULL == brd)) 
@@ -503,12 +765,13 @@ extern eOresult_t eo_nvset_BRD_Get(EOnvSet* p, eOnvBRD_t* brd)
 extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
 {
     eOnvEP8_t ep8 = eoprot_ID2endpoint(id32); 
+    eOprotEntity_t ent = eoprot_ID2entity(id32);
+    eOprotIndex_t index = eoprot_ID2index(id32);
+    eOprotTag_t tag = eoprot_ID2tag(id32);
     uint8_t brd = 0; // local, or 0, 1, 2, 3 ...
-    eObool_t proxied = eobool_false;
-    EOnv_rom_t* rom = NULL;
-    uint8_t* ram = NULL;
-    EOVmutexDerived* mtx2use = NULL;
-    eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
+    eOnvset_ep_t* theEndpoint = NULL;
+    eOnvset_nv_t* nv = NULL;
+    uint16_t prog = 0;
  
     if((NULL == p) || (NULL == thenv)) 
     {
@@ -518,42 +781,48 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
     brd = p->theboard.boardnum;
     
     // - verify that on the given endpoint there is a valid id32. if the id32 is not recognised, then ... eores_NOK_generic
-    if(eobool_false == eoprot_id_isvalid(brd, id32))
+    //   we do the same checks as eoprot_id_isvalid() but with the data of the endpoint.
+    theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+    if((NULL == theEndpoint) || (ent > eoprot_maxvalueof_entity))
     {
         return(eores_NOK_generic);       
     }
     
-    // - retrieve from the device and endpoint what is required to form the netvar: con, ram, mtx, etc.   
-    // - 0+. proxied? 
-    proxied = eoprot_variable_is_proxied(brd, id32);
-    // - 0++. the onsay function
-    onsay = eoprot_onsay_endpoint_get(ep8);   
-    // - 1. the rom
-    rom = (EOnv_rom_t*) eoprot_variable_romof_get(brd, id32);
-    // - 2. the ram
-    ram = (uint8_t*) eoprot_variable_ramof_get(brd, id32);
-    // - 3. the mtx
-    mtx2use = s_eo_nvset_get_nvmutex(p, id32);
+    if((tag >= theEndpoint->entitytags[ent]) || (index >= theEndpoint->epcfg.numberofentities[ent]))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // - retrieve from the table of the endpoint what is required to form the netvar: rom, ram, mtx. 
+    //   the progressive number is computed as in eoprot_endpoint_id2prognum()
+    prog = theEndpoint->entityprognum[ent] + index*theEndpoint->entitytags[ent] + tag;
+    if(prog >= theEndpoint->epnvsnumberof)
+    {
+        return(eores_NOK_generic);
+    }
+    nv = &theEndpoint->thenvs[prog];
         
     // - final control about the validity of id32. it may be redundant but it is safer. for instance if the fptr_isepidsupported()
     //   does not take into account a removed tag and just checks that the tag-number is lower than the max allowed.
     
-    if((NULL == rom) || (NULL == ram))  // mtx2use can be NULL
+    if((NULL == nv->rom) || (NULL == nv->ram))  // mtx can be NULL
     {
         return(eores_NOK_generic); 
     }
     
 
-    // - load everything into the nv
+    // - load everything into the nv. proxied and onsay are not in the table because they can be configured in the eoprot 
+    //   library after the endpoint is loaded. however they are just a function pointer each.
     eo_nv_hid_Load(     thenv,
                         p->theboard.ipaddress,
                         brd,
-                        proxied,
+                        eoprot_variable_is_proxied(brd, id32),
                         id32,  
-                        onsay,
-                        rom,
-                        ram,
-                        mtx2use
+                        eoprot_onsay_endpoint_get(ep8),
+                        nv->rom,
+                        nv->ram,
+                        nv->mtx,
+                        nv->seq
                   );    
 
     return(eores_OK);
@@ -565,6 +834,61 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
 
+extern void eo_nvset_hid_Ropframe_Begin(EOnvSet* p)
+{
+    if((NULL == p) || (NULL == p->changequeue))
+    {
+        return;
+    }
+    
+    // a single time for all the rops of a ropframe: they are applied in the same few microseconds
+    p->changequeue->timeofchanges = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+}
+
+
+extern void eo_nvset_hid_NV_Changed(EOnvSet* p, eOnvID32_t id32)
+{
+    eOnvEP8_t ep8 = eoprot_ID2endpoint(id32);
+    
+    if(NULL == p)
+    {
+        return;
+    }
+    
+    if((ep8 <= eonvset_max_endpoint_value) && (0 != (p->snapshotsenabled & (1 << ep8))))
+    {   // the snapshot is published only at the end of the ropframe
+        p->snapshotsdirty |= (1 << ep8);
+    }
+    
+    s_eo_nvset_changequeue_put(p, id32);
+}
+
+
+extern void eo_nvset_hid_Ropframe_End(EOnvSet* p)
+{
+    eOnvEP8_t ep8 = 0;
+    eOnvset_ep_t* theEndpoint = NULL;
+    
+    if((NULL == p) || (0 == p->snapshotsdirty))
+    {
+        return;
+    }
+    
+    for(ep8=0; ep8<=eonvset_max_endpoint_value; ep8++)
+    {
+        if(0 != (p->snapshotsdirty & (1 << ep8)))
+        {
+            theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+            if(NULL != theEndpoint)
+            {
+                s_eo_nvset_snapshot_publish(theEndpoint);
+            }
+        }
+    }
+    
+    p->snapshotsdirty = 0;
+}
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -671,8 +995,17 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
     
     theEndpoint->epnvsnumberof      = epnvsnumberof;
     theEndpoint->initted            = eobool_false;    
-    theEndpoint->epram              = (void*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
-    theEndpoint->mtx_endpoint       = (eo_nvset_protection_one_per_endpoint == p->protection) ? p->mtxderived_new() : NULL;
+    theEndpoint->epram              = eo_nvsetarena_hid_Acquire(p->arena, p->arenaslot, theEndpoint->epcfg.endpoint, sizeofram);
+    theEndpoint->epraminarena       = (NULL != theEndpoint->epram) ? (eobool_true) : (eobool_false);
+    if(NULL == theEndpoint->epram)
+    {   // no arena or the endpoint does not fit in its slot
+        theEndpoint->epram          = (void*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
+    }
+    // the seqlock also uses it, if there is one, to serialise the writers
+    theEndpoint->mtx_endpoint       = ((eo_nvset_protection_one_per_endpoint == p->protection) || 
+                                       ((eo_nvset_protection_seqlock == p->protection) && (NULL != p->mtxderived_new))) ? p->mtxderived_new() : NULL;
+    theEndpoint->theseqofthenvs     = NULL;
+    theEndpoint->snapshots          = NULL;
         
     // now we must load the ram in the endpoint
     eoprot_config_endpoint_ram(brd, theEndpoint->epcfg.endpoint, theEndpoint->epram, sizeofram);
@@ -689,11 +1022,21 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
         }
     }
     
+    // or the sequence counters, which start even: no writer is inside.
+    if(eo_nvset_protection_seqlock == p->protection)
+    {
+        theEndpoint->theseqofthenvs = (uint32_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(uint32_t), epnvsnumberof);
+        memset(theEndpoint->theseqofthenvs, 0, epnvsnumberof*sizeof(uint32_t));
+    }
+    
     // now, i must update the mapping function from ep value to vector of endpoints  
     theBoard->ep2indexlut[theEndpoint->epcfg.endpoint] = eo_vector_Size(theBoard->theendpoints);
     // and only now i push back the endpoint
     eo_vector_PushBack(theBoard->theendpoints, &theEndpoint);
     
+    // now that the endpoint is reachable we build the table used by eo_nvset_NV_Get()
+    s_eo_nvset_NVsOfEP_Compile(p, theEndpoint);
+    
     
     if(eobool_true == initNVs)
     {
@@ -723,8 +1066,15 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
         eOnvset_ep_t **ppep = (eOnvset_ep_t **)eo_vector_At(theBoard->theendpoints, i);
         eOnvset_ep_t *theEndpoint = *ppep;
         
-        // now i erase memory associated with this endpoint
-        eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        // now i erase memory associated with this endpoint or i give it back to the arena
+        if(eobool_true == theEndpoint->epraminarena)
+        {
+            eo_nvsetarena_hid_Release(p->arena, p->arenaslot, theEndpoint->epcfg.endpoint);
+        }
+        else
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        }
         // and i dissociates that from from the internals of the eoprot library
         eoprot_config_endpoint_ram(theBoard->boardnum, theEndpoint->epcfg.endpoint, NULL, 0);
         // i also de-init the number of entities for that endpoint
@@ -747,18 +1097,92 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
             } 
             eo_vector_Delete(theEndpoint->themtxofthenvs);
         }
+        if(NULL != theEndpoint->theseqofthenvs)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->theseqofthenvs);
+        }
+        
+        // and the snapshots
+        if(NULL != theEndpoint->snapshots)
+        {
+            uint8_t k = 0;
+            for(k=0; k<theEndpoint->snapshots->numberof; k++)
+            {
+                eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->snapshots->buffers[k].ram);
+            }
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->snapshots->buffers);
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->snapshots);
+        }
+        
+        // and the table of the netvars
+        if(NULL != theEndpoint->thenvs)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->thenvs);
+        }
    
         // now i erase the memory of the entire eOnvset_ep_t entry        
         eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint);       
     }
     
-    // so that we dont get in here inside again
+    // so that we dont get in here inside again. the vector goes away now, as s_eo_nvset_DeinitDEV() finds it NULL
+    eo_vector_Delete(theBoard->theendpoints);
     theBoard->theendpoints = NULL;
+    p->snapshotsenabled = 0;
+    p->snapshotsdirty = 0;
 
     return(eores_OK);
 }
 
 
+static void s_eo_nvset_NVsOfEP_Compile(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+    eOnvBRD_t brd = p->theboard.boardnum;
+    eOnvEP8_t ep08 = theEndpoint->epcfg.endpoint;
+    eOnvset_nv_t* nv = NULL;
+    eOnvID32_t id32 = EOK_uint32dummy;
+    eOprotEntity_t ent = 0;
+    eOprotTag_t tag = 0;
+    uint16_t k = 0;
+    
+    theEndpoint->thenvs = (eOnvset_nv_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOnvset_nv_t), theEndpoint->epnvsnumberof);
+    memset(theEndpoint->entityprognum, 0, sizeof(theEndpoint->entityprognum));
+    memset(theEndpoint->entitytags, 0, sizeof(theEndpoint->entitytags));
+    
+    // the netvars of an endpoint are ordered by entity, then by index, then by tag. thus, for each entity it is enough to know
+    // the progressive number of its first netvar and its number of tags. we take them from eoprot_endpoint_prognum2id(), 
+    // so that we dont depend on the internals of the eoprot library.
+    for(k=0; k<theEndpoint->epnvsnumberof; k++)
+    {
+        nv = &theEndpoint->thenvs[k];
+        nv->rom = NULL;
+        nv->ram = NULL;
+        nv->mtx = NULL;
+        nv->seq = (NULL != theEndpoint->theseqofthenvs) ? (&theEndpoint->theseqofthenvs[k]) : (NULL);
+        
+        id32 = eoprot_endpoint_prognum2id(brd, ep08, k);
+        ent = eoprot_ID2entity(id32);
+        if((EOK_uint32dummy == id32) || (ent > eoprot_maxvalueof_entity))
+        {
+            continue;
+        }
+        
+        tag = eoprot_ID2tag(id32);
+        if((0 == eoprot_ID2index(id32)) && (0 == tag))
+        {
+            theEndpoint->entityprognum[ent] = k;
+        }
+        if(tag >= theEndpoint->entitytags[ent])
+        {
+            theEndpoint->entitytags[ent] = tag + 1;
+        }
+        
+        nv->rom = (EOnv_rom_t*) eoprot_variable_romof_get(brd, id32);
+        nv->ram = eoprot_variable_ramof_get(brd, id32);
+        nv->mtx = s_eo_nvset_get_nvmutex(p, id32);
+    }
+}
+
+
 static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
 {
     EOVmutexDerived* mtx2use = NULL;
@@ -777,6 +1201,7 @@ static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
             } break;            
        
             case eo_nvset_protection_one_per_endpoint:
+            case eo_nvset_protection_seqlock:
             {
                 // compute the endpoint and ....
                 eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, eoprot_ID2endpoint(id32));
@@ -810,6 +1235,50 @@ static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
 }
 
 
+static void s_eo_nvset_changequeue_put(EOnvSet* p, eOnvID32_t id32)
+{
+    eOnvset_changequeue_t *queue = NULL;
+    eOnvset_changeslot_t *slot = NULL;
+    uint32_t head = 0;
+    
+    if(NULL == p->changequeue)
+    {
+        return;
+    }
+    
+    queue = p->changequeue;
+    head = queue->head;
+    slot = &queue->slots[head & (queue->capacity - 1)];
+    
+    // the consumers which read this slot meanwhile will read it again
+    eo_nv_hid_Seqlock_WriteBeginSingle(&slot->seq);
+    slot->change.id32       = id32;
+    slot->change.sequence   = head;
+    slot->change.timestamp  = queue->timeofchanges;
+    eo_nv_hid_Seqlock_WriteEnd(&slot->seq);
+    
+    // only now the change is visible to the consumers
+    queue->head = head + 1;
+}
+
+
+static void s_eo_nvset_snapshot_publish(eOnvset_ep_t* theEndpoint)
+{
+    eOnvset_snapshots_t* snapshots = theEndpoint->snapshots;
+    uint8_t next = (snapshots->latest + 1) % snapshots->numberof;
+    eOnvset_snapshotbuffer_t* buffer = &snapshots->buffers[next];
+    
+    // the oldest buffer is overwritten. the consumers which have it pinned will fail their eo_nvset_Snapshot_Unpin()
+    eo_nv_hid_Seqlock_WriteBeginSingle(&buffer->seq);
+    memcpy(buffer->ram, theEndpoint->epram, snapshots->sizeofram);
+    buffer->generation = ++snapshots->generation;
+    eo_nv_hid_Seqlock_WriteEnd(&buffer->seq);
+    
+    // only now the consumers can pin it
+    snapshots->latest = next;
+}
+
+
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8)
 {
     eOnvset_brd_t* theBoard = &p->theboard;
@@ -100,9 +100,41 @@ typedef enum
     eo_nvset_protection_none               = 0,    /**< we dont protect vs concurrent access at all */
     eo_nvset_protection_one_per_board      = 2,    /**< all the NVs in a booard share the same mutex */
     eo_nvset_protection_one_per_endpoint   = 3,    /**< all the NVs in an endpoint inside each board share the same mutex */
-    eo_nvset_protection_one_per_netvar     = 4     /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
+    eo_nvset_protection_one_per_netvar     = 4,    /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
+    eo_nvset_protection_seqlock            = 5     /**< every NV has its own sequence counter: the readers retry the copy if a writer 
+                                                        has changed the NV meanwhile and take the mutex of the endpoint only if the 
+                                                        writer does not complete (e.g., they have preempted it). the writers and the 
+                                                        update(), init() and onsay() callbacks use that mutex. w/out a mutex function 
+                                                        readers and writers spin on each other, thus they must not preempt each other 
+                                                        (e.g., threads of a multi-core host). if the compiler does not give the atomics 
+                                                        (see eo_nv_hid_Seqlock_Available()) eo_nvset_New() uses 
+                                                        eo_nvset_protection_one_per_endpoint instead */
 } eOnvset_protection_t;
 
+
+/** @typedef    typedef struct eOnvset_change_t
+    @brief      It describes a change of a netvar applied by a say<> or a sig<> received from the remote board. 
+ **/ 
+typedef struct
+{
+    eOnvID32_t          id32;       /*< the changed netvar */
+    uint32_t            sequence;   /*< the progressive number of the change inside the change queue */
+    eOabstime_t         timestamp;  /*< the local time at which the ropframe w/ the change was received */
+} eOnvset_change_t;
+
+
+/** @typedef    typedef struct eOnvset_snapshot_t
+    @brief      It is a snapshot of the ram of an endpoint pinned with eo_nvset_Snapshot_Pin(). 
+ **/ 
+typedef struct
+{
+    const void*         ram;        /*< the copy of the ram of the endpoint. it has the same layout as eo_nvset_RAMofEndpoint_Get() */
+    uint32_t            generation; /*< the progressive number of the snapshot: it changes only when a new snapshot is published */
+    uint32_t            seq;        /*< used by eo_nvset_Snapshot_Unpin() */
+    uint8_t             buffer;     /*< used by eo_nvset_Snapshot_Unpin() */
+    uint8_t             filler[3];
+} eOnvset_snapshot_t;
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -144,6 +176,38 @@ extern void* eo_nvset_RAMofEntity_Get(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent,
 
 extern void* eo_nvset_RAMofVariable_Get(EOnvSet* p, eOnvID32_t id32);
 
+// the change queue keeps the last capacity changes (rounded up to a power of two) applied by the say<> and sig<> received 
+// from the remote board. it has a single producer (the thread of the receiver) and any number of consumers which never 
+// block it and never block each other: each consumer keeps its own cursor, gets the cursor of the next change with 
+// eo_nvset_ChangeQueue_Cursor_Get() and then drains the changes in batches with eo_nvset_ChangeQueue_Get(). a consumer 
+// which is too slow loses the oldest changes and it is told how many. enable it before the receiver starts.
+extern eOresult_t eo_nvset_ChangeQueue_Enable(EOnvSet* p, uint16_t capacity);
+
+extern uint32_t eo_nvset_ChangeQueue_Cursor_Get(EOnvSet* p);
+
+// returns how many changes are after cursor (at most the capacity) without copying them
+extern uint32_t eo_nvset_ChangeQueue_Pending(EOnvSet* p, uint32_t cursor);
+
+// copies up to maxnumber changes after *cursor into changes[], advances *cursor and returns the number of copied changes.
+// if lost is not NULL it gets the number of changes overwritten by the producer before they could be copied. it stops 
+// before a change which the producer is still writing: the next call gets it.
+extern uint16_t eo_nvset_ChangeQueue_Get(EOnvSet* p, uint32_t* cursor, eOnvset_change_t* changes, uint16_t maxnumber, uint32_t* lost);
+
+// the snapshots of an endpoint are copies of its ram which the receiver publishes after it has applied a whole ropframe 
+// which changes the endpoint. hence the variables inside a snapshot all come from the same ropframes, whereas the ram of 
+// the endpoint may be in the middle of a ropframe. a consumer pins the last snapshot, reads from it as much as it needs 
+// and then unpins it: if eo_nvset_Snapshot_Unpin() returns eobool_false the snapshot was overwritten meanwhile and the 
+// consumer must pin again. the receiver never waits for the consumers: it publishes in a ring of numberofbuffers (at 
+// least 2) copies, thus a consumer has numberofbuffers-1 ropframes of time before its snapshot is overwritten.
+extern eOresult_t eo_nvset_Snapshot_Enable(EOnvSet* p, eOnvEP8_t ep8, uint8_t numberofbuffers);
+
+extern eOresult_t eo_nvset_Snapshot_Pin(EOnvSet* p, eOnvEP8_t ep8, eOnvset_snapshot_t* snapshot);
+
+extern eObool_t eo_nvset_Snapshot_Unpin(EOnvSet* p, eOnvEP8_t ep8, const eOnvset_snapshot_t* snapshot);
+
+// the same as eo_nvset_RAMofEntity_Get() but inside a pinned snapshot
+extern const void* eo_nvset_Snapshot_RAMofEntity_Get(EOnvSet* p, const eOnvset_snapshot_t* snapshot, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index);
+
 
 /** @}            
     end of group eo_nvset 
@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2026 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  iCub Facility
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+
+#include "EoProtocol.h"
+
+#include "EOconstvector_hid.h"
+
+#include "EOnvSet_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOnvSetArena.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface 
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOnvSetArena_hid.h" 
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set() 
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint32_t s_eo_nvsetarena_roundup(uint32_t size);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+ 
+extern EOnvSetArena* eo_nvsetarena_New(const eOnvset_BRDcfg_t* const* cfgofboards, uint8_t numberofboards)
+{
+    EOnvSetArena *p = NULL;
+    uint16_t maxsizeofram[eoprot_endpoints_numberof] = {0};
+    uint32_t totalsize = 0;
+    uint8_t* first = NULL;
+    uint8_t b = 0;
+    uint8_t e = 0;
+    
+    if((NULL == cfgofboards) || (0 == numberofboards))
+    {
+        return(NULL);
+    }
+    
+    // the stride of an endpoint is the biggest ram of that endpoint amongst all the boards
+    for(b=0; b<numberofboards; b++)
+    {
+        uint16_t nendpoints = 0;
+        uint16_t i = 0;
+        
+        if((NULL == cfgofboards[b]) || (NULL == cfgofboards[b]->epcfg_constvect))
+        {
+            continue;
+        }
+        
+        nendpoints = eo_constvector_Size(cfgofboards[b]->epcfg_constvect);
+        for(i=0; i<nendpoints; i++)
+        {
+            eOprot_EPcfg_t* pepcfg = (eOprot_EPcfg_t*) eo_constvector_At(cfgofboards[b]->epcfg_constvect, i);
+            uint16_t sizeofram = 0;
+            
+            if((eobool_false == eoprot_EPcfg_isvalid(pepcfg)) || (pepcfg->endpoint >= eoprot_endpoints_numberof))
+            {
+                continue;
+            }
+            
+            sizeofram = eoprot_EPcfg_sizeof_get(pepcfg);
+            if(sizeofram > maxsizeofram[pepcfg->endpoint])
+            {
+                maxsizeofram[pepcfg->endpoint] = sizeofram;
+            }
+        }        
+    }
+    
+    p = (EOnvSetArena*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(EOnvSetArena), 1);
+    
+    p->numberofslots    = numberofboards;
+    p->slotsinuse       = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, sizeof(uint8_t), numberofboards);
+    memset(p->slotsinuse, 0, numberofboards);
+    
+    for(e=0; e<eoprot_endpoints_numberof; e++)
+    {
+        p->endpoints[e].stride = s_eo_nvsetarena_roundup(maxsizeofram[e]);
+        totalsize += p->endpoints[e].stride * numberofboards;
+    }
+    
+    if(0 == totalsize)
+    {   // no board has any endpoint. the arena is valid but every eo_nvsetarena_hid_Acquire() will fail
+        return(p);
+    }
+    
+    // a single block for everything. i get one more cache line so that i can align the first endpoint to it
+    p->memory = eo_mempool_New(eo_mempool_GetHandle(), totalsize + eo_nvsetarena_cacheline - 1);
+    first = (uint8_t*) (((uintptr_t)p->memory + eo_nvsetarena_cacheline - 1) & ~((uintptr_t)eo_nvsetarena_cacheline - 1));
+    memset(first, 0, totalsize);
+    
+    // the slots of the same endpoint are consecutive
+    for(e=0; e<eoprot_endpoints_numberof; e++)
+    {
+        if(0 != p->endpoints[e].stride)
+        {
+            p->endpoints[e].ram = first;
+            first += p->endpoints[e].stride * numberofboards;
+        }
+    }
+    
+    return(p);
+}
+
+
+extern void eo_nvsetarena_Delete(EOnvSetArena* p)
+{   
+    if(NULL == p)
+    {
+        return;
+    }
+    
+    if(NULL != p->memory)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->memory);
+    }
+    eo_mempool_Delete(eo_mempool_GetHandle(), p->slotsinuse);
+               
+    memset(p, 0, sizeof(EOnvSetArena));
+    
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+    return;
+}
+
+
+extern eOresult_t eo_nvsetarena_Slot_Assign(EOnvSetArena* p, uint8_t slot, EOnvSet* nvset)
+{
+    if((NULL == p) || (NULL == nvset))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(slot >= p->numberofslots)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if(NULL != nvset->theboard.theendpoints)
+    {   // too late: the board is already initted and it may have endpoints with their own ram
+        return(eores_NOK_generic);
+    }
+    
+    nvset->arena        = p;
+    nvset->arenaslot    = slot;
+    
+    return(eores_OK);
+}
+
+
+extern uint8_t eo_nvsetarena_Slots_NumberOf(EOnvSetArena* p)
+{
+    if(NULL == p)
+    {
+        return(0);
+    }
+    
+    return(p->numberofslots);
+}
+
+
+extern void* eo_nvsetarena_RAMofEndpoint_Get(EOnvSetArena* p, uint8_t slot, eOnvEP8_t ep8)
+{
+    if((NULL == p) || (slot >= p->numberofslots) || (ep8 >= eoprot_endpoints_numberof))
+    {
+        return(NULL);
+    }
+    
+    if(NULL == p->endpoints[ep8].ram)
+    {
+        return(NULL);
+    }
+    
+    return(p->endpoints[ep8].ram + slot*p->endpoints[ep8].stride);
+}
+
+
+extern uint32_t eo_nvsetarena_Stride_Get(EOnvSetArena* p, eOnvEP8_t ep8)
+{
+    if((NULL == p) || (ep8 >= eoprot_endpoints_numberof))
+    {
+        return(0);
+    }
+    
+    return(p->endpoints[ep8].stride);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+extern void* eo_nvsetarena_hid_Acquire(EOnvSetArena* p, uint8_t slot, eOnvEP8_t ep8, uint16_t sizeofram)
+{
+    uint8_t* ram = (uint8_t*) eo_nvsetarena_RAMofEndpoint_Get(p, slot, ep8);
+    
+    if(NULL == ram)
+    {
+        return(NULL);
+    }
+    
+    if((sizeofram > p->endpoints[ep8].stride) || (0 != (p->slotsinuse[slot] & (1 << ep8))))
+    {   // the endpoint was configured with more entities than the arena expects or the slot is used by another EOnvSet
+        return(NULL);
+    }
+    
+    p->slotsinuse[slot] |= (1 << ep8);
+    
+    // the slot may have been used before
+    memset(ram, 0, p->endpoints[ep8].stride);
+    
+    return(ram);
+}
+
+
+extern void eo_nvsetarena_hid_Release(EOnvSetArena* p, uint8_t slot, eOnvEP8_t ep8)
+{
+    if((NULL == p) || (slot >= p->numberofslots) || (ep8 >= eoprot_endpoints_numberof))
+    {
+        return;
+    }
+    
+    p->slotsinuse[slot] &= ~(1 << ep8);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint32_t s_eo_nvsetarena_roundup(uint32_t size)
+{
+    return((size + eo_nvsetarena_cacheline - 1) & ~((uint32_t)eo_nvsetarena_cacheline - 1));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
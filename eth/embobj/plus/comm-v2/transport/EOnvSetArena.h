@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  iCub Facility
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EONVSETARENA_H_
+#define _EONVSETARENA_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOnvSetArena.h
+    @brief      This header file implements public interface to a single block of memory which holds the ram of the 
+                endpoints of many EOnvSet objects.
+    @author     iCub Facility
+    @date       10/16/2026
+**/
+
+/** @defgroup eo_nvsetarena EOnvSetArena
+    The EOnvSetArena is used by a host which talks to a fleet of boards, each one with its own EOnvSet. it allocates in one
+    shot the ram of the endpoints of all the boards. the ram is grouped by endpoint: the ram of endpoint ep of all the
+    boards is in consecutive slots, each of them aligned to a cache line and eo_nvsetarena_Stride_Get() bytes apart. 
+    hence a loop on the same endpoint of all the boards (e.g., on all the joints of the robot) walks contiguous memory.
+    
+    usage: create the arena with the configurations of all the boards, then give a slot to each EOnvSet with 
+    eo_nvsetarena_Slot_Assign() before it loads its endpoints. an endpoint which does not fit its slot takes its ram
+    from the EOtheMemoryPool as usual. delete the arena only after all its EOnvSet objects.
+      
+    @{        
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOnvSet.h"
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------    
+
+
+/** @typedef    typedef struct EOnvSetArena_hid EOnvSetArena
+    @brief      EOnvSetArena is an opaque struct. It is used to implement data abstraction for the arena 
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions. 
+ **/  
+typedef struct EOnvSetArena_hid EOnvSetArena;
+
+    
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+/** @fn         extern EOnvSetArena* eo_nvsetarena_New(const eOnvset_BRDcfg_t* const* cfgofboards, uint8_t numberofboards)
+    @brief      creates the arena for numberofboards slots. the slot i is sized for the endpoints of cfgofboards[i], and the
+                stride of each endpoint is given by the board with its biggest ram. 
+    @param      cfgofboards     array of numberofboards configurations. an item can be NULL for a slot without endpoints.
+    @param      numberofboards  the number of slots.
+    @return     the arena or NULL if cfgofboards is NULL or numberofboards is zero.
+ **/
+extern EOnvSetArena* eo_nvsetarena_New(const eOnvset_BRDcfg_t* const* cfgofboards, uint8_t numberofboards);
+
+
+extern void eo_nvsetarena_Delete(EOnvSetArena* p);
+
+
+/** @fn         extern eOresult_t eo_nvsetarena_Slot_Assign(EOnvSetArena* p, uint8_t slot, EOnvSet* nvset)
+    @brief      tells nvset to take the ram of its endpoints from the given slot of the arena. it must be called before
+                eo_nvset_InitBRD() or eo_nvset_InitBRD_LoadEPs().
+    @return     eores_OK or eores_NOK_generic if slot is out of range or if nvset has already initialised its board.
+ **/
+extern eOresult_t eo_nvsetarena_Slot_Assign(EOnvSetArena* p, uint8_t slot, EOnvSet* nvset);
+
+
+extern uint8_t eo_nvsetarena_Slots_NumberOf(EOnvSetArena* p);
+
+// the ram of endpoint ep8 of the given slot or NULL if no board has it. it is all zero until an EOnvSet loads the endpoint.
+extern void* eo_nvsetarena_RAMofEndpoint_Get(EOnvSetArena* p, uint8_t slot, eOnvEP8_t ep8);
+
+// the distance in bytes between the rams of endpoint ep8 of two consecutive slots. it is a multiple of the cache line.
+extern uint32_t eo_nvsetarena_Stride_Get(EOnvSetArena* p, eOnvEP8_t ep8);
+
+
+
+/** @}            
+    end of group eo_nvsetarena 
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  iCub Facility
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EONVSETARENA_HID_H_
+#define _EONVSETARENA_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOnvSetArena_hid.h
+    @brief      This header file implements hidden interface to the arena of the ram of the endpoints.
+    @author     iCub Facility
+    @date       10/16/2026
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoProtocol.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+ 
+#include "EOnvSetArena.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+
+enum { eo_nvsetarena_cacheline = 64 };
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    uint8_t*                        ram;            // the ram of the endpoint in slot 0. the one in slot s is at ram + s*stride
+    uint32_t                        stride;         // a multiple of eo_nvsetarena_cacheline. 0 if no board has the endpoint
+} eOnvsetarena_ep_t;
+
+
+/** @struct     EOnvSetArena_hid
+    @brief      Hidden definition. Implements private data used only internally by the 
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+struct EOnvSetArena_hid 
+{
+    void*                           memory;         // as given by eo_mempool_New(). the endpoints start at the first cache line
+    uint8_t                         numberofslots;
+    uint8_t*                        slotsinuse;     // numberofslots items: bit (1 << ep) is set if an EOnvSet uses the ram of ep
+    eOnvsetarena_ep_t               endpoints[eoprot_endpoints_numberof];
+};   
+ 
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+
+// the EOnvSet calls them from eo_nvset_LoadEP() and when it deinits its endpoints. eo_nvsetarena_hid_Acquire() returns
+// the zeroed ram of ep8 in the slot or NULL if the slot is already used or if sizeofram does not fit the stride.
+extern void* eo_nvsetarena_hid_Acquire(EOnvSetArena* p, uint8_t slot, eOnvEP8_t ep8, uint16_t sizeofram);
+extern void eo_nvsetarena_hid_Release(EOnvSetArena* p, uint8_t slot, eOnvEP8_t ep8);
+ 
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+ 
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
@@ -38,6 +38,8 @@ extern "C" {
 #include "EOvector.h"
 #include "EOconstvector.h"
 #include "EOVmutex.h"
+#include "EOnvSetArena.h"
+
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
  
@@ -49,15 +51,49 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+// what is required to form a netvar and which does not change after the endpoint is loaded. 
+typedef struct
+{
+    EOnv_rom_t*                         rom;
+    void*                               ram;
+    EOVmutexDerived*                    mtx;
+    volatile uint32_t*                  seq;
+} eOnvset_nv_t;
+
+
+// a copy of the ram of an endpoint. its sequence counter is a seqlock (see eo_nv_hid_Seqlock_ReadBegin()).
+typedef struct
+{
+    volatile uint32_t               seq;
+    uint32_t                        generation;         // the number of the publication which has filled the buffer
+    uint8_t*                        ram;
+} eOnvset_snapshotbuffer_t;
+
+
+typedef struct
+{
+    eOnvset_snapshotbuffer_t*       buffers;
+    uint16_t                        sizeofram;
+    uint8_t                         numberof;
+    volatile uint8_t                latest;             // the buffer with the last published snapshot
+    uint32_t                        generation;         // the number of publications so far
+} eOnvset_snapshots_t;
+
+
 typedef struct
 {
     eOprot_EPcfg_t                      epcfg;
     uint16_t                            epnvsnumberof;
     eObool_t                            initted;
-    uint8_t                             dummy; 
+    eObool_t                            epraminarena;                               // the epram is inside the EOnvSetArena of the EOnvSet
     void*                               epram;    
     EOVmutexDerived*                    mtx_endpoint;    
     EOvector*                           themtxofthenvs;    
+    uint32_t*                           theseqofthenvs;                             // epnvsnumberof sequence counters used only by eo_nvset_protection_seqlock
+    eOnvset_snapshots_t*                snapshots;                                  // NULL if not enabled with eo_nvset_Snapshot_Enable()
+    eOnvset_nv_t*                       thenvs;                                     // epnvsnumberof items in order of progressive number
+    uint16_t                            entityprognum[eoprot_maxvalueof_entity+1];  // the progressive number of the first netvar of each entity
+    uint8_t                             entitytags[eoprot_maxvalueof_entity+1];     // the number of tags of each entity. 0 if the entity is not in the endpoint
 } eOnvset_ep_t;
 
 
@@ -74,6 +110,25 @@ typedef struct
 
 
 
+// a slot of the change queue. its sequence counter is a seqlock (see eo_nv_hid_Seqlock_ReadBegin()) so that a consumer 
+// never copies a change while the producer overwrites it.
+typedef struct
+{
+    volatile uint32_t               seq;
+    eOnvset_change_t                change;
+} eOnvset_changeslot_t;
+
+
+typedef struct
+{
+    eOnvset_changeslot_t*           slots;
+    uint32_t                        capacity;           // a power of two
+    volatile uint32_t               head;               // the sequence of the next change. changes before head are complete
+    eOabstime_t                     timeofchanges;      // the timestamp of the changes. it is taken once per received ropframe
+} eOnvset_changequeue_t;
+
+
+
 /** @struct     EOnvSet_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -84,13 +139,25 @@ struct EOnvSet_hid
     eOnvset_brd_t                   theboard;
     eOnvset_protection_t            protection;
     eov_mutex_fn_mutexderived_new   mtxderived_new;
+    eOnvset_changequeue_t*          changequeue;        // NULL if not enabled with eo_nvset_ChangeQueue_Enable()
+    uint8_t                         snapshotsenabled;   // bit (1 << ep) is set if the endpoint has snapshots 
+    uint8_t                         snapshotsdirty;     // bit (1 << ep) is set if the endpoint has changed inside the current ropframe
+    uint8_t                         arenaslot;
+    EOnvSetArena*                   arena;              // NULL if the ram of the endpoints comes from the EOtheMemoryPool
 };   
  
 
 
 
 // - declaration of extern hidden functions ---------------------------------------------------------------------------
-// empty-section
+
+// the receiver calls them for each received ropframe from its single thread: eo_nvset_hid_Ropframe_Begin() before the rops
+// are processed, eo_nvset_hid_NV_Changed() for every netvar changed by a say<> or a sig<>, eo_nvset_hid_Ropframe_End() after.
+// the change is recorded into the change queue (if enabled) and the snapshots of its endpoint (if enabled) are published
+// at the end of the ropframe.
+extern void eo_nvset_hid_Ropframe_Begin(EOnvSet* p);
+extern void eo_nvset_hid_NV_Changed(EOnvSet* p, eOnvID32_t id32);
+extern void eo_nvset_hid_Ropframe_End(EOnvSet* p);
  
 
 #ifdef __cplusplus
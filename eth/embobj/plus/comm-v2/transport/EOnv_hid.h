@@ -44,7 +44,9 @@ extern "C" {
 
 
 // - #define used with hidden struct ----------------------------------------------------------------------------------
-// empty-section
+
+// the number of copies w/ the same writer inside after which a reader of a seqlock stops to retry: it may have preempted it
+#define EONV_SEQLOCK_ATTEMPTS       8
 
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
@@ -73,7 +75,8 @@ struct EOnv_hid                    // 28 bytes ...
     EOnv_rom_t*                     rom;        // pointer to the constant part common to every device which uses this nv
     void*                           ram;        // the ram which keeps the LOCAL value of nv 
     EOVmutexDerived*                mtx;        // the mutex which protects concurrent access to the ram of this nv 
-};  //EO_VERIFYsizeof(EOnv, 28)   
+    volatile uint32_t*              seq;        // the sequence counter which protects the ram instead of mtx. it is odd while a writer is changing the ram. NULL if not used
+};  //EO_VERIFYsizeof(EOnv, 32)   
 
 
 
@@ -87,10 +90,29 @@ struct EOnv_hid                    // 28 bytes ...
 //extern EOnv * eo_nv_hid_New(uint8_t fun, uint8_t typ, uint32_t otherthingsmaybe);
 
 
-extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx);
+extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx, volatile uint32_t* seq);
 
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest);
 
+// the seqlock used by eo_nvset_protection_seqlock. a reader copies the ram after eo_nv_hid_Seqlock_ReadBegin() and repeats 
+// the copy while eo_nv_hid_Seqlock_ReadRetry() returns eobool_true, but it stops when eo_nv_hid_Seqlock_Stalls() has counted
+// EONV_SEQLOCK_ATTEMPTS copies in a row w/ the same writer inside: on a single core it may be the writer which the reader 
+// has preempted. the netvars then fall back to their mutex, which also serialises their writers. a writer changes the ram 
+// between eo_nv_hid_Seqlock_WriteBegin() and eo_nv_hid_Seqlock_WriteEnd(). the writers spin on each other, thus they must 
+// not preempt each other. eo_nv_hid_Seqlock_Available() returns eobool_false if the netvars cannot use it: the compiler 
+// does not give the fences and the compare-and-swap (then the caller must also serialise the writers) or the EOnv does not 
+// use the mutex functions.
+extern eObool_t eo_nv_hid_Seqlock_Available(void);
+extern uint32_t eo_nv_hid_Seqlock_ReadBegin(volatile uint32_t *seq);
+extern eObool_t eo_nv_hid_Seqlock_ReadRetry(volatile uint32_t *seq, uint32_t begin);
+// it returns stalls+1 if the writer which was inside at begin is still inside, else 0. 
+extern uint8_t eo_nv_hid_Seqlock_Stalls(volatile uint32_t *seq, uint32_t begin, uint8_t stalls);
+extern void eo_nv_hid_Seqlock_WriteBegin(volatile uint32_t *seq);
+extern void eo_nv_hid_Seqlock_WriteEnd(volatile uint32_t *seq);
+// as eo_nv_hid_Seqlock_WriteBegin() but for data which only one thread writes, or whose writers are serialised by a mutex,
+// so that it does not need the compare-and-swap. 
+extern void eo_nv_hid_Seqlock_WriteBeginSingle(volatile uint32_t *seq);
+
 extern eObool_t eo_nv_hid_isWritable(const EOnv *netvar);
 extern eObool_t eo_nv_hid_isLocal(const EOnv *netvar);
 extern eObool_t eo_nv_hid_isUpdateable(const EOnv *netvar);
@@ -30,7 +30,6 @@
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
 #include "EOVtheSystem.h"
-#include "EOlist.h"
 
 
 
@@ -64,6 +63,10 @@
 #endif
 
 
+// the index of no item inside the table
+#define EOPROXY_NOITEM      (0xffff)
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
 // --------------------------------------------------------------------------------------------------------------------
@@ -74,19 +77,7 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-
-typedef struct              // 24+24=48
-{
-    eOropdescriptor_t       ropdes; // ropdes.time contains the expiry time ...
-    EOnv                    nv;
-    eOproxy_params_t        params;
-} eo_proxy_ropdes_plus_t;   //EO_VERIFYsizeof(eo_proxy_ropdes_plus_t, 56) 
-
-typedef struct
-{
-    uint32_t    id32;
-    uint32_t    sign;
-} eo_proxy_search_key_t;
+// empty-section
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -99,7 +90,21 @@ static eOresult_t s_eo_proxy_forward_rst(EOproxy *p, EOrop *rop, EOrop *ropout);
 
 static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout);
 
-static eOresult_t s_matching_rule_id32(void *item, void *param);
+static uint16_t s_eo_proxy_hash(EOproxy *p, eOnvID32_t id32);
+
+static uint16_t s_eo_proxy_find(EOproxy *p, eOnvID32_t id32, uint32_t signature);
+
+static void s_eo_proxy_insert(EOproxy *p, const eo_proxy_ropdes_plus_t *ropdesplus);
+
+static void s_eo_proxy_erase(EOproxy *p, uint16_t index);
+
+static void s_eo_proxy_heap_up(EOproxy *p, uint16_t position);
+
+static void s_eo_proxy_heap_down(EOproxy *p, uint16_t position);
+
+static void s_eo_proxy_heap_set(EOproxy *p, uint16_t position, uint16_t index);
+
+static eObool_t s_eo_proxy_heap_less(EOproxy *p, uint16_t pos0, uint16_t pos1);
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -144,11 +149,45 @@ extern EOproxy* eo_proxy_New(const eOproxy_cfg_t *cfg)
     
     memcpy(&retptr->config, cfg, sizeof(eOproxy_cfg_t));
     
-    // i get the list ...
+    // i get the table ...
     
     retptr->transceiver = (EOtransceiver*) cfg->transceiver;
     
-    retptr->listofropdes    = (0 == cfg->capacityoflistofropdes) ? (NULL) : (eo_list_New(sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes, NULL, 0, NULL, NULL));
+    retptr->items       = NULL;
+    retptr->buckets     = NULL;
+    retptr->heap        = NULL;
+    retptr->size        = 0;
+    retptr->freeitem    = EOPROXY_NOITEM;
+    retptr->bucketsbits = 0;
+    memset(&retptr->stats, 0, sizeof(eOproxy_stats_t));
+    
+    if(0 != cfg->capacityoflistofropdes)
+    {
+        uint16_t i = 0;
+        
+        // the buckets are the smallest power of two not lower than the capacity, so that the chains are short. 
+        // the items are chained in order of arrival, thus the oldest ask<> of an id32 is found first.
+        retptr->bucketsbits = 1;
+        while((1UL << retptr->bucketsbits) < cfg->capacityoflistofropdes)
+        {
+            retptr->bucketsbits ++;
+        }
+        
+        retptr->items   = (eo_proxy_ropdes_plus_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes);
+        retptr->buckets = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), 1UL << retptr->bucketsbits);
+        retptr->heap    = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), cfg->capacityoflistofropdes);
+        
+        for(i=0; i<(1UL << retptr->bucketsbits); i++)
+        {
+            retptr->buckets[i] = EOPROXY_NOITEM;
+        }
+        
+        for(i=0; i<cfg->capacityoflistofropdes; i++)
+        {
+            retptr->items[i].next = ((i+1) < cfg->capacityoflistofropdes) ? (i+1) : (EOPROXY_NOITEM);
+        }
+        retptr->freeitem = 0;
+    }
     
     if(NULL != cfg->mutex_fn_new)
     {
@@ -171,9 +210,11 @@ extern void eo_proxy_Delete(EOproxy *p)
         eov_mutex_Delete(p->mtx);
     }
     
-    if(NULL != p->listofropdes)
+    if(NULL != p->items)
     {
-        eo_list_Delete(p->listofropdes);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->heap);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->buckets);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->items);
     }
    
     memset(p, 0, sizeof(EOproxy));
@@ -204,7 +245,7 @@ extern eOresult_t eo_proxy_ROP_Forward(EOproxy *p, EOrop* rop, EOrop* ropout)
     
     if(eobool_false == eo_nv_IsProxied(nv))
     {
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->config.capacityoflistofropdes << 8) | (p->size);
         errdes.par64 = ((uint64_t)rop->ropdes.signature << 32) | (rop->ropdes.id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
         return(eores_NOK_generic);
@@ -236,7 +277,7 @@ extern eOresult_t eo_proxy_ROP_Forward(EOproxy *p, EOrop* rop, EOrop* ropout)
     
     if(eores_OK != res)
     {
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->config.capacityoflistofropdes << 8) | (p->size);
         errdes.par64 = ((uint64_t)rop->ropdes.signature << 32) | (rop->ropdes.id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);       
     }
@@ -245,12 +286,15 @@ extern eOresult_t eo_proxy_ROP_Forward(EOproxy *p, EOrop* rop, EOrop* ropout)
 }
 
 extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
+{
+    return(eo_proxy_Params_GetWithSignature(p, id32, EOK_uint32dummy));
+}
+
+
+extern eOproxy_params_t * eo_proxy_Params_GetWithSignature(EOproxy *p, eOnvID32_t id32, uint32_t signature)
 {
     eOproxy_params_t *par = NULL;
-    
-    EOlistIter* li = NULL;
-    eo_proxy_search_key_t skey = {0};
-    eo_proxy_ropdes_plus_t *item = NULL;
+    uint16_t index = EOPROXY_NOITEM;
     
     eOerrmanDescriptor_t errdes = {0};
 	errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
@@ -258,9 +302,6 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
     errdes.code             = eoerror_code_get(eoerror_category_System, eoerror_value_SYS_proxy_ropdes_notfound);
     errdes.par16            = 0; 
     errdes.par64            = 0; 
-
-    skey.id32 = id32;
-    skey.sign = EOK_uint32dummy;
     
     if(NULL == p)
     {
@@ -270,31 +311,37 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
     
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    li = eo_list_Find(p->listofropdes, s_matching_rule_id32, (void*)&skey);
+    index = s_eo_proxy_find(p, id32, signature);
 
-    if(NULL == li)
-    {   // there is no entry with id32 in the list ... i cannot give teh param back
+    if(EOPROXY_NOITEM == index)
+    {   // there is no entry with id32 in the table ... i cannot give teh param back
+        p->stats.notfound ++;
         eov_mutex_Release(p->mtx);
         
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
-        errdes.par64 = (id32);
+        errdes.par16 = (p->config.capacityoflistofropdes << 8) | (p->size);
+        errdes.par64 = ((uint64_t)signature << 32) | (id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
         
         return(par);
     }
     
-    item = (eo_proxy_ropdes_plus_t*) eo_list_At(p->listofropdes, li);       
+    par = &p->items[index].params;       
     eov_mutex_Release(p->mtx);   
 
-    return(&item->params);   
+    return(par);   
 }
 
 
 extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data)
+{
+    return(eo_proxy_ReplyROP_LoadWithSignature(p, id32, EOK_uint32dummy, data));
+}
+
+
+extern eOresult_t eo_proxy_ReplyROP_LoadWithSignature(EOproxy *p, eOnvID32_t id32, uint32_t signature, void *data)
 {
     eOresult_t res = eores_NOK_generic;
-    EOlistIter* li = NULL;
-    eo_proxy_search_key_t skey = {0};
+    uint16_t index = EOPROXY_NOITEM;
     eo_proxy_ropdes_plus_t *item = NULL;
     eOerrmanDescriptor_t errdes = {0};
 	errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
@@ -302,9 +349,6 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
     errdes.code             = eoerror_code_get(eoerror_category_System, eoerror_value_SYS_proxy_reply_fails);
     errdes.par16            = 0; 
     errdes.par64            = 0; 
-
-    skey.id32 = id32;
-    skey.sign = EOK_uint32dummy;
         
     if(NULL == p)
     {
@@ -314,21 +358,21 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
         
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    li = eo_list_Find(p->listofropdes, s_matching_rule_id32, (void*)&skey);
+    index = s_eo_proxy_find(p, id32, signature);
 
-    if(NULL == li)
-    {   // there is no entry with id32 in the list ... i dont load any reply rop
+    if(EOPROXY_NOITEM == index)
+    {   // there is no entry with id32 in the table ... i dont load any reply rop
+        p->stats.notfound ++;
         eov_mutex_Release(p->mtx);
         
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
-        //errdes.par64 = ((uint64_t)signature << 32) | (id32);
-        errdes.par64 = (id32);
+        errdes.par16 = (p->config.capacityoflistofropdes << 8) | (p->size);
+        errdes.par64 = ((uint64_t)signature << 32) | (id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
         
         return(eores_NOK_generic);
     }
     
-    item = (eo_proxy_ropdes_plus_t*) eo_list_At(p->listofropdes, li);
+    item = &p->items[index];
     
     if(NULL != data)
     {
@@ -341,12 +385,15 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
     if(eores_OK != res)
     {
         errdes.par16 = 0;
-        //errdes.par64 = ((uint64_t)signature << 32) | (id32);
-        errdes.par64 = (id32);
+        errdes.par64 = ((uint64_t)signature << 32) | (id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
     }
+    else
+    {
+        p->stats.replies ++;
+    }
     
-    eo_list_Erase(p->listofropdes, li);
+    s_eo_proxy_erase(p, index);
     
     eov_mutex_Release(p->mtx);
     
@@ -356,7 +403,6 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
     
 extern eOresult_t eo_proxy_Tick(EOproxy *p)
 {   
-    eo_proxy_ropdes_plus_t* item = NULL;
     eOabstime_t timenow = 0;
 
     if(NULL == p)
@@ -368,12 +414,11 @@ extern eOresult_t eo_proxy_Tick(EOproxy *p)
     
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    // i assume that the items are in expiry order, thus i get the front and i keep on removing until timenow is higher than item->ropdes.time          
-    item = (eo_proxy_ropdes_plus_t*) eo_list_Front(p->listofropdes);   
-    while((NULL != item) && (timenow > item->ropdes.time))
+    // the root of the heap expires first: i keep on removing it until timenow is not higher than its ropdes.time          
+    while((p->size > 0) && (timenow > p->items[p->heap[0]].ropdes.time))
     {
-        eo_list_PopFront(p->listofropdes);
-        item = (eo_proxy_ropdes_plus_t*) eo_list_Front(p->listofropdes);
+        s_eo_proxy_erase(p, p->heap[0]);
+        p->stats.timeouts ++;
     }
     
     eov_mutex_Release(p->mtx);
@@ -382,6 +427,21 @@ extern eOresult_t eo_proxy_Tick(EOproxy *p)
 }    
 
 
+extern eOresult_t eo_proxy_Stats_Get(EOproxy *p, eOproxy_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    memcpy(stats, &p->stats, sizeof(eOproxy_stats_t));
+    eov_mutex_Release(p->mtx);
+    
+    return(eores_OK);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -443,13 +503,14 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout)
      
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    if(eobool_true != eo_list_Full(p->listofropdes))
+    if(p->size < p->config.capacityoflistofropdes)
     {   // we can process the ask        
         res = eores_OK;       
     }
     else
     {
         res = eores_NOK_generic;    
+        p->stats.rejected ++;
     }
     
     
@@ -502,9 +563,9 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout)
     // clear the param
     memset(&ropdesplus.params, 0, sizeof(ropdesplus.params));
        
-    // now we insert the item in the list according to expiry time. 
-    // since the timeouts  are all equal, i just append the item at the end of the list
-    eo_list_PushBack(p->listofropdes, &ropdesplus);
+    // now we insert the item in the table and in the expiry heap. 
+    s_eo_proxy_insert(p, &ropdesplus);
+    p->stats.asks ++;
      
     eov_mutex_Release(p->mtx); 
 
@@ -515,23 +576,147 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout)
 }
 
 
-static eOresult_t s_matching_rule_id32(void *item, void *param)
+static uint16_t s_eo_proxy_hash(EOproxy *p, eOnvID32_t id32)
 {
-    eo_proxy_ropdes_plus_t *inside = (eo_proxy_ropdes_plus_t*)item;
-    eo_proxy_search_key_t *skeyptr = (eo_proxy_search_key_t*)param;
-    uint32_t insidesignature = (EOK_uint32dummy == skeyptr->sign) ? (EOK_uint32dummy) : (inside->ropdes.signature);
+    // fibonacci hashing: we keep the most significant bits of the product
+    uint32_t h = (uint32_t)id32 * (uint32_t)2654435761UL;
+    return((uint16_t)(h >> (32 - p->bucketsbits)));
+}
+
 
-    if((inside->ropdes.id32 == skeyptr->id32) && (insidesignature == skeyptr->sign))
+static uint16_t s_eo_proxy_find(EOproxy *p, eOnvID32_t id32, uint32_t signature)
+{
+    uint16_t index = EOPROXY_NOITEM;
+    
+    if(0 == p->size)
     {
-        return(eores_OK);
+        return(EOPROXY_NOITEM);
     }
-    else
+    
+    // if signature is EOK_uint32dummy it is not used, thus we get the oldest ask<> of the id32
+    for(index = p->buckets[s_eo_proxy_hash(p, id32)]; EOPROXY_NOITEM != index; index = p->items[index].next)
     {
-        return(eores_NOK_generic);
+        if((id32 == p->items[index].ropdes.id32) && ((EOK_uint32dummy == signature) || (signature == p->items[index].ropdes.signature)))
+        {
+            return(index);
+        }
+    }
+    
+    return(EOPROXY_NOITEM);
+}
+
+
+static void s_eo_proxy_insert(EOproxy *p, const eo_proxy_ropdes_plus_t *ropdesplus)
+{
+    // we are sure that there is a free item because the caller has checked that size is lower than the capacity
+    uint16_t index = p->freeitem;
+    uint16_t *link = &p->buckets[s_eo_proxy_hash(p, ropdesplus->ropdes.id32)];
+    
+    p->freeitem = p->items[index].next;
+    memcpy(&p->items[index], ropdesplus, sizeof(eo_proxy_ropdes_plus_t));
+    
+    // at the end of its chain so that the chain is in order of arrival
+    while(EOPROXY_NOITEM != *link)
+    {
+        link = &p->items[*link].next;
+    }
+    *link = index;
+    p->items[index].next = EOPROXY_NOITEM;
+    
+    s_eo_proxy_heap_set(p, p->size, index);
+    p->size ++;
+    s_eo_proxy_heap_up(p, p->size - 1);
+}
+
+
+static void s_eo_proxy_erase(EOproxy *p, uint16_t index)
+{
+    uint16_t *link = &p->buckets[s_eo_proxy_hash(p, p->items[index].ropdes.id32)];
+    uint16_t position = p->items[index].heapindex;
+    uint16_t moved = EOPROXY_NOITEM;
+    
+    while(index != *link)
+    {
+        link = &p->items[*link].next;
+    }
+    *link = p->items[index].next;
+    
+    p->items[index].next = p->freeitem;
+    p->freeitem = index;
+    
+    // the last of the heap takes the place of the removed one and then moves down or up
+    p->size --;
+    if(position != p->size)
+    {
+        moved = p->heap[p->size];
+        s_eo_proxy_heap_set(p, position, moved);
+        s_eo_proxy_heap_down(p, position);
+        s_eo_proxy_heap_up(p, p->items[moved].heapindex);
     }
 }
 
 
+static void s_eo_proxy_heap_up(EOproxy *p, uint16_t position)
+{
+    uint16_t parent = 0;
+    uint16_t index = 0;
+    
+    while(position > 0)
+    {
+        parent = (position - 1) / 2;
+        if(eobool_false == s_eo_proxy_heap_less(p, position, parent))
+        {
+            break;
+        }
+        index = p->heap[parent];
+        s_eo_proxy_heap_set(p, parent, p->heap[position]);
+        s_eo_proxy_heap_set(p, position, index);
+        position = parent;
+    }
+}
+
+
+static void s_eo_proxy_heap_down(EOproxy *p, uint16_t position)
+{
+    uint16_t child = 0;
+    uint16_t index = 0;
+    
+    for(;;)
+    {
+        child = 2*position + 1;
+        if(child >= p->size)
+        {
+            break;
+        }
+        if(((child+1) < p->size) && (eobool_true == s_eo_proxy_heap_less(p, child+1, child)))
+        {
+            child ++;
+        }
+        if(eobool_false == s_eo_proxy_heap_less(p, child, position))
+        {
+            break;
+        }
+        index = p->heap[child];
+        s_eo_proxy_heap_set(p, child, p->heap[position]);
+        s_eo_proxy_heap_set(p, position, index);
+        position = child;
+    }
+}
+
+
+static void s_eo_proxy_heap_set(EOproxy *p, uint16_t position, uint16_t index)
+{
+    p->heap[position] = index;
+    p->items[index].heapindex = position;
+}
+
+
+static eObool_t s_eo_proxy_heap_less(EOproxy *p, uint16_t pos0, uint16_t pos1)
+{
+    return((p->items[p->heap[pos0]].ropdes.time < p->items[p->heap[pos1]].ropdes.time) ? (eobool_true) : (eobool_false));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
@@ -83,6 +83,16 @@ typedef struct
     uint16_t    p16_3;
     uint32_t    p32_4;
 } eOproxy_params_t; //EO_VERIFYsizeof(eOproxy_params_t, 8) 
+
+
+typedef struct
+{
+    uint32_t    asks;               // the ask<> accepted by the proxy
+    uint32_t    replies;            // the say<> loaded with eo_proxy_ReplyROP_Load()
+    uint32_t    timeouts;           // the ask<> removed by eo_proxy_Tick() because their reply has not arrived in time
+    uint32_t    rejected;           // the ask<> not accepted because there were already capacityoflistofropdes of them
+    uint32_t    notfound;           // the replies or params requested for an id32 which does not wait
+} eOproxy_stats_t;
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -110,7 +120,7 @@ extern void eo_proxy_Delete(EOproxy *p);
 /** @fn         extern eOresult_t eo_proxy_ROP_Forward(EOproxy *p, EOrop* rop, EOrop* ropout)
     @brief      asks the proxy to forward a rop. that is done by calling the update() function of the
                 relevant netvar. if the rop is of kind ask<>, then the ropdescriptor and the netvar are stored
-                inside an internal list and are assigned a timeout. if within the timeout the reply arrives, the user
+                inside an internal table and are assigned a timeout. if within the timeout the reply arrives, the user
                 calls eo_proxy_ReplyROP_Load() and the say<> is automatically loaded in the transceiver.
     @param      p           the object.
     @param      rop         the rop to forward.
@@ -151,8 +161,30 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32);
 extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data);
 
 
+/** @fn         extern eOresult_t eo_proxy_ReplyROP_LoadWithSignature(EOproxy *p, eOnvID32_t id32, uint32_t signature, void *data)
+    @brief      as eo_proxy_ReplyROP_Load() but it replies to the ask<> with a given signature. many ask<> of the same 
+                id32 can wait at the same time. if signature is EOK_uint32dummy the oldest of them is used.
+    @param      p           the object.
+    @param      id32        the id of the variable.
+    @param      signature   the signature of the ask<>.
+    @param      data        as in eo_proxy_ReplyROP_Load().
+    @return     as in eo_proxy_ReplyROP_Load().    
+ **/
+extern eOresult_t eo_proxy_ReplyROP_LoadWithSignature(EOproxy *p, eOnvID32_t id32, uint32_t signature, void *data);
+
+
+/** @fn         extern eOproxy_params_t * eo_proxy_Params_GetWithSignature(EOproxy *p, eOnvID32_t id32, uint32_t signature)
+    @brief      as eo_proxy_Params_Get() but it retrieves the params of the ask<> with a given signature.
+    @param      p           the object.
+    @param      id32        the id of the variable.
+    @param      signature   the signature of the ask<>. if EOK_uint32dummy the oldest ask<> of id32 is used.
+    @return     the params or NULL if there is no such ask<>.
+ **/
+extern eOproxy_params_t * eo_proxy_Params_GetWithSignature(EOproxy *p, eOnvID32_t id32, uint32_t signature); 
+
+
 /** @fn         extern eOresult_t eo_proxy_Tick(EOproxy *p)
-    @brief      it must be called now and then to update the internal list of rop-descriptors waiting to be sent back.
+    @brief      it must be called now and then to update the internal table of rop-descriptors waiting to be sent back.
                 it internally retrieves the current time and removes ropdescriptors which has passed beyond timeout.
     @param      p           the object.
     @return     eores_NOK_nullpointer if any argument is NULL, eores_NOK_generic if the netvar canot be proxied,
@@ -161,6 +193,15 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
 extern eOresult_t eo_proxy_Tick(EOproxy *p);
 
 
+/** @fn         extern eOresult_t eo_proxy_Stats_Get(EOproxy *p, eOproxy_stats_t *stats)
+    @brief      gives back the counters of the ask<> managed by the proxy since its creation.
+    @param      p           the object.
+    @param      stats       the counters.
+    @return     eores_NOK_nullpointer if any argument is NULL, or eores_OK on success.    
+ **/
+extern eOresult_t eo_proxy_Stats_Get(EOproxy *p, eOproxy_stats_t *stats);
+
+
 
 
 
@@ -34,7 +34,7 @@ extern "C" {
 // - external dependencies --------------------------------------------------------------------------------------------
 
 #include "EoCommon.h"
-#include "EOlist.h"
+#include "EOnv_hid.h"
 #include "EOVmutex.h"
 #include "EOtransceiver.h"
 
@@ -57,12 +57,28 @@ extern "C" {
                 used also by its derived objects.
  **/  
  
+typedef struct
+{
+    eOropdescriptor_t       ropdes;         // ropdes.time contains the expiry time ...
+    EOnv                    nv;
+    eOproxy_params_t        params;
+    uint16_t                next;           // the next item with the same hash of id32 (in order of arrival) or the next free one
+    uint16_t                heapindex;      // the position inside the expiry heap
+} eo_proxy_ropdes_plus_t;  
+
+
 struct EOproxy_hid 
 {
-    eOproxy_cfg_t       config;
-    EOtransceiver*      transceiver;
-    EOlist*             listofropdes;
-    EOVmutexDerived*    mtx;           
+    eOproxy_cfg_t           config;
+    EOtransceiver*          transceiver;
+    eo_proxy_ropdes_plus_t* items;          // capacityoflistofropdes items
+    uint16_t*               buckets;        // the first item of each hash of id32
+    uint16_t*               heap;           // the waiting items as a min-heap of expiry time
+    uint16_t                size;           // the waiting items
+    uint16_t                freeitem;       // the first free item
+    uint8_t                 bucketsbits;    // log2 of the number of buckets
+    EOVmutexDerived*        mtx;           
+    eOproxy_stats_t         stats;
 }; 
 
 
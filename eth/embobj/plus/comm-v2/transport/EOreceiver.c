@@ -26,6 +26,11 @@
 #include "EOtheMemoryPool.h"
 #include "EOtheParser.h"
 #include "EOtheFormer.h"
+#include "EOnvSet_hid.h"
+#include "EOropframe_hid.h"
+#include "EOtransportStats_hid.h"
+#include "EOrop_hid.h"
+#include "EOVtheSystem.h"
 
 
 
@@ -71,6 +76,20 @@ static void s_eo_receiver_on_error_invalidframe(EOreceiver* p);
 
 static void s_eo_receiver_on_error_seqnumber(EOreceiver* p);
 
+static eOresult_t s_eo_receiver_process(EOreceiver *p, EOpacket *packet, uint16_t *numberofrops, eOabstime_t *transmittedtime);
+
+static eOnanotime_t s_eo_receiver_nanotime(EOreceiver *p);
+
+static eObool_t s_eo_receiver_stats_copy(EOreceiver *p, eOreceiver_stats_t *stats);
+
+static void s_eo_receiver_stats_rop(EOreceiver *p, eOnanotime_t nanosec);
+
+static void s_eo_receiver_latency_update(EOreceiver *p, uint64_t seqnum, eOabstime_t ageofframe);
+
+static int s_eo_receiver_latency_compare(const void *a, const void *b);
+
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -91,7 +110,8 @@ const eOreceiver_cfg_t eo_receiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)          NULL,
         EO_INIT(.onerrorinvalidframe)       NULL
-    } 
+    },
+    EO_INIT(.zerocopy)                      eobool_false 
 };
 
 
@@ -127,6 +147,10 @@ extern EOreceiver* eo_receiver_New(const eOreceiver_cfg_t *cfg)
     memset(&retptr->error_invalidframe, 0, sizeof(retptr->error_invalidframe)); // even if it is already zero. 
     retptr->on_error_seqnumber  = cfg->extfn.onerrorseqnumber;
     retptr->on_error_invalidframe = cfg->extfn.onerrorinvalidframe;
+    retptr->remoteusescrc       = eobool_false;
+    retptr->zerocopy            = cfg->zerocopy;
+    memset(&retptr->stats, 0, sizeof(retptr->stats));
+    retptr->latencytracker      = NULL;
     // now we need to allocate the buffer for the ropframereply
 
 #if defined(USE_DEBUG_EORECEIVER)    
@@ -152,6 +176,12 @@ extern void eo_receiver_Delete(EOreceiver *p)
         return;
     }
     
+    if(NULL != p->latencytracker)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->latencytracker->samples);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->latencytracker);
+    }
+    
     eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframereply);
     eo_rop_Delete(p->ropreply);
     eo_rop_Delete(p->ropinput);
@@ -167,6 +197,425 @@ extern void eo_receiver_Delete(EOreceiver *p)
 
 
 extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t *numberofrops, eObool_t *thereisareply, eOabstime_t *transmittedtime)
+{
+    eOresult_t res;
+    
+    if((NULL == p) || (NULL == packet)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    
+    // clear the ropframereply w/ eo_ropframe_Clear(). the clear operation also makes it safe to manipulate p->ropframereplay with *_quickversion
+    
+    eo_ropframe_Clear(p->ropframereply);
+    
+    res = s_eo_receiver_process(p, packet, numberofrops, transmittedtime);
+    
+    // if any rop inside ropframereply w/ eo_ropframe_ROP_NumberOf() then sets thereisareply  
+    if(NULL != thereisareply)
+    {
+        *thereisareply = (0 == eo_ropframe_ROP_NumberOf(p->ropframereply)) ? (eobool_false) : (eobool_true);
+        // dont use the quickversion because it may be that ropframereply is dummy
+        //*thereisareply = (0 == eo_ropframe_ROP_NumberOf_quickversion(p->ropframereply)) ? (eobool_false) : (eobool_true);
+    } 
+    
+    return(res);   
+}
+
+
+extern eOresult_t eo_receiver_ProcessBatch(EOreceiver *p, EOpacket **packets, uint16_t numberofpackets, eOreceiver_result_t *results, eObool_t *thereisareply)
+{
+    uint16_t i;
+    uint16_t numofvalidpackets = 0;
+    eOreceiver_result_t r;
+    
+    if((NULL == p) || (NULL == packets)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // the ropframereply is cleared only once, so that it collects the replies of all the packets in the batch.
+    // if it fills up, the replies which do not fit are lost exactly as in eo_receiver_Process() 
+    eo_ropframe_Clear(p->ropframereply);
+    
+    for(i=0; i<numberofpackets; i++)
+    {
+        r.numberofrops = 0;
+        r.transmittedtime = 0;
+        r.filler = 0;
+        
+        if(NULL == packets[i])
+        {
+            r.result = eores_NOK_nullpointer;
+        }
+        else
+        {
+            r.result = s_eo_receiver_process(p, packets[i], &r.numberofrops, &r.transmittedtime);
+        }
+        
+        if(eores_OK == r.result)
+        {
+            numofvalidpackets++;
+        }
+        
+        if(NULL != results)
+        {
+            results[i] = r;
+        }
+    }
+    
+    if(NULL != thereisareply)
+    {
+        *thereisareply = (0 == eo_ropframe_ROP_NumberOf(p->ropframereply)) ? (eobool_false) : (eobool_true);
+    }
+    
+    return((numofvalidpackets == numberofpackets) ? (eores_OK) : (eores_NOK_generic));  
+}
+
+
+extern eOresult_t eo_receiver_GetReply(EOreceiver *p, EOropframe **ropframereply)
+{
+    if((NULL == p) || (NULL == ropframereply)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(0 == eo_ropframe_ROP_NumberOf(p->ropframereply))
+    {
+        *ropframereply  = p->ropframereply;
+        return(eores_NOK_generic);
+    }
+    
+    *ropframereply  = p->ropframereply;
+    
+    return(eores_OK);
+}  
+
+extern const eOreceiver_seqnum_error_t * eo_receiver_GetSequenceNumberError(EOreceiver *p)
+{
+    if(NULL == p) 
+    {
+        return(NULL);
+    }  
+
+    return(&p->error_seqnumber);   
+}
+
+extern const eOreceiver_invalidframe_error_t * eo_receiver_GetInvalidFrameError(EOreceiver *p)
+{
+    if(NULL == p) 
+    {
+        return(NULL);
+    }  
+
+    return(&p->error_invalidframe);        
+}
+
+
+extern eObool_t eo_receiver_RemoteUsesCRC(EOreceiver *p)
+{
+    if(NULL == p) 
+    {
+        return(eobool_false);
+    }  
+
+    return(p->remoteusescrc);        
+}
+
+
+extern eOresult_t eo_receiver_Stats_Get(EOreceiver *p, eOreceiver_stats_t *stats)
+{
+    uint32_t begin = 0;
+    uint32_t *value = NULL;
+    const uint32_t *base = NULL;
+    uint16_t i = 0;
+    uint8_t attempts = 0;
+    
+    if((NULL == p) || (NULL == stats)) 
+    {
+        return(eores_NOK_nullpointer);
+    }  
+    
+    // all the fields are uint32_t counters: the difference with the baseline is correct also after a wrap around
+    for(attempts=0; attempts<EONV_SEQLOCK_ATTEMPTS; attempts=eo_nv_hid_Seqlock_Stalls(&p->stats.seqofbaseline, begin, attempts))
+    {
+        if(eobool_false == s_eo_receiver_stats_copy(p, stats))
+        {
+            break;
+        }
+        begin = eo_nv_hid_Seqlock_ReadBegin(&p->stats.seqofbaseline);
+        value = (uint32_t*)stats;
+        base = (const uint32_t*)&p->stats.baseline;
+        for(i=0; i<sizeof(eOreceiver_stats_t)/sizeof(uint32_t); i++)
+        {
+            value[i] -= base[i];
+        }
+        if(eobool_false == eo_nv_hid_Seqlock_ReadRetry(&p->stats.seqofbaseline, begin))
+        {
+            return(eores_OK);
+        }
+    }
+
+    // we may have preempted the writer: the caller can try again later
+    return(eores_NOK_busy);        
+}
+
+
+extern eOresult_t eo_receiver_Stats_Reset(EOreceiver *p)
+{
+    eOreceiver_stats_t current;
+    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    } 
+    
+    // we dont touch current, which belongs to the thread of the receiver
+    if(eobool_false == s_eo_receiver_stats_copy(p, &current))
+    {
+        return(eores_NOK_busy);
+    }
+    
+    eo_nv_hid_Seqlock_WriteBegin(&p->stats.seqofbaseline);
+    memcpy(&p->stats.baseline, &current, sizeof(eOreceiver_stats_t));
+    eo_nv_hid_Seqlock_WriteEnd(&p->stats.seqofbaseline);
+
+    return(eores_OK);        
+}
+
+
+extern eOresult_t eo_receiver_Stats_Timing_Enable(EOreceiver *p, eObool_t enable)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    } 
+    
+    p->stats.timing = enable;
+
+    return(eores_OK);        
+}
+
+
+extern eOresult_t eo_receiver_Latency_Enable(EOreceiver *p, uint16_t windowsize)
+{
+    eOreceiver_latencytracker_t *t = NULL;
+    uint32_t size = 2;
+    
+    if((NULL == p) || (0 == windowsize)) 
+    {
+        return(eores_NOK_nullpointer);
+    } 
+    
+    if(NULL != p->latencytracker)
+    {   // already enabled
+        return(eores_NOK_generic); 
+    }
+    
+    // a power of two so that the position of a sample is just a mask of the head
+    while(size < windowsize)
+    {
+        size <<= 1;
+    }
+    
+    t = (eOreceiver_latencytracker_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOreceiver_latencytracker_t), 1);
+    memset(t, 0, sizeof(eOreceiver_latencytracker_t));
+    t->samples = (eOreceiver_latency_sample_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOreceiver_latency_sample_t), size);
+    t->capacity = size;
+    
+    p->latencytracker = t;
+
+    return(eores_OK);        
+}
+
+
+extern eOresult_t eo_receiver_Latency_Reset(EOreceiver *p)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    } 
+    
+    if(NULL == p->latencytracker)
+    {
+        return(eores_NOK_generic); 
+    }
+    
+    // the thread of the receiver does it, so that the tracker keeps a single writer
+    p->latencytracker->resetrequested = eobool_true;
+
+    return(eores_OK);        
+}
+
+
+extern uint32_t eo_receiver_Latency_SizeOfWorkspace(EOreceiver *p)
+{
+    if((NULL == p) || (NULL == p->latencytracker)) 
+    {
+        return(0);
+    } 
+    
+    // the copy of the samples and then their latencies
+    return(p->latencytracker->capacity * (sizeof(eOreceiver_latency_sample_t) + sizeof(uint32_t)));
+}
+
+
+extern eOresult_t eo_receiver_Latency_Get(EOreceiver *p, eOreceiver_latency_t *latency, void *workspace, uint32_t sizeofworkspace)
+{
+    eOreceiver_latencytracker_t *t = NULL;
+    eOreceiver_latency_sample_t *copyofsamples = NULL;
+    uint32_t *latencies = NULL;
+    uint32_t begin = 0;
+    uint32_t head = 0;
+    uint32_t first = 0;
+    uint32_t n = 0;
+    uint32_t i = 0;
+    uint64_t sum = 0;
+    uint64_t sumofintervals = 0;
+    int64_t delay = 0;
+    eOabstime_t interval = 0;
+    const eOreceiver_latency_sample_t *sample = NULL;
+    const eOreceiver_latency_sample_t *previous = NULL;
+    uint8_t attempts = 0;
+    
+    if((NULL == p) || (NULL == latency) || (NULL == workspace)) 
+    {
+        return(eores_NOK_nullpointer);
+    } 
+    
+    if((NULL == p->latencytracker) || (sizeofworkspace < eo_receiver_Latency_SizeOfWorkspace(p)))
+    {
+        return(eores_NOK_generic); 
+    }
+    
+    t = p->latencytracker;
+    
+    // the workspace belongs to the caller, thus concurrent callers dont share anything but the seqlock
+    copyofsamples = (eOreceiver_latency_sample_t*) workspace;
+    latencies = (uint32_t*) &copyofsamples[t->capacity];
+    
+    // we copy only the samples inside the window and in order of reception: the oldest is at position first of the ring
+    for(attempts=0; attempts<EONV_SEQLOCK_ATTEMPTS; attempts=eo_nv_hid_Seqlock_Stalls(&t->seq, begin, attempts))
+    {
+        begin = eo_nv_hid_Seqlock_ReadBegin(&t->seq);
+        memcpy(latency, &t->latency, sizeof(eOreceiver_latency_t));
+        head = t->head;
+        n = (head < t->capacity) ? (head) : (t->capacity);
+        first = (head - n) & (t->capacity - 1);
+        i = ((first + n) > t->capacity) ? (t->capacity - first) : (n);
+        memcpy(copyofsamples, &t->samples[first], i*sizeof(eOreceiver_latency_sample_t));
+        memcpy(&copyofsamples[i], t->samples, (n - i)*sizeof(eOreceiver_latency_sample_t));
+        if(eobool_false == eo_nv_hid_Seqlock_ReadRetry(&t->seq, begin))
+        {
+            break;
+        }
+    }
+    
+    if(EONV_SEQLOCK_ATTEMPTS == attempts)
+    {   // we may have preempted the thread of the receiver
+        return(eores_NOK_busy);
+    }
+    
+    latency->samples = n;
+    
+    if(0 == n)
+    {
+        return(eores_OK);
+    }
+    
+    // the minimum of the delays is the offset of the clocks plus the minimum latency, which we cannot tell apart
+    latency->clockoffset = INT64_MAX;
+    for(i=0; i<n; i++)
+    {
+        sample = &copyofsamples[i];
+        delay = (int64_t)(sample->rxtime - sample->txtime);
+        if(delay < latency->clockoffset)
+        {
+            latency->clockoffset = delay;
+        }
+    }
+    
+    // we go in order of reception for the intervals
+    for(i=0; i<n; i++)
+    {
+        sample = &copyofsamples[i];
+        delay = (int64_t)(sample->rxtime - sample->txtime) - latency->clockoffset;
+        latencies[i] = (delay > (int64_t)UINT32_MAX) ? (UINT32_MAX) : ((uint32_t)delay);
+        sum += latencies[i];
+        
+        if(NULL != previous)
+        {
+            interval = sample->rxtime - previous->rxtime;
+            sumofintervals += interval;
+            if(interval > latency->intervalmax)
+            {
+                latency->intervalmax = (interval > UINT32_MAX) ? (UINT32_MAX) : ((uint32_t)interval);
+            }
+        }
+        previous = sample;
+    }
+    
+    qsort(latencies, n, sizeof(uint32_t), s_eo_receiver_latency_compare);
+    
+    latency->latencymean = (uint32_t)(sum / n);
+    latency->latencyp50 = latencies[(n-1)*50/100];
+    latency->latencyp90 = latencies[(n-1)*90/100];
+    latency->latencyp99 = latencies[(n-1)*99/100];
+    latency->latencymax = latencies[n-1];
+    latency->intervalmean = (n > 1) ? ((uint32_t)(sumofintervals / (n-1))) : (0);
+
+    return(eores_OK);        
+}
+
+
+
+
+
+// extern eOresult_t eo_receiver_set_fn_on_seqnumber_error(EOreceiver *p, eOvoid_fp_uint32_uint64_uint64_t onerrorseqnumber)
+// {
+//     if(NULL == p) 
+//     {
+//         return(eores_NOK_nullpointer);
+//     }
+//     p->on_error_seqnumber = onerrorseqnumber;
+//     
+//     return(eores_OK);
+// }
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions 
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eo_receiver_on_error_invalidframe(EOreceiver* p)
+{
+    if(NULL != p->on_error_invalidframe)
+    {
+        p->on_error_invalidframe(p);
+    }        
+}
+
+
+static void s_eo_receiver_on_error_seqnumber(EOreceiver* p)
+{
+    if(NULL != p->on_error_seqnumber)
+    {
+        p->on_error_seqnumber(p);
+    } 
+}
+
+
+static eOresult_t s_eo_receiver_process(EOreceiver *p, EOpacket *packet, uint16_t *numberofrops, eOabstime_t *transmittedtime)
 {
     uint16_t rxremainingbytes = 0;
     uint16_t txremainingbytes = 0;
@@ -181,18 +630,16 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
     uint64_t rec_seqnum;
     uint64_t rec_ageoframe;
     uint16_t numofprocessedrops = 0;
+    uint16_t numoflostreplies = 0;
+    uint8_t numoferrorsinseqnum = 0;
+    eOnanotime_t timeofstart = 0;
+    eOnanotime_t timeofparsing = 0;
+    eOnanotime_t timeofrop = 0;
 
     
-    if((NULL == p) || (NULL == packet)) 
-    {
-        return(eores_NOK_nullpointer);
-    }
-    
-    
-    // clear the ropframereply w/ eo_ropframe_Clear(). the clear operation also makes it safe to manipulate p->ropframereplay with *_quickversion
-    
-    eo_ropframe_Clear(p->ropframereply);
+    timeofstart = s_eo_receiver_nanotime(p);
     
+    // the ropframereply is not cleared in here: the caller does it, so that many packets can pile their replies in it
     
     // we get the ip address and port of the incoming packet.
     // the remaddr can be any. however, if the eo_receiver_Process() is called by the EOtransceiver, it will be only the one of the remotehost
@@ -208,25 +655,35 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
     eo_packet_Capacity_Get(packet, &capacity);
     eo_ropframe_Load(p->ropframeinput, payload, size, capacity);
     
-    // verify if the ropframeinput is valid w/ eo_ropframe_IsValid()
-    if(eobool_false == eo_ropframe_IsValid(p->ropframeinput))
+    // verify if the ropframeinput is valid w/ eo_ropframe_ROPs_AreValid(), which also checks the heads of all its rops. 
+    // in this way a bad ropframe is rejected before any rop is processed and any callback is executed.
+    if(eobool_false == eo_ropframe_ROPs_AreValid(p->ropframeinput))
     {
 #if defined(USE_DEBUG_EORECEIVER)         
         {   // DEBUG
             p->debug.rxinvalidropframes ++;
         }
 #endif  
+        eo_nv_hid_Seqlock_WriteBeginSingle(&p->stats.seq);
+        p->stats.current.ropframesrejected ++;
+        if(eobool_true == p->stats.timing)
+        {
+            p->stats.current.timeofparsing[eo_transportstats_hid_Timebin(s_eo_receiver_nanotime(p) - timeofstart)] ++;
+        }
+        eo_nv_hid_Seqlock_WriteEnd(&p->stats.seq);
+        
         p->error_invalidframe.remipv4addr = remipv4addr;
         p->error_invalidframe.ropframe = p->ropframeinput;
         s_eo_receiver_on_error_invalidframe(p);
         
-        if(NULL != thereisareply)
-        {
-            *thereisareply = eobool_false;
-        }
         return(eores_NOK_generic);
     }
     
+    timeofparsing = s_eo_receiver_nanotime(p) - timeofstart;
+    
+    // the remote tells in every ropframe if it uses the crc. in this way our transmitter can follow it.
+    p->remoteusescrc = eo_ropframe_CRC_IsUsed(p->ropframeinput);
+    
     
     // check sequence number
     
@@ -248,6 +705,7 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
                 p->debug.errorsinsequencenumber ++;
             }
 #endif  
+            numoferrorsinseqnum = 1;
             // must set values
             p->error_seqnumber.remipv4addr = remipv4addr;
             p->error_seqnumber.rec_seqnum = rec_seqnum;
@@ -261,9 +719,17 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
         p->tx_ageofframe = rec_ageoframe;
     }
     
+    if(NULL != p->latencytracker)
+    {
+        s_eo_receiver_latency_update(p, rec_seqnum, rec_ageoframe);
+    }
+    
 
     nrops = eo_ropframe_ROP_NumberOf_quickversion(p->ropframeinput);
     
+    // the changes of the netvars which the rops of this ropframe apply have the same timestamp
+    eo_nvset_hid_Ropframe_Begin(eo_agent_GetNVset(p->agent));
+    
     for(i=0; i<nrops; i++)
     {
         // - get the rop w/ eo_ropframe_ROP_Parse()
@@ -272,7 +738,16 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
         // in all cases rxremainingbytes contains the number of bytes we still need to parse. in case of 
         // unrecoverable error in the ropframe res is NOK and rxremainingbytes is 0.
         
-        res = eo_ropframe_ROP_Parse(p->ropframeinput, p->ropinput, &rxremainingbytes);
+        // in zerocopy mode the data of ropinput is not copied: its ropdes points inside the packet, which does not 
+        // change until we return
+        if(eobool_true == p->zerocopy)
+        {
+            res = eo_ropframe_ROP_Parse_zerocopy(p->ropframeinput, p->ropinput, &rxremainingbytes);
+        }
+        else
+        {
+            res = eo_ropframe_ROP_Parse(p->ropframeinput, p->ropinput, &rxremainingbytes);
+        }
                 
         if(eores_OK == res)
         {   // we have a valid ropinput
@@ -280,13 +755,20 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
             numofprocessedrops++;
 
             // - use the agent w/ eo_agent_InpROPprocess() and retrieve the ropreply.      
+            timeofrop = s_eo_receiver_nanotime(p);
             eo_agent_InpROPprocess(p->agent, p->ropinput, remipv4addr, p->ropreply);
+            s_eo_receiver_stats_rop(p, s_eo_receiver_nanotime(p) - timeofrop);
             
             // - if ropreply is ok w/ eo_rop_GetROPcode() then add it to ropframereply w/ eo_ropframe_ROP_Add()           
             if(eo_ropcode_none != eo_rop_GetROPcode(p->ropreply))
             {
                 res = eo_ropframe_ROP_Add(p->ropframereply, p->ropreply, NULL, NULL, &txremainingbytes);
                 
+                if(eores_OK != res)
+                {
+                    numoflostreplies++;
+                }
+                
                 #if defined(USE_DEBUG_EORECEIVER)             
                 {   // DEBUG
                     if(eores_OK != res)
@@ -305,6 +787,22 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
             break;
         }        
     }
+    
+    // the whole ropframe is applied: the snapshots of the changed endpoints (if any) can be published
+    eo_nvset_hid_Ropframe_End(eo_agent_GetNVset(p->agent));
+    
+    eo_nv_hid_Seqlock_WriteBeginSingle(&p->stats.seq);
+    p->stats.current.ropframes ++;
+    p->stats.current.bytes += size;
+    p->stats.current.errorsinsequencenumber += numoferrorsinseqnum;
+    p->stats.current.lostreplies += numoflostreplies;
+    if(eobool_true == p->stats.timing)
+    {
+        p->stats.current.timeofparsing[eo_transportstats_hid_Timebin(timeofparsing)] ++;
+        p->stats.current.timeofropframes[eo_transportstats_hid_Timebin(s_eo_receiver_nanotime(p) - timeofstart)] ++;
+    }
+    eo_nv_hid_Seqlock_WriteEnd(&p->stats.seq);
+
 
     
     if(NULL != numberofrops)
@@ -312,14 +810,6 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
         *numberofrops = numofprocessedrops;
     }
 
-    // if any rop inside ropframereply w/ eo_ropframe_ROP_NumberOf() then sets thereisareply  
-    if(NULL != thereisareply)
-    {
-        *thereisareply = (0 == eo_ropframe_ROP_NumberOf(p->ropframereply)) ? (eobool_false) : (eobool_true);
-        // dont use the quickversion because it may be that ropframereply is dummy
-        //*thereisareply = (0 == eo_ropframe_ROP_NumberOf_quickversion(p->ropframereply)) ? (eobool_false) : (eobool_true);
-    } 
-    
     if(NULL != transmittedtime)
     {
         *transmittedtime = eo_ropframe_age_Get(p->ropframeinput);
@@ -329,88 +819,159 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
 }
 
 
-static void s_eo_receiver_on_error_invalidframe(EOreceiver* p)
+// it returns 0 if the histograms of times are not enabled, so that we dont pay for the nanotime
+static eOnanotime_t s_eo_receiver_nanotime(EOreceiver *p)
 {
-    if(NULL != p->on_error_invalidframe)
+    eOnanotime_t nanotime = 0;
+    
+    if(eobool_true == p->stats.timing)
     {
-        p->on_error_invalidframe(p);
-    }        
+        eov_sys_NanoTimeGet(eov_sys_GetHandle(), &nanotime);
+    }
+    
+    return(nanotime);
 }
 
 
-static void s_eo_receiver_on_error_seqnumber(EOreceiver* p)
+// it returns eobool_false if it does not get a consistent copy, e.g., because it has preempted the thread of the receiver 
+static eObool_t s_eo_receiver_stats_copy(EOreceiver *p, eOreceiver_stats_t *stats)
 {
-    if(NULL != p->on_error_seqnumber)
+    uint32_t begin = 0;
+    uint8_t attempts = 0;
+    
+    for(attempts=0; attempts<EONV_SEQLOCK_ATTEMPTS; attempts=eo_nv_hid_Seqlock_Stalls(&p->stats.seq, begin, attempts))
     {
-        p->on_error_seqnumber(p);
-    } 
+        begin = eo_nv_hid_Seqlock_ReadBegin(&p->stats.seq);
+        memcpy(stats, &p->stats.current, sizeof(eOreceiver_stats_t));
+        if(eobool_false == eo_nv_hid_Seqlock_ReadRetry(&p->stats.seq, begin))
+        {
+            return(eobool_true);
+        }
+    }
+    
+    return(eobool_false);
 }
 
 
-extern eOresult_t eo_receiver_GetReply(EOreceiver *p, EOropframe **ropframereply)
+// it counts the rop which the agent has just processed inside p->ropinput. nanosec is used only if p->stats.timing
+static void s_eo_receiver_stats_rop(EOreceiver *p, eOnanotime_t nanosec)
 {
-    if((NULL == p) || (NULL == ropframereply)) 
+    eOprotEndpoint_t ep = eoprot_ID2endpoint(p->ropinput->stream.head.id32);
+    eOropcode_t ropc = (eOropcode_t)p->ropinput->stream.head.ropc;
+    eOreceiver_stats_rop_t *ropstats = NULL;
+    
+    eo_nv_hid_Seqlock_WriteBeginSingle(&p->stats.seq);
+    
+    if((ep < eoprot_endpoints_numberof) && (ropc < eo_receiver_stats_ropcodes))
     {
-        return(eores_NOK_nullpointer);
+        ropstats = &p->stats.current.rops[ep][ropc];
+        ropstats->rops ++;
+        ropstats->bytes += eo_rop_GetSize(p->ropinput);
+        if(eobool_true == p->stats.timing)
+        {
+            ropstats->timeofprocessing[eo_transportstats_hid_Timebin(nanosec)] ++;
+        }
     }
-    
-    if(0 == eo_ropframe_ROP_NumberOf(p->ropframereply))
+    else
     {
-        *ropframereply  = p->ropframereply;
-        return(eores_NOK_generic);
+        p->stats.current.ropsofotherendpoints ++;
     }
     
-    *ropframereply  = p->ropframereply;
-    
-    return(eores_OK);
-}  
-
-extern const eOreceiver_seqnum_error_t * eo_receiver_GetSequenceNumberError(EOreceiver *p)
-{
-    if(NULL == p) 
-    {
-        return(NULL);
-    }  
-
-    return(&p->error_seqnumber);   
+    eo_nv_hid_Seqlock_WriteEnd(&p->stats.seq);
 }
 
-extern const eOreceiver_invalidframe_error_t * eo_receiver_GetInvalidFrameError(EOreceiver *p)
+
+static void s_eo_receiver_latency_update(EOreceiver *p, uint64_t seqnum, eOabstime_t ageofframe)
 {
-    if(NULL == p) 
+    eOreceiver_latencytracker_t *t = p->latencytracker;
+    eOreceiver_latency_sample_t *sample = NULL;
+    const eOreceiver_latency_sample_t *previous = NULL;
+    eOabstime_t now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    uint64_t delta = 0;
+    int64_t d = 0;
+    
+    eo_nv_hid_Seqlock_WriteBeginSingle(&t->seq);
+    
+    if(eobool_true == t->resetrequested)
     {
-        return(NULL);
-    }  
-
-    return(&p->error_invalidframe);        
+        t->resetrequested = eobool_false;
+        memset(&t->latency, 0, sizeof(t->latency));
+        t->head = 0;
+        t->jitter16 = 0;
+    }
+    
+    // the sequence number. the bits of received tell duplicates from late ropframes in the last 64
+    if(0 == t->latency.frames)
+    {
+        t->highestseqnum = seqnum;
+        t->received = 1;
+    }
+    else if(seqnum > t->highestseqnum)
+    {
+        delta = seqnum - t->highestseqnum;
+        if(1 == delta)
+        {
+            t->latency.inorder ++;
+        }
+        else
+        {
+            t->latency.gaps ++;
+            t->latency.lost += (uint32_t)(delta - 1);
+        }
+        t->received = (delta >= 64) ? (1) : ((t->received << delta) | 1);
+        t->highestseqnum = seqnum;
+    }
+    else
+    {
+        delta = t->highestseqnum - seqnum;
+        if((delta < 64) && (0 != (t->received & (1ULL << delta))))
+        {
+            t->latency.duplicates ++;
+        }
+        else
+        {   // it was counted as lost, unless it is too old to know
+            t->latency.reorderings ++;
+            if(delta < 64)
+            {
+                t->received |= (1ULL << delta);
+                if(t->latency.lost > 0)
+                {
+                    t->latency.lost --;
+                }
+            }
+        }
+    }
+    t->latency.frames ++;
+    
+    // the interarrival jitter of RFC 3550: J += (|D| - J)/16, where D is the difference of the intervals at the two sides
+    if(0 != t->head)
+    {
+        previous = &t->samples[(t->head - 1) & (t->capacity - 1)];
+        d = (int64_t)(now - previous->rxtime) - (int64_t)(ageofframe - previous->txtime);
+        d = (d < 0) ? (-d) : (d);
+        d = (d > 0x0fffffff) ? (0x0fffffff) : (d);
+        t->jitter16 = t->jitter16 + (uint32_t)d - ((t->jitter16 + 8) >> 4);
+        t->latency.jitter = t->jitter16 >> 4;
+    }
+    
+    sample = &t->samples[t->head & (t->capacity - 1)];
+    sample->rxtime = now;
+    sample->txtime = ageofframe;
+    t->head ++;
+    
+    eo_nv_hid_Seqlock_WriteEnd(&t->seq);
 }
 
 
-// extern eOresult_t eo_receiver_set_fn_on_seqnumber_error(EOreceiver *p, eOvoid_fp_uint32_uint64_uint64_t onerrorseqnumber)
-// {
-//     if(NULL == p) 
-//     {
-//         return(eores_NOK_nullpointer);
-//     }
-//     p->on_error_seqnumber = onerrorseqnumber;
-//     
-//     return(eores_OK);
-// }
-
-
-
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of extern hidden functions 
-// --------------------------------------------------------------------------------------------------------------------
-// empty-section
-
-
+static int s_eo_receiver_latency_compare(const void *a, const void *b)
+{
+    uint32_t va = *((const uint32_t*)a);
+    uint32_t vb = *((const uint32_t*)b);
+    
+    return((va > vb) - (va < vb));
+}
 
 
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of static functions 
-// --------------------------------------------------------------------------------------------------------------------
-// empty-section
 
 
 // --------------------------------------------------------------------------------------------------------------------
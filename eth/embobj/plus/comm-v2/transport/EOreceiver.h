@@ -42,11 +42,13 @@ extern "C" {
 
 #include "EoCommon.h"
 #include "EOropframe.h"
+#include "EOtransportStats.h"
 #include "EOpacket.h"
 #include "EOnvSet.h"
 #include "EOconfirmationManager.h"
 #include "EOproxy.h"
 #include "EOagent.h"
+#include "EoProtocol.h"
 
 
 
@@ -102,9 +104,84 @@ typedef struct
     eOreceiver_sizes_t      sizes;
     EOagent*                agent;
     eOreceiver_extfn_t      extfn;
+    eObool_t                zerocopy;           // the data of the received rops is not copied: eo_rop_GetROPdata() is not valid for them
 } eOreceiver_cfg_t;
 
 
+/** @typedef    typedef struct eOreceiver_result_t
+    @brief      contains the outcome of the processing of a single packet inside eo_receiver_ProcessBatch()
+ **/
+typedef struct
+{
+    eOabstime_t             transmittedtime;    /**< the age of frame written by the sender */
+    eOresult_t              result;             /**< the same value eo_receiver_Process() would return for the packet */
+    uint16_t                numberofrops;       /**< the number of processed rops */
+    uint16_t                filler;
+} eOreceiver_result_t;
+
+
+/** @typedef    typedef struct eOreceiver_stats_rop_t
+    @brief      contains the statistics of the rops of a given endpoint and ropcode
+ **/
+typedef struct
+{
+    uint32_t                rops;               /**< the processed rops */
+    uint32_t                bytes;              /**< their size: head, data, signature and time */
+    uint32_t                timeofprocessing[eo_transportstats_timebins_numberof];    /**< histogram of the time of the agent, callbacks included */
+} eOreceiver_stats_rop_t;
+
+
+enum { eo_receiver_stats_ropcodes = eo_ropcode_rst+1 };
+
+
+/** @typedef    typedef struct eOreceiver_stats_t
+    @brief      contains the statistics of the receiver since its creation or since the last eo_receiver_Stats_Reset(). 
+                all its fields are uint32_t counters which wrap around. the histograms of times are filled only when 
+                enabled with eo_receiver_Stats_Timing_Enable().
+ **/
+typedef struct
+{
+    uint32_t                ropframes;              /**< the valid ropframes */
+    uint32_t                bytes;                  /**< their size */
+    uint32_t                ropframesrejected;      /**< the ropframes rejected by eo_ropframe_ROPs_AreValid() */
+    uint32_t                errorsinsequencenumber; 
+    uint32_t                lostreplies;            /**< the replies which did not fit inside the ropframe of replies */
+    uint32_t                ropsofotherendpoints;   /**< the processed rops whose endpoint is not inside rops[] */
+    uint32_t                timeofparsing[eo_transportstats_timebins_numberof];   /**< histogram of the time of eo_ropframe_ROPs_AreValid() */
+    uint32_t                timeofropframes[eo_transportstats_timebins_numberof]; /**< histogram of the time of the whole valid ropframe */
+    eOreceiver_stats_rop_t  rops[eoprot_endpoints_numberof][eo_receiver_stats_ropcodes];
+} eOreceiver_stats_t;
+
+
+/** @typedef    typedef struct eOreceiver_latency_t
+    @brief      contains what the latency tracker knows about the ropframes of the remote since eo_receiver_Latency_Enable() 
+                or since the last eo_receiver_Latency_Reset(). the values from samples onwards are computed over the window 
+                of the last ropframes. all times are in usec.
+ **/
+typedef struct
+{
+    uint32_t                frames;             /**< the valid ropframes */
+    uint32_t                inorder;            /**< the ropframes with the sequence number which follows the highest one received */
+    uint32_t                gaps;               /**< the times the sequence number has jumped forward */
+    uint32_t                lost;               /**< the ropframes missing in those jumps which have not arrived later */
+    uint32_t                duplicates;         /**< the ropframes with a sequence number already received */
+    uint32_t                reorderings;        /**< the ropframes which have arrived after one with a higher sequence number */
+    uint32_t                jitter;             /**< the interarrival jitter as in RFC 3550 */
+    uint32_t                samples;            /**< the ropframes inside the window */
+    int64_t                 clockoffset;        /**< the minimum of local time of reception - age of frame: offset of the clocks + minimum latency */
+    uint32_t                latencymean;        /**< the latency above the minimum one, which is included in clockoffset */
+    uint32_t                latencyp50;
+    uint32_t                latencyp90;
+    uint32_t                latencyp99;
+    uint32_t                latencymax;
+    uint32_t                intervalmean;       /**< the time between the reception of two consecutive ropframes */
+    uint32_t                intervalmax;
+    uint32_t                filler;
+} eOreceiver_latency_t;
+
+
+
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -145,6 +222,21 @@ extern void eo_receiver_Delete(EOreceiver *p);
 extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t *numberofrops, eObool_t *thereisareply, eOabstime_t *transmittedtime);
 
 
+/** @fn         extern eOresult_t eo_receiver_ProcessBatch(EOreceiver *p, EOpacket **packets, uint16_t numberofpackets, eOreceiver_result_t *results, eObool_t *thereisareply)
+    @brief      Processes a batch of received packets in the given order, as if eo_receiver_Process() were called on each of them,
+                but the reply frame is cleared only once at the start so that it collects the replies of all the packets.
+                The sequence number check is done packet by packet, hence the packets must be in order of reception.   
+    @param      p               the object.
+    @param      packets         array of numberofpackets received packets. a NULL entry gives a eores_NOK_nullpointer result.
+    @param      numberofpackets the number of packets
+    @param      results         if not NULL it must have numberofpackets items and it is filled with the outcome of each packet.
+    @param      thereisareply   if not NULL its contains information about the presence of a reply frame which shall be retrieved
+                                with the eo_receiver_GetReply() method.
+    @return     eores_OK only if all the packets are valid, eores_NOK_generic if any is not, eores_NOK_nullpointer if p or packets are NULL.
+ **/
+extern eOresult_t eo_receiver_ProcessBatch(EOreceiver *p, EOpacket **packets, uint16_t numberofpackets, eOreceiver_result_t *results, eObool_t *thereisareply);
+
+
 /** @fn         extern eOresult_t eo_receiver_GetReply(EOreceiver *p, EOropframe **ropframereply, eOipv4addr_t *ipv4addr, eOipv4port_t *ipv4port)
     @brief      returns the frame to be transmitted back and the destination ip address and port.
     @param      p               the object.
@@ -158,6 +250,58 @@ extern const eOreceiver_seqnum_error_t * eo_receiver_GetSequenceNumberError(EOre
 
 extern const eOreceiver_invalidframe_error_t * eo_receiver_GetInvalidFrameError(EOreceiver *p);
 
+// it tells if the last valid ropframe received from the remote had the CRC32C footer (see eo_ropframe_CRC_Seal()).
+extern eObool_t eo_receiver_RemoteUsesCRC(EOreceiver *p);
+
+
+/** @fn         extern eOresult_t eo_receiver_Stats_Get(EOreceiver *p, eOreceiver_stats_t *stats)
+    @brief      copies the statistics of the receiver. the counters are always collected, the histograms of times 
+                only if enabled with eo_receiver_Stats_Timing_Enable(). the copy is consistent even if it is done by 
+                another thread while the receiver processes a packet.
+    @param      p               the object.
+    @param      stats           in output it contains the statistics since the last eo_receiver_Stats_Reset().
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_busy if the receiver was updating the statistics all along
+                (e.g., the caller has preempted it). in such a case the caller can try again later.
+ **/
+extern eOresult_t eo_receiver_Stats_Get(EOreceiver *p, eOreceiver_stats_t *stats);
+
+
+/** @fn         extern eOresult_t eo_receiver_Stats_Reset(EOreceiver *p)
+    @brief      restarts the statistics of the receiver from zero. it can be called by any thread, but two threads which
+                call it must not preempt each other.
+    @param      p               the object.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_busy as eo_receiver_Stats_Get().
+ **/
+extern eOresult_t eo_receiver_Stats_Reset(EOreceiver *p);
+
+
+/** @fn         extern eOresult_t eo_receiver_Stats_Timing_Enable(EOreceiver *p, eObool_t enable)
+    @brief      enables or disables the histograms of times. they are disabled by default because they need two 
+                readings of the nanotime for each rop.
+    @param      p               the object.
+    @param      enable          eobool_true to enable.
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eo_receiver_Stats_Timing_Enable(EOreceiver *p, eObool_t enable);
+
+
+// the latency tracker correlates the age of frame written by the remote with the local time of reception of each valid 
+// ropframe and classifies its sequence number. as the seqnum check, it assumes that the receiver serves a single remote.
+// it keeps the last windowsize ropframes (rounded up to a power of two). enable it before the receiver starts. 
+extern eOresult_t eo_receiver_Latency_Enable(EOreceiver *p, uint16_t windowsize);
+
+// the tracker restarts from zero at the next received ropframe. it can be called by any thread.
+extern eOresult_t eo_receiver_Latency_Reset(EOreceiver *p);
+
+// the bytes of the workspace which eo_receiver_Latency_Get() needs, 0 if the tracker is not enabled.
+extern uint32_t eo_receiver_Latency_SizeOfWorkspace(EOreceiver *p);
+
+// it can be called by any thread while the receiver works. the workspace is where it copies and sorts the samples: it 
+// must be aligned to 64 bits, have at least eo_receiver_Latency_SizeOfWorkspace() bytes and not be shared by concurrent 
+// callers. it returns eores_NOK_generic if the tracker is not enabled or the workspace is too small, and eores_NOK_busy 
+// if the receiver was updating it all along.
+extern eOresult_t eo_receiver_Latency_Get(EOreceiver *p, eOreceiver_latency_t *latency, void *workspace, uint32_t sizeofworkspace);
+
 
 /** @}            
     end of group eo_receiver  
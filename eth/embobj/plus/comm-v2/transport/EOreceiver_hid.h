@@ -61,6 +61,41 @@ typedef struct
     uint32_t    lostreplies;
 } EOreceiverDEBUG_t;
 
+
+// the statistics are written only by the thread of the receiver (see eo_nv_hid_Seqlock_WriteBeginSingle()) and copied by
+// any thread. current and baseline have a seqlock each. what eo_receiver_Stats_Get() returns is current - baseline.
+typedef struct
+{
+    volatile uint32_t           seq;
+    eOreceiver_stats_t          current;
+    volatile uint32_t           seqofbaseline;
+    eOreceiver_stats_t          baseline;       // the value of current at the last eo_receiver_Stats_Reset()
+    eObool_t                    timing;
+} eOreceiver_statistics_t;
+
+
+typedef struct
+{
+    eOabstime_t                     rxtime;         // the local time of reception
+    eOabstime_t                     txtime;         // the age of frame written by the remote
+} eOreceiver_latency_sample_t;
+
+
+// the latency tracker is written only by the thread of the receiver. its seqlock protects the ring of samples and the 
+// counters, which are the first fields of latency. 
+typedef struct
+{
+    volatile uint32_t               seq;
+    eOreceiver_latency_t            latency;
+    eOreceiver_latency_sample_t*    samples;        // a ring of capacity items
+    uint32_t                        capacity;       // a power of two
+    uint32_t                        head;           // the number of samples written so far
+    uint64_t                        highestseqnum;  
+    uint64_t                        received;       // bit i is set if the ropframe with highestseqnum - i has been received
+    uint32_t                        jitter16;       // the interarrival jitter in 1/16 of usec
+    volatile eObool_t               resetrequested;
+} eOreceiver_latencytracker_t;
+
 /** @struct     EOreceiver_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -83,6 +118,10 @@ struct EOreceiver_hid
     eOreceiver_invalidframe_error_t error_invalidframe;
     eOreceiver_void_fp_obj_t    on_error_seqnumber;    
     eOreceiver_void_fp_obj_t    on_error_invalidframe;
+    eObool_t                    remoteusescrc;      // the last valid ropframe had the CRC32C footer
+    eObool_t                    zerocopy;           // the rops are parsed w/ eo_ropframe_ROP_Parse_zerocopy()
+    eOreceiver_statistics_t     stats;
+    eOreceiver_latencytracker_t* latencytracker; // NULL if not enabled with eo_receiver_Latency_Enable()
 #if defined(USE_DEBUG_EORECEIVER)      
     EOreceiverDEBUG_t           debug;
 #endif    
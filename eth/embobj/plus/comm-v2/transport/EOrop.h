@@ -203,7 +203,8 @@ extern eOropcode_t eo_rop_GetROPcode(EOrop *p);
 
 
 /** @fn         extern uint8_t* eo_rop_GetROPdata(EOrop *p)
-    @brief      Returns the ROP data.
+    @brief      Returns the ROP data. It is not valid for a rop parsed w/ eo_ropframe_ROP_Parse_zerocopy(), whose data 
+                is only in its ropdes.
     @param      p           The EOrop object 
     @return     The data if the object is valid, or NULL if invalid
  **/
@@ -30,6 +30,12 @@
 
 #include "EOrop_hid.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+// on the host the CRC32C of the ropframe uses the crc32 instruction of SSE4.2 if the cpu has it. on the boards we use a table.
+#define EOROPFRAME_CRC32C_SSE42
+#include <nmmintrin.h>
+#endif
+
 
 
 
@@ -104,6 +110,13 @@ static void s_eo_ropframe_header_remrop(EOropframe *p, uint16_t sizeofrop);
 static void s_eo_ropframe_header_addrops(EOropframe *p, uint16_t numofrops, uint16_t sizeofrops);
 static void s_eo_ropframe_header_clr(EOropframe *p);
 static void s_eo_ropframe_footer_adjust(EOropframe *p);
+static eOresult_t s_eo_ropframe_rop_parse(EOropframe *p, EOrop *rop, uint16_t *unparsedbytes, eObool_t zerocopy);
+static eObool_t s_eo_ropframe_footer_isvalid(EOropframe *p);
+static uint32_t s_eo_ropframe_crc_compute(EOropframe *p);
+static uint32_t s_eo_ropframe_crc32c_table(uint32_t crc, const uint8_t *data, uint16_t size);
+#if defined(EOROPFRAME_CRC32C_SSE42)
+static uint32_t s_eo_ropframe_crc32c_sse42(uint32_t crc, const uint8_t *data, uint16_t size);
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -112,6 +125,47 @@ static void s_eo_ropframe_footer_adjust(EOropframe *p);
 
 static const char s_eobj_ownname[] = "EOropframe";
 
+// the table of the CRC32C w/ reflected polynomial 0x82F63B78
+static const uint32_t s_eo_ropframe_crc32c_lut[256] =
+{
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351
+};
+
+#if defined(EOROPFRAME_CRC32C_SSE42)
+static int8_t s_eo_ropframe_crc32c_hw = -1;         // -1 is not yet known, 0 is no SSE4.2, 1 is SSE4.2
+#endif
+
 //static const uint16_t s_eo_ropframe_minimum_framesize = eo_ropframe_sizeforZEROrops;
 //(sizeof(EOropframeHeader_t)+sizeof(EOropframeFooter_t));
 
@@ -319,28 +373,12 @@ extern eOresult_t eo_ropframe_Append(EOropframe *p, EOropframe *rfr, uint16_t *r
 
 extern eObool_t eo_ropframe_IsValid(EOropframe *p)
 {
-    EOropframeHeader_t *header;
-    EOropframeFooter_t *footer;
-    
     if((NULL == p) || (NULL == p->framedata)) 
     {
         return(eobool_false);
     }
-
-    header = s_eo_ropframe_header_get(p);
-    footer = s_eo_ropframe_footer_get(p);
-    
-    if(EOFRAME_START != header->startofframe)
-    {
-        return(eobool_false);
-    }
-       
-    if(EOFRAME_END != footer->endoframe)
-    {
-        return(eobool_false);
-    }
     
-    return(eobool_true);
+    return(s_eo_ropframe_footer_isvalid(p));
 }
 
 extern uint16_t eo_ropframe_ROP_NumberOf(EOropframe *p)
@@ -363,77 +401,60 @@ extern uint16_t eo_ropframe_ROP_NumberOf_quickversion(EOropframe *p)
 
 extern eOresult_t eo_ropframe_ROP_Parse(EOropframe *p, EOrop *rop, uint16_t *unparsedbytes)
 {
+    return(s_eo_ropframe_rop_parse(p, rop, unparsedbytes, eobool_false));
+}
+
+
+extern eOresult_t eo_ropframe_ROP_Parse_zerocopy(EOropframe *p, EOrop *rop, uint16_t *unparsedbytes)
+{
+    return(s_eo_ropframe_rop_parse(p, rop, unparsedbytes, eobool_true));
+}
+
+
+extern eObool_t eo_ropframe_ROPs_AreValid(EOropframe *p)
+{
+    EOropframeHeader_t *header;
+    const uint8_t *rops = NULL;
+    uint16_t sizeofrops = 0;
+    uint16_t index = 0;
+    uint16_t numberofrops = 0;
     uint16_t consumedbytes = 0;
-    eOresult_t res = eores_NOK_generic;
-    uint16_t unparsed = 0;
-    uint8_t * ropstream = NULL;
     eOparserResult_t parsres = eo_parser_res_ok;
+    EOtheParser *parser = eo_parser_GetHandle();
     
-    if((NULL == p) || (NULL == rop)) 
+    if((NULL == p) || (NULL == p->framedata)) 
     {
-        return(eores_NOK_nullpointer);
+        return(eobool_false);
     }
-        
-    unparsed = s_eo_ropframe_sizeofrops_get(p) - p->index2nextrop2beparsed;
+
+    header = s_eo_ropframe_header_get(p);
+    sizeofrops = header->ropssizeof;
     
-    if(0 == unparsed)
+    // the header comes from the network: before we use ropssizeof to reach the footer we verify it is inside the loaded frame
+    if((eo_ropframe_sizeforZEROrops + (uint32_t)sizeofrops) > p->size)
     {
-        // cannot parse anymore ...
-        eo_rop_Reset(rop);
-
-        if(NULL != unparsedbytes)
-        {
-            *unparsedbytes = 0;
-        }        
-        return(eores_NOK_generic);
+        return(eobool_false);
     }
     
-    // get the ropstream starting from p->index2nextrop2beparsed. call the parser
-    
-    ropstream = s_eo_ropframe_rops_get(p);
-    ropstream += p->index2nextrop2beparsed;
-   
-    // this function fills the rop only if everything is ok. it returns error if it cannot prepare a valid rop
-    // in consumedbytes it tells how many bytes it has used. in some case if the ropstream is strongly illegal
-    // an it cannot go to next rop, consumedbytes is equal to unparsed, so that we have to quit.
-    res = eo_parser_GetROP(eo_parser_GetHandle(), ropstream, unparsed, rop, &consumedbytes, &parsres);
+    if(eobool_false == s_eo_ropframe_footer_isvalid(p))
+    {
+        return(eobool_false);
+    }
     
-    if(eores_OK != res)
-    { 
-        eOerrmanDescriptor_t errdes = {0};
-
-        // in case of failure, at first reset the rop. then ... it is possible to go on unless there are some serious problems, such as NULL pointer.
-        eo_rop_Reset(rop);
-            
-        errdes.code             = eo_errman_code_sys_ropparsingerror;
-        errdes.par16            = parsres;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0;           
-        
-        if(eores_NOK_nullpointer == res)
+    // a walk of the heads of the rops only: every rop must be well formed, they must fill exactly ropssizeof bytes
+    // and be ropsnumberof. nothing is copied.
+    rops = s_eo_ropframe_rops_get(p);
+    while(index < sizeofrops)
+    {
+        if(eores_OK != eo_parser_CheckROP(parser, &rops[index], sizeofrops - index, &consumedbytes, &parsres))
         {
-            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_ropframe_ROP_Parse(): eo_parser_GetROP() called w/ NULL params", s_eobj_ownname, &errdes);          
+            return(eobool_false);
         }
-        
-        // for all other errors the parser tells us how many bytes consume. 
-        // they may be those of the single rop or also those of the entire stream. 
-        // thus we go on ...   
-     
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_ropframe_ROP_Parse(): eo_parser_GetROP() had problems", s_eobj_ownname, &errdes);         
+        index += consumedbytes;
+        numberofrops ++;
     }
     
-    // advance the internal index2nextrop2beparsed
-    p->index2nextrop2beparsed += consumedbytes;
-  
-    // returns the number of un-parsed bytes
-    if(NULL != unparsedbytes)
-    {
-        *unparsedbytes = s_eo_ropframe_sizeofrops_get(p) - p->index2nextrop2beparsed;
-    }
-
-    // then ... returns the result: OK or NOK.
-
-    return(res);
+    return((numberofrops == header->ropsnumberof) ? (eobool_true) : (eobool_false));
 }
 
 //extern eObool_t eo_ropframe_ROP_CanAdd(EOropframe *p, const EOrop *rop)
@@ -550,6 +571,12 @@ extern eOresult_t eo_ropframe_ROP_Add(EOropframe *p, const EOrop *rop, uint16_t*
 
 
 extern eOresult_t eo_ropframe_ROPdata_Add(EOropframe *p, uint8_t* data, uint16_t size, uint16_t *remainingbytes)
+{
+    return(eo_ropframe_ROPsdata_Add(p, data, size, 1, remainingbytes));
+}
+
+
+extern eOresult_t eo_ropframe_ROPsdata_Add(EOropframe *p, uint8_t* data, uint16_t size, uint16_t numberofrops, uint16_t *remainingbytes)
 {    
     uint8_t* ropstream = NULL;
     int32_t remaining = 0;
@@ -557,7 +584,7 @@ extern eOresult_t eo_ropframe_ROPdata_Add(EOropframe *p, uint8_t* data, uint16_t
     uint16_t streamindex = 0;
     //eOresult_t res = eores_NOK_generic;
     
-    if((NULL == p) || (NULL == data) || (0 == size)) 
+    if((NULL == p) || (NULL == data) || (0 == size) || (0 == numberofrops)) 
     {
         return(eores_NOK_nullpointer);
     }
@@ -589,7 +616,7 @@ extern eOresult_t eo_ropframe_ROPdata_Add(EOropframe *p, uint8_t* data, uint16_t
     p->size  += size;
     
     // adjust the header
-    s_eo_ropframe_header_addrop(p, size);
+    s_eo_ropframe_header_addrops(p, numberofrops, size);
 
     // adjust the footer
     s_eo_ropframe_footer_adjust(p);
@@ -748,6 +775,36 @@ extern uint64_t eo_ropframe_seqnum_Get(EOropframe *p)
     return(header->sequencenumber);
 }
 
+
+extern eOresult_t eo_ropframe_CRC_Seal(EOropframe *p)
+{
+    EOropframeHeader_t* header = NULL;
+    
+    if((NULL == p) || (NULL == p->framedata)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    header = s_eo_ropframe_header_get(p);
+    
+    // the crc covers also the startofframe, thus we change it before
+    header->startofframe = EOFRAME_STARTwithCRC;
+    s_eo_ropframe_footer_get(p)->endoframe = s_eo_ropframe_crc_compute(p);
+    
+    return(eores_OK);
+}
+
+
+extern eObool_t eo_ropframe_CRC_IsUsed(EOropframe *p)
+{
+    if((NULL == p) || (NULL == p->framedata)) 
+    {
+        return(eobool_false);
+    }
+    
+    return((EOFRAME_STARTwithCRC == s_eo_ropframe_header_get(p)->startofframe) ? (eobool_true) : (eobool_false));
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -763,6 +820,73 @@ uint8_t* eo_ropframe_hid_get_pointer_offset(EOropframe *p, uint16_t offset)
 }
 
 
+uint8_t* eo_ropframe_hid_get_rops(EOropframe *p, uint16_t *sizeofrops, uint16_t *numberofrops)
+{
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+    
+    *sizeofrops     = s_eo_ropframe_sizeofrops_get(p);
+    *numberofrops   = s_eo_ropframe_numberofrops_get(p);
+    
+    return(s_eo_ropframe_rops_get(p));
+}
+
+
+eOresult_t eo_ropframe_hid_rops_Shrink(EOropframe *p, uint16_t sizeofrops, uint16_t numberofrops)
+{
+    EOropframeHeader_t* header = NULL;
+    uint16_t removed = 0;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(sizeofrops > s_eo_ropframe_sizeofrops_get(p))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    removed = s_eo_ropframe_sizeofrops_get(p) - sizeofrops;
+    
+    header = s_eo_ropframe_header_get(p);
+    header->ropssizeof      = sizeofrops;
+    header->ropsnumberof    = numberofrops;
+    
+    p->size -= removed;
+    
+    s_eo_ropframe_footer_adjust(p);
+    
+    // as in eo_ropframe_ROP_Rem(): clear what was used beyond the footer
+    memset(((uint8_t*)s_eo_ropframe_footer_get(p))+sizeof(EOropframeFooter_t), 0, removed);
+    
+    return(eores_OK);
+}
+
+
+uint32_t eo_ropframe_hid_crc32c(uint32_t crc, const uint8_t *data, uint16_t size)
+{
+    crc = ~crc;
+    
+#if defined(EOROPFRAME_CRC32C_SSE42)
+    if(-1 == s_eo_ropframe_crc32c_hw)
+    {   // a concurrent first call just does the same assignment twice
+        __builtin_cpu_init();
+        s_eo_ropframe_crc32c_hw = (__builtin_cpu_supports("sse4.2")) ? (1) : (0);
+    }
+    
+    if(1 == s_eo_ropframe_crc32c_hw)
+    {
+        return(~s_eo_ropframe_crc32c_sse42(crc, data, size));
+    }
+#endif
+
+    return(~s_eo_ropframe_crc32c_table(crc, data, size));
+}
+
+
 
 
 
@@ -770,6 +894,88 @@ uint8_t* eo_ropframe_hid_get_pointer_offset(EOropframe *p, uint16_t offset)
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
 
+static eOresult_t s_eo_ropframe_rop_parse(EOropframe *p, EOrop *rop, uint16_t *unparsedbytes, eObool_t zerocopy)
+{
+    uint16_t consumedbytes = 0;
+    eOresult_t res = eores_NOK_generic;
+    uint16_t unparsed = 0;
+    uint8_t * ropstream = NULL;
+    eOparserResult_t parsres = eo_parser_res_ok;
+    
+    if((NULL == p) || (NULL == rop)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+        
+    unparsed = s_eo_ropframe_sizeofrops_get(p) - p->index2nextrop2beparsed;
+    
+    if(0 == unparsed)
+    {
+        // cannot parse anymore ...
+        eo_rop_Reset(rop);
+
+        if(NULL != unparsedbytes)
+        {
+            *unparsedbytes = 0;
+        }        
+        return(eores_NOK_generic);
+    }
+    
+    // get the ropstream starting from p->index2nextrop2beparsed. call the parser
+    
+    ropstream = s_eo_ropframe_rops_get(p);
+    ropstream += p->index2nextrop2beparsed;
+   
+    // this function fills the rop only if everything is ok. it returns error if it cannot prepare a valid rop
+    // in consumedbytes it tells how many bytes it has used. in some case if the ropstream is strongly illegal
+    // an it cannot go to next rop, consumedbytes is equal to unparsed, so that we have to quit.
+    if(eobool_true == zerocopy)
+    {
+        res = eo_parser_GetROP_zerocopy(eo_parser_GetHandle(), ropstream, unparsed, rop, &consumedbytes, &parsres);
+    }
+    else
+    {
+        res = eo_parser_GetROP(eo_parser_GetHandle(), ropstream, unparsed, rop, &consumedbytes, &parsres);
+    }
+    
+    if(eores_OK != res)
+    { 
+        eOerrmanDescriptor_t errdes = {0};
+
+        // in case of failure, at first reset the rop. then ... it is possible to go on unless there are some serious problems, such as NULL pointer.
+        eo_rop_Reset(rop);
+            
+        errdes.code             = eo_errman_code_sys_ropparsingerror;
+        errdes.par16            = parsres;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;           
+        
+        if(eores_NOK_nullpointer == res)
+        {
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_ropframe_ROP_Parse(): eo_parser_GetROP() called w/ NULL params", s_eobj_ownname, &errdes);          
+        }
+        
+        // for all other errors the parser tells us how many bytes consume. 
+        // they may be those of the single rop or also those of the entire stream. 
+        // thus we go on ...   
+     
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_ropframe_ROP_Parse(): eo_parser_GetROP() had problems", s_eobj_ownname, &errdes);         
+    }
+    
+    // advance the internal index2nextrop2beparsed
+    p->index2nextrop2beparsed += consumedbytes;
+  
+    // returns the number of un-parsed bytes
+    if(NULL != unparsedbytes)
+    {
+        *unparsedbytes = s_eo_ropframe_sizeofrops_get(p) - p->index2nextrop2beparsed;
+    }
+
+    // then ... returns the result: OK or NOK.
+
+    return(res);
+}
+
 
 static void s_eo_ropframe_header_addrop(EOropframe *p, uint16_t sizeofrop)
 {
@@ -810,10 +1016,93 @@ static void s_eo_ropframe_footer_adjust(EOropframe *p)
 {
     EOropframeFooter_t* footer = s_eo_ropframe_footer_get(p);
     
+    // the rops have changed: if the ropframe was sealed w/ eo_ropframe_CRC_Seal() it goes back to the plain footer
+    s_eo_ropframe_header_get(p)->startofframe = EOFRAME_START;
     footer->endoframe               = EOFRAME_END;
 }
 
 
+static eObool_t s_eo_ropframe_footer_isvalid(EOropframe *p)
+{
+    EOropframeHeader_t* header = s_eo_ropframe_header_get(p);
+    
+    if(EOFRAME_START == header->startofframe)
+    {
+        return((EOFRAME_END == s_eo_ropframe_footer_get(p)->endoframe) ? (eobool_true) : (eobool_false));
+    }
+    
+    if(EOFRAME_STARTwithCRC == header->startofframe)
+    {
+        // the crc is computed on header and rops, thus they must be inside the loaded frame
+        if((eo_ropframe_sizeforZEROrops + (uint32_t)header->ropssizeof) > p->size)
+        {
+            return(eobool_false);
+        }
+        return((s_eo_ropframe_crc_compute(p) == s_eo_ropframe_footer_get(p)->endoframe) ? (eobool_true) : (eobool_false));
+    }
+    
+    return(eobool_false);
+}
+
+
+static uint32_t s_eo_ropframe_crc_compute(EOropframe *p)
+{
+    return(eo_ropframe_hid_crc32c(0, (const uint8_t*)p->framedata, sizeof(EOropframeHeader_t) + s_eo_ropframe_sizeofrops_get(p)));
+}
+
+
+static uint32_t s_eo_ropframe_crc32c_table(uint32_t crc, const uint8_t *data, uint16_t size)
+{
+    while(size > 0)
+    {
+        crc = s_eo_ropframe_crc32c_lut[(crc ^ *data) & 0xff] ^ (crc >> 8);
+        data++;
+        size--;
+    }
+    
+    return(crc);
+}
+
+
+#if defined(EOROPFRAME_CRC32C_SSE42)
+__attribute__((target("sse4.2"))) static uint32_t s_eo_ropframe_crc32c_sse42(uint32_t crc, const uint8_t *data, uint16_t size)
+{
+#if defined(__x86_64__)
+    uint64_t crc64 = crc;
+    uint64_t word = 0;
+    
+    while(size >= 8)
+    {   // memcpy() because the rops are aligned to 4 bytes only
+        memcpy(&word, data, 8);
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += 8;
+        size -= 8;
+    }
+    crc = (uint32_t)crc64;
+#else
+    uint32_t word = 0;
+    
+    while(size >= 4)
+    {
+        memcpy(&word, data, 4);
+        crc = _mm_crc32_u32(crc, word);
+        data += 4;
+        size -= 4;
+    }
+#endif
+    
+    while(size > 0)
+    {
+        crc = _mm_crc32_u8(crc, *data);
+        data++;
+        size--;
+    }
+    
+    return(crc);
+}
+#endif
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
@@ -56,6 +56,7 @@ extern "C" {
 enum { eo_ropframe_sizeforZEROrops = 28 };
 
 
+
 /** @typedef    typedef struct EOropframe_hid EOropframe
     @brief      EOropframe is an opaque struct. It is used to implement data abstraction for the datagram 
                 object so that the user cannot see its private fields and he/she is forced to manipulate the
@@ -113,6 +114,13 @@ extern uint16_t eo_ropframe_ROP_NumberOf_quickversion(EOropframe *p);
 
 extern eOresult_t eo_ropframe_ROP_Parse(EOropframe *p, EOrop *rop, uint16_t *unparsedbytes);
 
+// as eo_ropframe_ROP_Parse() but the data of rop is not copied: it points inside the ropframe, which must not change while rop is used.
+extern eOresult_t eo_ropframe_ROP_Parse_zerocopy(EOropframe *p, EOrop *rop, uint16_t *unparsedbytes);
+
+// it is a deeper eo_ropframe_IsValid(): it also checks that ropssizeof is inside the loaded frame and walks the heads of all the rops.
+// it returns eobool_true only if every rop is well formed and they are exactly ropsnumberof in ropssizeof bytes.
+extern eObool_t eo_ropframe_ROPs_AreValid(EOropframe *p);
+
 
 //extern eObool_t eo_ropframe_ROP_CanAdd(EOropframe *p, const EOrop *rop);
 
@@ -120,6 +128,9 @@ extern eOresult_t eo_ropframe_ROP_Add(EOropframe *p, const EOrop *rop, uint16_t*
 
 extern eOresult_t eo_ropframe_ROPdata_Add(EOropframe *p, uint8_t* data, uint16_t size, uint16_t *remainingbytes);
 
+// as eo_ropframe_ROPdata_Add() but data contains numberofrops complete rops one after the other. they are added all or none.
+extern eOresult_t eo_ropframe_ROPsdata_Add(EOropframe *p, uint8_t* data, uint16_t size, uint16_t numberofrops, uint16_t *remainingbytes);
+
 extern eOresult_t eo_ropframe_ROP_Rem(EOropframe *p, uint16_t wasaddedinpos, uint16_t itssizeis);
 
 
@@ -132,6 +143,15 @@ extern eOresult_t eo_ropframe_seqnum_Set(EOropframe *p, uint64_t seqnum);
 extern uint64_t eo_ropframe_seqnum_Get(EOropframe *p);
 
 
+// it replaces the end marker of the footer with a CRC32C of header and rops and marks the header so that the receiver 
+// knows which footer to check. it must be called as last operation on the ropframe, after age and seqnum are set. 
+// any later change of the rops gives back the plain footer.
+extern eOresult_t eo_ropframe_CRC_Seal(EOropframe *p);
+
+// it tells if the ropframe carries the CRC32C footer. if so, eo_ropframe_IsValid() and eo_ropframe_ROPs_AreValid() verify it.
+extern eObool_t eo_ropframe_CRC_IsUsed(EOropframe *p);
+
+
 extern eOresult_t eo_ropframedata_age_Set(EOropframeData *d, eOabstime_t age);
 
 extern eOabstime_t eo_ropframedata_age_Get(EOropframeData *d);
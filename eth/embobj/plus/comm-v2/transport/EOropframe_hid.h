@@ -45,6 +45,9 @@ extern "C" {
 #define EOFRAME_START   0x12345678
 #define EOFRAME_END     0x87654321
 
+// the start of a ropframe whose footer does not contain EOFRAME_END but the CRC32C of header and rops
+#define EOFRAME_STARTwithCRC    0x1234567C
+
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
@@ -53,7 +56,7 @@ extern "C" {
  **/  
 typedef struct  
 {
-    uint32_t            startofframe;       /**< it is the start of the frame: it is EOFRAME_START */
+    uint32_t            startofframe;       /**< it is the start of the frame: it is EOFRAME_START or EOFRAME_STARTwithCRC */
     uint16_t            ropssizeof;         /**< tells how many bytes are reserved for the rops: its value can be 0 to ... */
     uint16_t            ropsnumberof;       /**< tells how many rops are inside: its value can be 0 to ... */
     uint64_t            ageofframe;         /**< tells the time (in usec) of creation of the frame */
@@ -74,7 +77,7 @@ struct EOropframeData_hid
 
 typedef struct  // 04 bytes
 {
-    uint32_t            endoframe;
+    uint32_t            endoframe;          // it is EOFRAME_END or the CRC32C if the header starts with EOFRAME_STARTwithCRC
 } EOropframeFooter_t;   EO_VERIFYsizeof(EOropframeFooter_t, 4)
 
 
@@ -117,6 +120,17 @@ struct EOropframe_hid
 
 uint8_t* eo_ropframe_hid_get_pointer_offset(EOropframe *p, uint16_t offset);
 
+// it returns the pointer to the beginning of the rops and it fills their size and number. NULL if p is NULL.
+uint8_t* eo_ropframe_hid_get_rops(EOropframe *p, uint16_t *sizeofrops, uint16_t *numberofrops);
+
+// it shrinks the rops to the first sizeofrops bytes, which must contain numberofrops rops. it is used by who compacts 
+// the rops in place (as the EOtransmitter does with its regulars) to fix header, footer and size of the ropframe.
+eOresult_t eo_ropframe_hid_rops_Shrink(EOropframe *p, uint16_t sizeofrops, uint16_t numberofrops);
+
+// it computes the CRC32C (Castagnoli) of data continuing from crc, which must be 0 at the first call. in this way the 
+// CRC of a ropframe can be computed also span by span, as the EOtransmitter does in eo_transmitter_outpacket_GetIOV().
+uint32_t eo_ropframe_hid_crc32c(uint32_t crc, const uint8_t *data, uint16_t size);
+
 
 
 #ifdef __cplusplus
@@ -33,7 +33,10 @@
 #include "EoProtocolMN.h"
 #include "EoError.h"
 
+// the eventviewer of the firmware is used only by the profiling commented out below. the host libraries dont have it
+#if !defined(EOTHEINFODISPATCHER_NO_EVENTVIEWER)
 #include "eventviewer.h"
+#endif
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of extern public interface
@@ -76,7 +79,9 @@ static void s_eo_infodispatcher_overflow_init(EOtheInfoDispatcher* p);
 static void s_eo_infodispatcher_overflow_clear(EOtheInfoDispatcher* p);
 static void s_eo_infodispatcher_overflow_fill(EOtheInfoDispatcher* p);
 
-static eOresult_t s_eo_infodispatcher_transmit(EOtheInfoDispatcher* p, eOmn_info_status_t* info);
+static uint16_t s_eo_infodispatcher_rop_form(EOtheInfoDispatcher* p, uint8_t* ropstream, const eOmn_info_status_t* info);
+
+static eOresult_t s_eo_infodispatcher_transmit(EOtheInfoDispatcher* p, uint16_t ropssize, uint16_t numberofrops, const eOmn_info_status_t* lastinfo);
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -86,14 +91,16 @@ static const char s_eobj_ownname[] = "EOtheInfoDispatcher";
  
 static EOtheInfoDispatcher s_eo_theinfodispatcher = 
 {
-    EO_INIT(.vectorOfinfostatus)        NULL,
+    EO_INIT(.fifoofinfostatus)          NULL,
+    EO_INIT(.capacity)                  0,
+    EO_INIT(.head)                      0,
+    EO_INIT(.size)                      0,
+    EO_INIT(.maxinfosperload)           1,
     EO_INIT(.overflow)                  NULL,
-    EO_INIT(.infostatus)                NULL,
     EO_INIT(.transmitter)               NULL,
     EO_INIT(.nvinfostatus)              NULL,
     EO_INIT(.nvinfostatusbasic)         NULL,
     EO_INIT(.ropstream)                 NULL,
-    EO_INIT(.rophead)                   NULL,
     EO_INIT(.ropsizeinfostatus)         0,
     EO_INIT(.ropsizeinfostatusbasic)    0   
 };
@@ -102,7 +109,8 @@ static EOtheInfoDispatcher s_eo_theinfodispatcher =
 const eOinfodispatcher_cfg_t eo_infodispatcher_cfg_default = 
 {
     EO_INIT(.capacity)                  8,
-    EO_INIT(.transmitter)               NULL
+    EO_INIT(.transmitter)               NULL,
+    EO_INIT(.maxinfosperload)           4
 };
 
 
@@ -116,7 +124,7 @@ const eOinfodispatcher_cfg_t eo_infodispatcher_cfg_default =
 extern EOtheInfoDispatcher * eo_infodispatcher_Initialise(const eOinfodispatcher_cfg_t *cfg) 
 {
     
-    if(NULL != s_eo_theinfodispatcher.vectorOfinfostatus)
+    if(NULL != s_eo_theinfodispatcher.fifoofinfostatus)
     {
         return(&s_eo_theinfodispatcher);
     }
@@ -137,11 +145,15 @@ extern EOtheInfoDispatcher * eo_infodispatcher_Initialise(const eOinfodispatcher
     }
 
     
-    // 1. init the infostatus vector, overflow, transmitter etc.
-
-    s_eo_theinfodispatcher.vectorOfinfostatus = eo_vector_New(sizeof(eOmn_info_status_t), cfg->capacity, NULL, NULL, NULL, NULL);    
+    // 1. init the fifo of infostatus, overflow, transmitter etc.
+    
+    // the fifo is a circular buffer, so that the info sent is removed without moving the others
+    s_eo_theinfodispatcher.fifoofinfostatus = (eOmn_info_status_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOmn_info_status_t), cfg->capacity);
+    s_eo_theinfodispatcher.capacity = cfg->capacity;
+    s_eo_theinfodispatcher.head = 0;
+    s_eo_theinfodispatcher.size = 0;
+    s_eo_theinfodispatcher.maxinfosperload = (0 == cfg->maxinfosperload) ? (1) : (cfg->maxinfosperload);
     s_eo_theinfodispatcher.overflow = (eOmn_info_status_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOmn_info_status_t), 1);
-    s_eo_theinfodispatcher.infostatus = (eOmn_info_status_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOmn_info_status_t), 1);
     
     s_eo_theinfodispatcher.transmitter = cfg->transmitter;
     EOnvSet* nvset = eo_transmitter_GetNVset(s_eo_theinfodispatcher.transmitter);   
@@ -166,26 +178,9 @@ extern EOtheInfoDispatcher * eo_infodispatcher_Initialise(const eOinfodispatcher
     s_eo_theinfodispatcher.ropsizeinfostatus = eo_rop_compute_size(eok_ropctrl_basic, eo_ropcode_sig, sizeof(eOmn_info_status_t));
     // s_eo_theinfodispatcher.ropsizeinfostatus = sizeof(eOrophead_t) + sizeof(eOmn_info_status_t);
 
-    // in here i build the ropstream which i want to send out to the transmitter. i use a single buffer and then i shape it later
-    s_eo_theinfodispatcher.ropstream = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, s_eo_theinfodispatcher.ropsizeinfostatus, 1);
-    
-    
-    // i get the pointers to header and data. i known from the protocol that the data is just after the header. 
-    // then ... i dont use signature and time in the rop
-    s_eo_theinfodispatcher.rophead = (eOrophead_t*)s_eo_theinfodispatcher.ropstream;
-    s_eo_theinfodispatcher.ropdata = s_eo_theinfodispatcher.ropstream + sizeof(eOrophead_t);
-    
-    // init the rophead to contain a eok_ropctrl_basic and a eo_ropcode_sig. 
-    // the id32 and the size are to be configured each time we send a ropstream. for now are for eOmn_info_basic_t
-    s_eo_theinfodispatcher.rophead->ctrl.confinfo   = eo_ropconf_none;
-    s_eo_theinfodispatcher.rophead->ctrl.plustime   = 0;
-    s_eo_theinfodispatcher.rophead->ctrl.plussign   = 0;
-    s_eo_theinfodispatcher.rophead->ctrl.rqsttime   = 0;
-    s_eo_theinfodispatcher.rophead->ctrl.rqstconf   = 0;
-    s_eo_theinfodispatcher.rophead->ctrl.version    = EOK_ROP_VERSION_0;
-    s_eo_theinfodispatcher.rophead->ropc            = eo_ropcode_sig;  
-    s_eo_theinfodispatcher.rophead->id32            = eoprot_ID_get(eoprot_endpoint_management, eoprot_entity_mn_info, 0, eoprot_tag_mn_info_status_basic);
-    s_eo_theinfodispatcher.rophead->dsiz            = sizeof(eOmn_info_basic_t);
+    // in here i build the ropstream which i want to send out to the transmitter. it has room for maxinfosperload rops 
+    // which are formed one after the other by s_eo_infodispatcher_rop_form() and then loaded all together.
+    s_eo_theinfodispatcher.ropstream = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, s_eo_theinfodispatcher.ropsizeinfostatus, s_eo_theinfodispatcher.maxinfosperload);
     
     
     //eventviewer_load(ev_ID_first_usrdef+15, infodisp_loadrop);
@@ -201,16 +196,15 @@ extern void eo_infodispatcher_DeInitialise(EOtheInfoDispatcher* p)
         return;
     }
     
-    if(NULL == p->vectorOfinfostatus)
+    if(NULL == p->fifoofinfostatus)
     {
         return;
     }
     
     
-    eo_vector_Delete(p->vectorOfinfostatus);
+    eo_mempool_Delete(eo_mempool_GetHandle(), p->fifoofinfostatus);
     
     eo_mempool_Delete(eo_mempool_GetHandle(), p->overflow);
-    eo_mempool_Delete(eo_mempool_GetHandle(), p->infostatus);
     
     eo_nv_Delete(p->nvinfostatus);
     eo_nv_Delete(p->nvinfostatusbasic);
@@ -224,7 +218,7 @@ extern void eo_infodispatcher_DeInitialise(EOtheInfoDispatcher* p)
 
 extern EOtheInfoDispatcher * eo_infodispatcher_GetHandle(void) 
 {
-    if(NULL != s_eo_theinfodispatcher.vectorOfinfostatus)
+    if(NULL != s_eo_theinfodispatcher.fifoofinfostatus)
     {
         return(&s_eo_theinfodispatcher);
     }
@@ -237,6 +231,8 @@ extern EOtheInfoDispatcher * eo_infodispatcher_GetHandle(void)
 
 extern eOresult_t eo_infodispatcher_Put(EOtheInfoDispatcher* p, eOmn_info_properties_t* props, const char* extra)
 {
+    eOmn_info_status_t *info = NULL;
+    
     if(NULL == p) 
     {
         return(eores_NOK_nullpointer);
@@ -247,7 +243,7 @@ extern eOresult_t eo_infodispatcher_Put(EOtheInfoDispatcher* p, eOmn_info_proper
         return(eores_NOK_nullpointer);
     }
     
-    if(eobool_true == eo_vector_Full(s_eo_theinfodispatcher.vectorOfinfostatus))
+    if(s_eo_theinfodispatcher.size == s_eo_theinfodispatcher.capacity)
     {
         // manage an overflow
         s_eo_infodispatcher_overflow_fill(&s_eo_theinfodispatcher);
@@ -255,22 +251,24 @@ extern eOresult_t eo_infodispatcher_Put(EOtheInfoDispatcher* p, eOmn_info_proper
     }
 
     
-    // prepare the infostatus ...
+    // prepare the infostatus directly inside the first free position of the fifo ...
     
-    s_eo_theinfodispatcher.infostatus->basic.timestamp = eov_sys_LifeTimeGet(eov_sys_GetHandle());
-    memcpy(&s_eo_theinfodispatcher.infostatus->basic.properties, props, sizeof(eOmn_info_properties_t));
+    info = &s_eo_theinfodispatcher.fifoofinfostatus[(s_eo_theinfodispatcher.head + s_eo_theinfodispatcher.size) % s_eo_theinfodispatcher.capacity];
+    
+    info->basic.timestamp = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    memcpy(&info->basic.properties, props, sizeof(eOmn_info_properties_t));
     if(NULL != extra)
     {
-        memcpy(s_eo_theinfodispatcher.infostatus->extra, extra, sizeof(s_eo_theinfodispatcher.infostatus->extra));
+        memcpy(info->extra, extra, sizeof(info->extra));
     }
     else
     {   // must tell that there is no extra
-        EOMN_INFO_PROPERTIES_FLAGS_set_extraformat(s_eo_theinfodispatcher.infostatus->basic.properties.flags, eomn_info_extraformat_none);
+        EOMN_INFO_PROPERTIES_FLAGS_set_extraformat(info->basic.properties.flags, eomn_info_extraformat_none);
     }
     
-    // put infostatus inside the vector
+    // ... and then it is inside
     
-    eo_vector_PushBack(s_eo_theinfodispatcher.vectorOfinfostatus, s_eo_theinfodispatcher.infostatus);
+    s_eo_theinfodispatcher.size ++;
     
     return(eores_OK);
 }
@@ -280,7 +278,10 @@ extern eOresult_t eo_infodispatcher_Send(EOtheInfoDispatcher* p, uint16_t number
 {
     eOresult_t res = eores_NOK_generic;
     uint16_t nn = 0;
-    uint16_t i = 0;
+    uint16_t n = 0;
+    uint16_t available = 0;
+    uint16_t ropsize = 0;
+    uint16_t ropssize = 0;
     eOmn_info_status_t *info = NULL;
     uint16_t remaining = 0;
     
@@ -295,7 +296,8 @@ extern eOresult_t eo_infodispatcher_Send(EOtheInfoDispatcher* p, uint16_t number
     
     if(0 != s_eo_theinfodispatcher.overflow->basic.timestamp)
     {
-        res = s_eo_infodispatcher_transmit(p, s_eo_theinfodispatcher.overflow);      
+        ropssize = s_eo_infodispatcher_rop_form(p, p->ropstream, s_eo_theinfodispatcher.overflow);
+        res = s_eo_infodispatcher_transmit(p, ropssize, 1, s_eo_theinfodispatcher.overflow);      
         if(eores_OK == res)
         {
             s_eo_infodispatcher_overflow_clear(p);
@@ -311,36 +313,48 @@ extern eOresult_t eo_infodispatcher_Send(EOtheInfoDispatcher* p, uint16_t number
         }    
     }
     
-    for(i=0; i<number; i++)
-    {       
-        // get the first info in the vector
-        info = (eOmn_info_status_t*) eo_vector_Front(s_eo_theinfodispatcher.vectorOfinfostatus);
-        if(NULL == info)
+    // the infos are loaded in groups of up to maxinfosperload rops, as many as fit inside the occasionals of the 
+    // transmitter. a group is loaded all or none, and we stop at the first group which does not fit.
+    while((nn < number) && (0 != s_eo_theinfodispatcher.size))
+    {
+        available = eo_transmitter_occasional_rops_Available(p->transmitter);
+        ropssize = 0;
+        info = NULL;
+        
+        for(n=0; (n < p->maxinfosperload) && (n < s_eo_theinfodispatcher.size) && ((nn+n) < number); n++)
         {
-            // we dont have anything inside the vector: quit loop
-            break;             
+            info = &s_eo_theinfodispatcher.fifoofinfostatus[(s_eo_theinfodispatcher.head + n) % s_eo_theinfodispatcher.capacity];
+            ropsize = (eomn_info_extraformat_none == EOMN_INFO_PROPERTIES_FLAGS_get_extraformat(info->basic.properties.flags)) ? (p->ropsizeinfostatusbasic) : (p->ropsizeinfostatus);
+            if((ropssize + ropsize) > available)
+            {
+                break;
+            }
+            ropssize += s_eo_infodispatcher_rop_form(p, &p->ropstream[ropssize], info);
         }
         
-        // ok, we have a info item: i try to send it
+        if(0 == n)
+        {   // not even one fits
+            break;
+        }
         
-        res = s_eo_infodispatcher_transmit(p, info);  
+        info = &s_eo_theinfodispatcher.fifoofinfostatus[(s_eo_theinfodispatcher.head + n - 1) % s_eo_theinfodispatcher.capacity];
+        res = s_eo_infodispatcher_transmit(p, ropssize, n, info);  
      
         if(eores_OK == res)
         {   
-            // ok: i could transmit it. thus, 1. increase number of sent items, and 2. remove the front
-            eo_vector_PopFront(s_eo_theinfodispatcher.vectorOfinfostatus);                        
-            nn++;
+            // ok: i could transmit them. thus, 1. increase number of sent items, and 2. remove them from the fifo
+            s_eo_theinfodispatcher.head = (s_eo_theinfodispatcher.head + n) % s_eo_theinfodispatcher.capacity;
+            s_eo_theinfodispatcher.size -= n;
+            nn += n;
         }
         else
         {   
-            // i could not send it: quit
+            // i could not send them: quit
             break; 
         }    
-
-        
     }
     
-    remaining = eo_vector_Size(s_eo_theinfodispatcher.vectorOfinfostatus);
+    remaining = s_eo_theinfodispatcher.size;
     
     if(NULL != numberofremaining)
     {
@@ -407,77 +421,50 @@ static void s_eo_infodispatcher_overflow_fill(EOtheInfoDispatcher* p)
 }
 
 
-static eOresult_t s_eo_infodispatcher_transmit(EOtheInfoDispatcher* p, eOmn_info_status_t* info)
-{  
-#if 1
-    
-    eOresult_t res = eores_NOK_generic;
-    uint16_t size = 0;
-    
-    //evEntityId_t prev = eventviewer_switch_to(ev_ID_first_usrdef+15);
-    
-    // when i transmit a sig, i want that the nv contains the value, thus ... let me copy the whole status. 
-    eo_nv_Set(s_eo_theinfodispatcher.nvinfostatus, info, eobool_true, eo_nv_upd_dontdo);    
+// it forms a sig<> of the info inside ropstream and it returns its size. i known from the protocol that the data is just 
+// after the header. then ... i dont use signature and time in the rop
+static uint16_t s_eo_infodispatcher_rop_form(EOtheInfoDispatcher* p, uint8_t* ropstream, const eOmn_info_status_t* info)
+{
+    eOrophead_t* rophead = (eOrophead_t*)ropstream;
+    uint8_t* ropdata = ropstream + sizeof(eOrophead_t);
+    
+    rophead->ctrl.confinfo   = eo_ropconf_none;
+    rophead->ctrl.plustime   = 0;
+    rophead->ctrl.plussign   = 0;
+    rophead->ctrl.rqsttime   = 0;
+    rophead->ctrl.rqstconf   = 0;
+    rophead->ctrl.version    = EOK_ROP_VERSION_0;
+    rophead->ropc            = eo_ropcode_sig;  
      
     if(eomn_info_extraformat_none == EOMN_INFO_PROPERTIES_FLAGS_get_extraformat(info->basic.properties.flags))
     {
-        s_eo_theinfodispatcher.rophead->dsiz = sizeof(eOmn_info_basic_t); //eo_nv_Size(s_eo_theinfodispatcher.nvinfostatusbasic); //sizeof(eOmn_info_basic_t);
-        s_eo_theinfodispatcher.rophead->id32 = eo_nv_GetID32(s_eo_theinfodispatcher.nvinfostatusbasic);  
-        memcpy(s_eo_theinfodispatcher.ropdata, info, sizeof(eOmn_info_basic_t));
-        size = p->ropsizeinfostatusbasic;        
-    }
-    else
-    {
-        s_eo_theinfodispatcher.rophead->dsiz = sizeof(eOmn_info_status_t); //eo_nv_Size(s_eo_theinfodispatcher.nvinfostatus); //sizeof(eOmn_info_status_t);
-        s_eo_theinfodispatcher.rophead->id32 = eo_nv_GetID32(s_eo_theinfodispatcher.nvinfostatus);  
-        memcpy(s_eo_theinfodispatcher.ropdata, info, sizeof(eOmn_info_status_t));        
-        size = p->ropsizeinfostatus;        
+        rophead->dsiz = sizeof(eOmn_info_basic_t); 
+        rophead->id32 = eo_nv_GetID32(p->nvinfostatusbasic);  
+        memcpy(ropdata, info, sizeof(eOmn_info_basic_t));
+        return(p->ropsizeinfostatusbasic);        
     }
-    
-    
 
-    res = eo_transmitter_occasional_rops_LoadStream(p->transmitter, p->ropstream, size);
-    
-    //eventviewer_switch_to(prev);
-    
-    return(res);
-    
-#else
-    // must: attempt loading the info inside the proper netvar, then into the transmitter as a occasional rop
- 
-    //evEntityId_t prev = eventviewer_switch_to(ev_ID_first_usrdef+15);
-    
-    eOresult_t res = eores_NOK_generic;
-    eOnvID32_t id32 = eo_nv_ID32dummy;
-    
-    // i set the whole status
-    eo_nv_Set(s_eo_theinfodispatcher.nvinfostatus, info, eobool_true, eo_nv_upd_dontdo);
-    
-    if(eomn_info_extraformat_none == info->basic.properties.extraformat)
-    {
-        id32 = eo_nv_GetID32(s_eo_theinfodispatcher.nvinfostatusbasic);
-    }
-    else
-    {
-        id32 =  eo_nv_GetID32(s_eo_theinfodispatcher.nvinfostatus);
-    }
+    rophead->dsiz = sizeof(eOmn_info_status_t); 
+    rophead->id32 = eo_nv_GetID32(p->nvinfostatus);  
+    memcpy(ropdata, info, sizeof(eOmn_info_status_t));        
+    return(p->ropsizeinfostatus);        
+}
 
-    eOropdescriptor_t ropdes = {0};
-    memcpy(&ropdes, &eok_ropdesc_basic, sizeof(eOropdescriptor_t));
-    
-    ropdes.ropcode  = eo_ropcode_sig;
-    ropdes.id32     = id32;
+
+static eOresult_t s_eo_infodispatcher_transmit(EOtheInfoDispatcher* p, uint16_t ropssize, uint16_t numberofrops, const eOmn_info_status_t* lastinfo)
+{  
+    eOresult_t res = eores_NOK_generic;
     
     //evEntityId_t prev = eventviewer_switch_to(ev_ID_first_usrdef+15);
     
-    res = eo_transmitter_occasional_rops_Load(p->transmitter, &ropdes);
+    // when i transmit a sig, i want that the nv contains the value, thus ... let me copy the whole status of the last one. 
+    eo_nv_Set(p->nvinfostatus, lastinfo, eobool_true, eo_nv_upd_dontdo);    
+
+    res = eo_transmitter_occasional_rops_LoadStreamOfROPs(p->transmitter, p->ropstream, ropssize, numberofrops, NULL);
     
-  
     //eventviewer_switch_to(prev);
     
-    return(res);     
-    
-#endif    
+    return(res);
 }
 
 
@@ -63,6 +63,7 @@ typedef struct
 {
     eOsizecntnr_t       capacity;
     EOtransmitter*      transmitter;
+    uint8_t             maxinfosperload;    // the infos are loaded into the occasionals of the transmitter in groups of up to maxinfosperload sig<> rops. 
 } eOinfodispatcher_cfg_t;
 
     
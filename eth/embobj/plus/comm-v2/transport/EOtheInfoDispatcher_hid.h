@@ -34,7 +34,6 @@ extern "C" {
 // - external dependencies --------------------------------------------------------------------------------------------
 
 #include "EoCommon.h"
-#include "EOvector.h"
 #include "EOnv.h"
 #include "EoManagement.h"
 
@@ -59,18 +58,19 @@ extern "C" {
  
 struct EOtheInfoDispatcher_hid 
 {
-    EOvector*               vectorOfinfostatus;
+    eOmn_info_status_t*     fifoofinfostatus;   // a circular buffer of capacity items
+    uint16_t                capacity;
+    uint16_t                head;               // the position of the oldest info
+    uint16_t                size;               // the number of infos inside the fifo
+    uint8_t                 maxinfosperload;    // how many infos at most are loaded into the transmitter at once
     eOmn_info_status_t*     overflow;  
-    eOmn_info_status_t*     infostatus;
     EOtransmitter*          transmitter;
     // marco.accame: for now the function eo_transmitter_occasional_rops_Load() use only a eOropdescriptor_t argument and 
     //               computes the EOnv internally. thus we dont need the following two EOnv. however, we may speed up 
     //               by passing a EOnv* as argument which overrides the internal computation 
     EOnv*                   nvinfostatus;
     EOnv*                   nvinfostatusbasic;    
-    uint8_t*                ropstream;
-    eOrophead_t*            rophead;
-    uint8_t*                ropdata;
+    uint8_t*                ropstream;          // room for maxinfosperload rops of eOmn_info_status_t, one after the other
     uint16_t                ropsizeinfostatus;
     uint16_t                ropsizeinfostatusbasic;
 }; 
@@ -66,6 +66,9 @@
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
 
+static eOresult_t s_eo_parser_checkrop(const uint8_t *streamdata, const uint16_t streamsize, uint16_t *dataeffectivesize, uint16_t *signeffectivesize, uint16_t *parsedropsize, uint16_t *consumedbytes, eOparserResult_t *result);
+
+static eOresult_t s_eo_parser_getrop(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result, eObool_t zerocopy);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -108,16 +111,25 @@ extern EOtheParser * eo_parser_GetHandle(void)
 
 
 extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result)
-{   // this function requires the access to hidden types of EOrop
-    eOrophead_t *rophead            = NULL;
-    uint8_t     *ropdata            = NULL;
-    uint8_t     *roptail            = NULL;
-    uint16_t    dataeffectivesize   = 0; // multiple of four
+{
+    return(s_eo_parser_getrop(p, streamdata, streamsize, rop, consumedbytes, result, eobool_false));
+}
+
+
+extern eOresult_t eo_parser_GetROP_zerocopy(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result)
+{
+    return(s_eo_parser_getrop(p, streamdata, streamsize, rop, consumedbytes, result, eobool_true));
+}
+
+
+extern eOresult_t eo_parser_CheckROP(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, uint16_t *consumedbytes, eOparserResult_t *result)
+{
+    uint16_t    dataeffectivesize   = 0;
     uint16_t    signeffectivesize   = 0;
-    uint16_t    timeeffectivesize   = 0;
     uint16_t    parsedropsize       = 0;
+    eOresult_t  res                 = eores_NOK_generic;
 
-    if((NULL == p) || (NULL == streamdata) || (NULL == rop) || (NULL == consumedbytes) || (NULL == result))
+    if((NULL == p) || (NULL == streamdata) || (NULL == consumedbytes) || (NULL == result))
     {
         if(NULL != result)
         {
@@ -125,11 +137,40 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
         }
         return(eores_NOK_nullpointer);
     }
-
-    // reset return data: rop and consumed bytes
-    eo_rop_Reset(rop);
+    
     *consumedbytes = 0;
     *result = eo_parser_res_ok;
+    
+    res = s_eo_parser_checkrop(streamdata, streamsize, &dataeffectivesize, &signeffectivesize, &parsedropsize, consumedbytes, result);
+    
+    if(eores_OK == res)
+    {
+        *consumedbytes = parsedropsize;
+    }
+    
+    return(res);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions 
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eo_parser_checkrop(const uint8_t *streamdata, const uint16_t streamsize, uint16_t *dataeffectivesize, uint16_t *signeffectivesize, uint16_t *parsedropsize, uint16_t *consumedbytes, eOparserResult_t *result)
+{   // it verifies the head of the rop at the beginning of streamdata and computes the sizes of its fields without copying anything
+    eOrophead_t *rophead            = NULL;
+    uint16_t    timeeffectivesize   = 0;
+
+    *dataeffectivesize  = 0;
+    *signeffectivesize  = 0;
+    *parsedropsize      = 0;
 
     if(streamsize < eo_rop_minimumsize)
     {
@@ -139,10 +180,7 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
     }
 
     // get the head of the rop with ctrl, ropc, endp, nvid, dsiz. 
-    // for now the roptail is just after the four bytes of the head
     rophead = (eOrophead_t*)(&streamdata[0]);
-    roptail = (uint8_t*)(&streamdata[sizeof(eOrophead_t)]);
-    roptail = roptail;  // there is this instruction to force roptail to have its correct value in debugger
 
     // check validity of ctrl
     if(0 != rophead->ctrl.version)
@@ -167,40 +205,25 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
     // some ropcodes also have a data field
     if(eobool_true == eo_rop_datafield_is_required(rophead))
     {
-        if(eobool_true == eo_rop_datafield_is_present(rophead))
-        {
-            ropdata = (uint8_t*)(&streamdata[sizeof(eOrophead_t)]);            
-        }
-        else
+        if(eobool_false == eo_rop_datafield_is_present(rophead))
         {   // the rop is not well formed
             *result = eo_parser_res_nok_ropisillegal;
             *consumedbytes = streamsize;
             return(eores_NOK_generic);
         }
-    }
-    else
-    {
-        ropdata = NULL;
-    }
-
-
-    // in case there is data field, verify it, and sets its effective length 
-    // remember that size and info must occupy 4, 8, 12, etc bytes.
-    if(NULL != ropdata)
-    {        
+        
+        // in case there is data field, verify it, and sets its effective length 
+        // remember that size and info must occupy 4, 8, 12, etc bytes.
         // we compute the effective size of data as the next multiple of four of dsiz
-        dataeffectivesize = eo_rop_datafield_effective_size(rophead->dsiz);
+        *dataeffectivesize = eo_rop_datafield_effective_size(rophead->dsiz);
         
         // we make a first verification of size whcih at least tell us if the roptail is inside the stream
-        if(streamsize < (sizeof(eOrophead_t) + dataeffectivesize))
+        if(streamsize < (sizeof(eOrophead_t) + *dataeffectivesize))
         {   // the rop is too big to be contained inside the stream
             *result = eo_parser_res_nok_ropisillegal;
             *consumedbytes = streamsize;
             return(eores_NOK_generic);
         }
-			
-        // the roptail is after the bytes of the head and the bytes of the data
-        roptail = (uint8_t*)(&streamdata[sizeof(eOrophead_t) + dataeffectivesize]);           
     }
 
     
@@ -208,7 +231,7 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
 
     if(1 == rophead->ctrl.plussign)
     {
-        signeffectivesize = 4;
+        *signeffectivesize = 4;
     }
 
     if(1 == rophead->ctrl.plustime)
@@ -217,17 +240,67 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
     }
     
     // the total size of the rop acording to info contained in the header is ...
-    parsedropsize = sizeof(eOrophead_t) + dataeffectivesize + signeffectivesize + timeeffectivesize;
+    *parsedropsize = sizeof(eOrophead_t) + *dataeffectivesize + *signeffectivesize + timeeffectivesize;
 
     // if we dont have enough bytes in the stream to accomodate  leave with an error
-    if(streamsize < parsedropsize)
+    if(streamsize < *parsedropsize)
     {   // not enough bytes in the passed packet to keep the data suggested by the header
         *result = eo_parser_res_nok_ropisillegal;
         *consumedbytes = streamsize;
         return(eores_NOK_generic);
     }
     
-    // verify if we can accomodate the parsed rop in our buffer
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eo_parser_getrop(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result, eObool_t zerocopy)
+{   // this function requires the access to hidden types of EOrop
+    eOrophead_t *rophead            = NULL;
+    uint8_t     *ropdata            = NULL;
+    uint8_t     *roptail            = NULL;
+    uint16_t    dataeffectivesize   = 0; // multiple of four
+    uint16_t    signeffectivesize   = 0;
+    uint16_t    parsedropsize       = 0;
+    eOresult_t  res                 = eores_NOK_generic;
+
+    if((NULL == p) || (NULL == streamdata) || (NULL == rop) || (NULL == consumedbytes) || (NULL == result))
+    {
+        if(NULL != result)
+        {
+            *result = eo_parser_res_nok_fatal;
+        }
+        return(eores_NOK_nullpointer);
+    }
+
+    // reset return data: rop and consumed bytes. in zerocopy mode we dont clear the data buffer of the rop because we dont use it
+    if(eobool_true == zerocopy)
+    {
+        memset(&rop->stream.head, 0, sizeof(eOrophead_t));
+        rop->stream.sign = EOK_uint32dummy;
+        rop->stream.time = EOK_uint64dummy;
+        eo_nv_Clear(&rop->netvar);
+        memset(&rop->ropdes, 0, sizeof(eOropdescriptor_t));
+    }
+    else
+    {
+        eo_rop_Reset(rop);
+    }
+    *consumedbytes = 0;
+    *result = eo_parser_res_ok;
+    
+    res = s_eo_parser_checkrop(streamdata, streamsize, &dataeffectivesize, &signeffectivesize, &parsedropsize, consumedbytes, result);
+    if(eores_OK != res)
+    {
+        return(res);
+    }
+
+    rophead = (eOrophead_t*)(&streamdata[0]);
+    ropdata = (0 == dataeffectivesize) ? (NULL) : ((uint8_t*)(&streamdata[sizeof(eOrophead_t)]));
+    roptail = (uint8_t*)(&streamdata[sizeof(eOrophead_t) + dataeffectivesize]);
+    
+    // verify if we can accomodate the parsed rop in our buffer. we do it also in zerocopy mode, so that 
+    // the same rops are accepted in both modes
     if(rop->stream.capacity < parsedropsize)
     {   // cannot handle the parsed rop in the EOrop object
         *result = eo_parser_res_nok_ropistoobig;
@@ -242,10 +315,9 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
     // copy head
     memcpy(&rop->stream.head, rophead, sizeof(eOrophead_t));
 
-    // copy data
-    if(NULL != ropdata)
+    // copy data, but not in zerocopy mode
+    if((NULL != ropdata) && (eobool_false == zerocopy))
     {
-        rop->stream.head.dsiz = rophead->dsiz;
         memcpy(rop->stream.data, ropdata, dataeffectivesize);
     }
 		
@@ -257,14 +329,21 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
     }
 
     // copy the time
-    if(0 != timeeffectivesize)
+    if(1 == rophead->ctrl.plustime)
     {
         rop->stream.time = *( (uint64_t*) &roptail[signeffectivesize] );
     }  
     
 
-    // prepare the ropdes
-    eo_rop_hid_fill_ropdes(&rop->ropdes, &rop->stream, rop->stream.head.dsiz, rop->stream.data);
+    // prepare the ropdes. in zerocopy mode its data points inside the stream, which must stay valid for as long as the rop is used
+    if((NULL != ropdata) && (eobool_true == zerocopy))
+    {
+        eo_rop_hid_fill_ropdes(&rop->ropdes, &rop->stream, rop->stream.head.dsiz, ropdata);
+    }
+    else
+    {
+        eo_rop_hid_fill_ropdes(&rop->ropdes, &rop->stream, rop->stream.head.dsiz, rop->stream.data);
+    }
 				   
     return(eores_OK);
 }
@@ -272,21 +351,6 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
 
 
 
-
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of extern hidden functions 
-// --------------------------------------------------------------------------------------------------------------------
-// empty-section
-
-
-
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of static functions 
-// --------------------------------------------------------------------------------------------------------------------
-// empty-section
-
-
-
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
@@ -107,6 +107,24 @@ extern EOtheParser * eo_parser_GetHandle(void);
 extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result);
 
 
+/** @fn         extern eOresult_t eo_parser_GetROP_zerocopy(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result)
+    @brief      As eo_parser_GetROP() but the data field of the rop is not copied inside @e rop: its ropdes.data points inside 
+                @e streamdata, which thus must stay valid for as long as @e rop is used. The data buffer of @e rop is not 
+                even cleared, so its content is meaningless. It is used by the EOreceiver on the incoming packet.
+    @return     The same values of eo_parser_GetROP().
+ **/
+extern eOresult_t eo_parser_GetROP_zerocopy(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result);
+
+
+/** @fn         extern eOresult_t eo_parser_CheckROP(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, uint16_t *consumedbytes, eOparserResult_t *result)
+    @brief      Verifies the head of the rop at the beginning of @e streamdata with the same rules of eo_parser_GetROP(), 
+                without filling any rop. 
+    @param      consumedbytes   The size of the rop if it is valid.
+    @return     eores_OK if the rop is valid, eores_NOK_generic if not, eores_NOK_nullpointer if any is a NULL pointer.
+ **/
+extern eOresult_t eo_parser_CheckROP(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, uint16_t *consumedbytes, eOparserResult_t *result);
+
+
 
 
 
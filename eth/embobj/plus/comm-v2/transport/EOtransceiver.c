@@ -69,7 +69,9 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section    
+
+static eOresult_t s_eo_transceiver_reply_load(EOtransceiver *p);
+static void s_eo_transceiver_ropframecrc_follow(EOtransceiver *p);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -100,8 +102,8 @@ const eOtransceiver_cfg_t eo_transceiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)          NULL,
         EO_INIT(.onerrorinvalidframe)       NULL
-    }
-    
+    },
+    EO_INIT(.zerocopy)                      eobool_false
 };
 
 
@@ -185,6 +187,7 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     rec_cfg.agent                           = retptr->agent;
     rec_cfg.extfn.onerrorseqnumber          = cfg->extfn.onerrorseqnumber;
     rec_cfg.extfn.onerrorinvalidframe       = cfg->extfn.onerrorinvalidframe;
+    rec_cfg.zerocopy                        = cfg->zerocopy;
 
     retptr->receiver = eo_receiver_New(&rec_cfg);
 
@@ -205,6 +208,7 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     tra_cfg.protection                          = (eo_trans_protection_none == cfg->protection) ? (eo_transmitter_protection_none) : (eo_transmitter_protection_total);
     
     retptr->transmitter = eo_transmitter_New(&tra_cfg);
+    retptr->ropframecrc = eo_trans_ropframecrc_off;
     
     
     // manage the debug info
@@ -323,30 +327,78 @@ extern eOresult_t eo_transceiver_Receive(EOtransceiver *p, EOpacket *pkt, uint16
     {
         return(res);
     }  
+    
+    s_eo_transceiver_ropframecrc_follow(p);
 
     if(eobool_true == thereisareply)
     {
-        // must put the reply inside the transmitter
-        EOropframe* ropframereply = NULL;
+        res = s_eo_transceiver_reply_load(p);
+    }    
+    
+    return(res);
+}
+
+
+extern eOresult_t eo_transceiver_ReceiveBatch(EOtransceiver *p, EOpacket **pkts, uint16_t numberofpkts, eOreceiver_result_t *results)
+{
+    eObool_t thereisareply = eobool_false;  
+    eOresult_t res = eores_OK;
+    eOipv4addr_t remaddr;
+    eOipv4port_t remport;
+    uint16_t i = 0;
+    uint16_t n = 0;
+    
+    if((NULL == p) || (NULL == pkts))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // the proxy is ticked only once for the whole batch
+    eo_proxy_Tick(p->proxy);
+    
+    while(i < numberofpkts)
+    {
+        // we look for the longest run of packets coming from p->cfg.remipv4addr which starts at position i
+        for(n=0; (i+n) < numberofpkts; n++)
+        {
+            if(NULL == pkts[i+n])
+            {
+                break;
+            }
+            eo_packet_Addressing_Get(pkts[i+n], &remaddr, &remport);
+            if(remaddr != p->cfg.remipv4addr)
+            {
+                break;
+            }            
+        }
         
-        // if in here, i am sure that there is a reply and that return value will be eores_OK
-        res = eo_receiver_GetReply(p->receiver, &ropframereply);
+        if(0 == n)
+        {   // the packet at position i is discarded
+            if(NULL != results)
+            {
+                memset(&results[i], 0, sizeof(eOreceiver_result_t));
+                results[i].result = (NULL == pkts[i]) ? (eores_NOK_nullpointer) : (eores_NOK_generic);
+            }
+            res = eores_NOK_generic;
+            i++;
+            continue;
+        }
         
-        // i will transmit back a reply to the remote host at address p->cfg.remipv4addr and port p->cfg.remipv4port  ...
-        // which are the ones assigned to the p->transmitter at its creation.
+        // the run is processed in one go and its replies are all loaded inside the transmitter at once
+        if(eores_OK != eo_receiver_ProcessBatch(p->receiver, &pkts[i], n, (NULL == results) ? (NULL) : (&results[i]), &thereisareply))
+        {
+            res = eores_NOK_generic;
+        }
         
-        res = eo_transmitter_reply_ropframe_Load(p->transmitter, ropframereply);      
+        s_eo_transceiver_ropframecrc_follow(p);
         
-#if defined(USE_DEBUG_EOTRANSCEIVER) 
-        {   // DEBUG
-            if(eores_OK != res)
-            {
-                p->debug.failuresinloadofreplyropframe ++;
-            }
+        if(eobool_true == thereisareply)
+        {
+            s_eo_transceiver_reply_load(p);
         }
-#endif        
-
-    }    
+        
+        i += n;
+    }
     
     return(res);
 }
@@ -396,6 +448,24 @@ extern eOresult_t eo_transceiver_outpacket_Get(EOtransceiver *p, EOpacket **pkt)
 }
 
 
+extern eOresult_t eo_transceiver_outpacket_GetIOV(EOtransceiver *p, eOtransmitter_iov_t *iov, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
+{  
+    eOresult_t res = eores_NOK_generic;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    res = eo_transmitter_outpacket_GetIOV(p->transmitter, iov, numberofrops, ropsnum);
+    
+    // as in eo_transceiver_outpacket_Prepare() we tick the proxy
+    eo_proxy_Tick(p->proxy);
+    
+    return(res);
+}
+
+
 extern eOresult_t eo_transceiver_RegularROPs_Clear(EOtransceiver *p)
 {
     eOresult_t res;
@@ -410,6 +480,27 @@ extern eOresult_t eo_transceiver_RegularROPs_Clear(EOtransceiver *p)
     return(res);
 }
 
+extern eOresult_t eo_transceiver_RegularROPs_Delta_Set(EOtransceiver *p, uint8_t keyframe)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(eo_transmitter_regular_rops_Delta_Set(p->transmitter, keyframe));
+}
+
+extern eOresult_t eo_transceiver_RegularROPs_Schedule_Set(EOtransceiver *p, eOnvEP8_t ep8, eOnvENT_t ent, uint16_t period, uint16_t phase)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(eo_transmitter_regular_rops_Schedule_Set(p->transmitter, ep8, ent, period, phase));
+}
+
+
 extern eOsizecntnr_t eo_transceiver_RegularROP_ArrayID32Size(EOtransceiver *p)
 {
     if(NULL == p)
@@ -512,6 +603,25 @@ extern eOresult_t eo_transceiver_RegularROP_Unload(EOtransceiver *p, eOropdescri
     return(res);
 }
 
+extern eOresult_t eo_transceiver_ropframeCRC_Set(EOtransceiver *p, eOtransceiver_ropframecrc_t mode)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    p->ropframecrc = mode;
+    
+    if(eo_trans_ropframecrc_asremote == mode)
+    {
+        s_eo_transceiver_ropframecrc_follow(p);
+        return(eores_OK);
+    }
+    
+    return(eo_transmitter_ropframeCRC_Set(p->transmitter, (eo_trans_ropframecrc_on == mode) ? (eobool_true) : (eobool_false)));
+}
+
+
 extern eOresult_t eo_transceiver_lasterror_tx_Get(EOtransceiver *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2)
 {
     //eOresult_t res;
@@ -599,7 +709,42 @@ extern eOresult_t eo_transceiver_LoadReplyInProxy(EOtransceiver *p, eOnvID32_t i
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static eOresult_t s_eo_transceiver_reply_load(EOtransceiver *p)
+{
+    eOresult_t res;
+    // must put the reply inside the transmitter
+    EOropframe* ropframereply = NULL;
+    
+    // if in here, i am sure that there is a reply and that return value will be eores_OK
+    res = eo_receiver_GetReply(p->receiver, &ropframereply);
+    
+    // i will transmit back a reply to the remote host at address p->cfg.remipv4addr and port p->cfg.remipv4port  ...
+    // which are the ones assigned to the p->transmitter at its creation.
+    
+    res = eo_transmitter_reply_ropframe_Load(p->transmitter, ropframereply);      
+    
+#if defined(USE_DEBUG_EOTRANSCEIVER) 
+    {   // DEBUG
+        if(eores_OK != res)
+        {
+            p->debug.failuresinloadofreplyropframe ++;
+        }
+    }
+#endif        
+
+    return(res);
+}
+
+
+static void s_eo_transceiver_ropframecrc_follow(EOtransceiver *p)
+{
+    if(eo_trans_ropframecrc_asremote == p->ropframecrc)
+    {
+        eo_transmitter_ropframeCRC_Set(p->transmitter, eo_receiver_RemoteUsesCRC(p->receiver));
+    }
+}
+
 
 
 
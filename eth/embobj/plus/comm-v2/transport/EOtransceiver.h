@@ -74,6 +74,15 @@ typedef enum
 } eOtransceiver_protection_t;
 
 
+typedef enum
+{
+    eo_trans_ropframecrc_off                    = 0,    // the ropframes we transmit have the plain footer
+    eo_trans_ropframecrc_on                     = 1,    // the ropframes we transmit have the CRC32C footer
+    eo_trans_ropframecrc_asremote               = 2     // we use the CRC32C footer only if the last ropframe received from the remote had it
+} eOtransceiver_ropframecrc_t;
+
+
+
 typedef struct   
 {
     uint16_t        capacityoftxpacket; 
@@ -102,6 +111,7 @@ typedef struct
     eov_mutex_fn_mutexderived_new   mutex_fn_new;
     eOtransceiver_protection_t      protection;
     eOtransceiver_extfn_t           extfn;
+    eObool_t                        zerocopy;   // see eOreceiver_cfg_t
 } eOtransceiver_cfg_t;
 
 
@@ -133,6 +143,18 @@ extern EOreceiver * eo_transceiver_GetReceiver(EOtransceiver *p);
 
 extern eOresult_t eo_transceiver_Receive(EOtransceiver *p, EOpacket *pkt, uint16_t *numberofrops, eOabstime_t* txtime); 
 
+
+/** @fn         extern eOresult_t eo_transceiver_ReceiveBatch(EOtransceiver *p, EOpacket **pkts, uint16_t numberofpkts, eOreceiver_result_t *results)
+    @brief      it is the batched version of eo_transceiver_Receive(). the proxy is ticked only once, the packets are processed in order 
+                and the replies are loaded into the transmitter once per run of consecutive packets accepted from the remote host.
+                packets not coming from the remote host are discarded with a eores_NOK_generic result.
+    @param      p               pointer to transceiver        
+    @param      pkts            array of numberofpkts received packets
+    @param      results         if not NULL it must have numberofpkts items and it is filled with the outcome of each packet.
+    @return     eores_OK only if every packet is accepted and valid, eores_NOK_generic otherwise, eores_NOK_nullpointer if p or pkts is NULL
+ **/
+extern eOresult_t eo_transceiver_ReceiveBatch(EOtransceiver *p, EOpacket **pkts, uint16_t numberofpkts, eOreceiver_result_t *results); 
+
 extern eOresult_t eo_transceiver_NumberofOutROPs(EOtransceiver *p, uint16_t *numberofreplies, uint16_t *numberofoccasionals, uint16_t *numberofregulars);
 
 /** @fn         extern eOresult_t eo_transceiver_outpacket_Prepare(EOtransceiver *p, uint16_t *numberofrops)
@@ -153,6 +175,22 @@ extern eOresult_t eo_transceiver_outpacket_Prepare(EOtransceiver *p, uint16_t *n
  **/
 extern eOresult_t eo_transceiver_outpacket_Get(EOtransceiver *p, EOpacket **pkt);
 
+
+/** @fn         extern eOresult_t eo_transceiver_outpacket_GetIOV(EOtransceiver *p, eOtransmitter_iov_t *iov, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
+    @brief      it is the scatter-gather alternative to eo_transceiver_outpacket_Prepare() + eo_transceiver_outpacket_Get().
+                see eo_transmitter_outpacket_GetIOV() for the validity of the spans.
+    @param      p               pointer to transceiver        
+    @param      iov             in output it contains the spans of the ropframe to transmit
+    @param      numberofrops    the number of rops contained in the ropframe
+    @return     eores_OK or eores_NOK_nullpointer
+ **/
+extern eOresult_t eo_transceiver_outpacket_GetIOV(EOtransceiver *p, eOtransmitter_iov_t *iov, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum);
+
+// it chooses the footer of the transmitted ropframes. the received ropframes are always accepted w/ either footer. 
+// the remote which does not know the CRC32C footer rejects our ropframes, thus: the side which initiates uses 
+// eo_trans_ropframecrc_on and the other side uses eo_trans_ropframecrc_asremote. the default is eo_trans_ropframecrc_off.
+extern eOresult_t eo_transceiver_ropframeCRC_Set(EOtransceiver *p, eOtransceiver_ropframecrc_t mode);
+
 extern eOresult_t eo_transceiver_lasterror_tx_Get(EOtransceiver *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2);
     
 // if the variable is local then it is used the ram of the netvar. if it is remote, the ropdescr must contain data and size
@@ -164,6 +202,10 @@ extern eOsizecntnr_t eo_transceiver_RegularROP_ArrayID32SizeWithEP(EOtransceiver
 extern eOresult_t eo_transceiver_RegularROP_ArrayID32Get(EOtransceiver *p, uint16_t start, EOarray* array);
 extern eOresult_t eo_transceiver_RegularROP_ArrayID32GetWithEP(EOtransceiver *p, eOnvEP8_t ep, uint16_t start, EOarray* array);
 extern eOresult_t eo_transceiver_RegularROPs_Clear(EOtransceiver *p);
+// see eo_transmitter_regular_rops_Delta_Set()
+extern eOresult_t eo_transceiver_RegularROPs_Delta_Set(EOtransceiver *p, uint8_t keyframe);
+// see eo_transmitter_regular_rops_Schedule_Set()
+extern eOresult_t eo_transceiver_RegularROPs_Schedule_Set(EOtransceiver *p, eOnvEP8_t ep8, eOnvENT_t ent, uint16_t period, uint16_t phase);
 extern eOresult_t eo_transceiver_RegularROP_Load(EOtransceiver *p, eOropdescriptor_t *ropdes); 
 extern eOresult_t eo_transceiver_RegularROP_Entity_Unload(EOtransceiver *p, eOnvEP8_t ep8, eOnvENT_t ent);
 extern eOresult_t eo_transceiver_RegularROP_Unload(EOtransceiver *p, eOropdescriptor_t *ropdes); 
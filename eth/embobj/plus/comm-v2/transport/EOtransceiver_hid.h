@@ -75,6 +75,7 @@ struct EOtransceiver_hid
     EOagent*                    agent;
     EOreceiver*                 receiver;
     EOtransmitter*              transmitter;   
+    eOtransceiver_ropframecrc_t ropframecrc;
 #if defined(USE_DEBUG_EOTRANSCEIVER)    
     EOtransceiverDEBUG_t        debug;
 #endif    
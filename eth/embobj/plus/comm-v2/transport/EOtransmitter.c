@@ -27,6 +27,7 @@
 #include "EOtheParser.h"
 #include "EOtheFormer.h"
 #include "EOropframe_hid.h"
+#include "EOtransportStats_hid.h"
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
 #include "EOVtheSystem.h"
@@ -35,6 +36,7 @@
 #include "EoProtocol.h"
 #include "EOVmutex.h"
 #include "EOlist.h"
+#include "EOconfirmationManager_hid.h"
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of extern public interface
@@ -87,11 +89,32 @@
 
 static eOresult_t s_eo_transmitter_entitymatchingrule_rule(void *item, void *param);
 
-static eOresult_t s_eo_transmitter_ropmatchingrule_rule(void *item, void *param);
+static void s_eo_transmitter_regropindex_init(EOtransmitter *p, uint16_t maxnumberofregularrops);
 
-static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param);
+static void s_eo_transmitter_regropindex_clear(EOtransmitter *p);
 
-static void s_eo_transmitter_list_shiftdownropinfo(void *item, void *param);
+static uint16_t s_eo_transmitter_regropindex_hash(EOtransmitter *p, eOprotID32_t id32);
+
+static eo_transm_regrop_slot_t * s_eo_transmitter_regropindex_find(EOtransmitter *p, eOprotID32_t id32);
+
+static void s_eo_transmitter_regropindex_insert(EOtransmitter *p, eOprotID32_t id32, EOlistIter *li);
+
+static void s_eo_transmitter_regropindex_remove(EOtransmitter *p, eOprotID32_t id32);
+
+static void s_eo_transmitter_list_compileregrop(void *item, void *param);
+
+static void s_eo_transmitter_regulars_compile(EOtransmitter *p);
+
+static void s_eo_transmitter_regulars_copy(EOtransmitter *p);
+static void s_eo_transmitter_regulars_copy_one(eo_transm_regrop_copy_t *copy, eObool_t delta);
+
+static void s_eo_transmitter_regulars_erase(EOtransmitter *p, EOlistIter *li);
+
+static void s_eo_transmitter_regulars_purge(EOtransmitter *p);
+
+static uint16_t s_eo_transmitter_regulars_delta_add(EOtransmitter *p, EOropframe *intoropframe, EOropframe *cycledregulars);
+
+static uint16_t s_eo_transmitter_regulars_schedule_add(EOtransmitter *p, EOropframe *intoropframe);
 
 static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived *mtx);
 
@@ -108,6 +131,19 @@ static void s_eo_transmitter_regulars_reset_sizes(EOtransmitter *p);
 
 static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_regropframe_t type, int16_t ropbytes);
 
+static uint16_t s_eo_transmitter_iov_add(eOtransmitter_iov_t *iov, EOropframe *ropframe, uint16_t capacity, eObool_t *toobig);
+
+static void s_eo_transmitter_ropframe_swap(EOropframe *ropframe, uint8_t **buffer, uint8_t **bufferinflight);
+
+static eOnanotime_t s_eo_transmitter_nanotime(EOtransmitter *p);
+
+static eObool_t s_eo_transmitter_stats_copy(EOtransmitter *p, eOtransmitter_stats_t *stats);
+
+static void s_eo_transmitter_stats_ropframe(EOtransmitter *p, const eOtransmitter_ropsnumber_t *ropsnum, uint16_t size, eOnanotime_t timeofstart);
+
+static void s_eo_transmitter_confirmations_retransmit(EOtransmitter *p);
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -200,6 +236,21 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     retptr->listofregropinfo        = (0 == cfg->sizes.maxnumberofregularrops) ? (NULL) : (eo_list_New(sizeof(eo_transm_regrop_info_t), cfg->sizes.maxnumberofregularrops, NULL, 0, NULL, NULL));
     retptr->currenttime             = 0;
     retptr->tx_seqnum               = 0;
+    retptr->regropcopies            = (0 == cfg->sizes.maxnumberofregularrops) ? (NULL) : ((eo_transm_regrop_copy_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eo_transm_regrop_copy_t), cfg->sizes.maxnumberofregularrops));
+    retptr->regropcopiesnumberof    = 0;
+    retptr->regropcopiesaredirty    = eobool_false;
+    s_eo_transmitter_regropindex_init(retptr, cfg->sizes.maxnumberofregularrops);
+    retptr->regropframeswithholes   = 0;
+    retptr->bufferropframeoccasionals_inflight  = NULL;     // allocated only if we use eo_transmitter_outpacket_GetIOV()
+    retptr->bufferropframereplies_inflight      = NULL;     // allocated only if we use eo_transmitter_outpacket_GetIOV()
+    memset(&retptr->iovheader, 0, sizeof(EOropframeHeader_t));
+    retptr->iovheader.startofframe  = EOFRAME_START;
+    retptr->iovfooter.endoframe     = EOFRAME_END;
+    retptr->ropframecrc             = eobool_false;
+    retptr->regularskeyframe        = 0;
+    retptr->regularsscheduled       = eobool_false;
+    retptr->regropdue               = (0 == cfg->sizes.maxnumberofregularrops) ? (NULL) : ((uint16_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(uint16_t), cfg->sizes.maxnumberofregularrops));
+    memset(retptr->regropschedule, 0, sizeof(retptr->regropschedule));
 
     eo_ropframe_Load(retptr->ropframeregulars_standard, retptr->bufferropframeregulars_standard, eo_ropframe_sizeforZEROrops, capacityofregularsubframes);
     eo_ropframe_Clear(retptr->ropframeregulars_standard);
@@ -260,6 +311,8 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     retptr->lasterror_info1 = 0;
     retptr->lasterror_info2 = 0;
     
+    memset(&retptr->stats, 0, sizeof(retptr->stats));
+    
     retptr->txdecimationprogressive = 0;
     retptr->txdecimationreplies = 1;
     retptr->txdecimationoccasionals = 1;
@@ -307,6 +360,21 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
     {
         eo_list_Delete(p->listofregropinfo);
     }     
+    if(NULL != p->regropcopies)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->regropcopies);
+        p->regropcopies = NULL;
+    }
+    if(NULL != p->regropindex)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->regropindex);
+        p->regropindex = NULL;
+    }
+    if(NULL != p->regropdue)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->regropdue);
+        p->regropdue = NULL;
+    }
     if(NULL != p->bufferropframeregulars_standard)
     {
         eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_standard);
@@ -332,6 +400,16 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
         eo_mempool_Delete(eo_mempool_GetHandle(),  p->bufferropframereplies);
         p->bufferropframereplies = NULL;
     }  
+    if(NULL != p->bufferropframeoccasionals_inflight)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(),  p->bufferropframeoccasionals_inflight);
+        p->bufferropframeoccasionals_inflight = NULL;
+    }
+    if(NULL != p->bufferropframereplies_inflight)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(),  p->bufferropframereplies_inflight);
+        p->bufferropframereplies_inflight = NULL;
+    }  
     
     eo_rop_Delete(p->roptmp);
     
@@ -389,10 +467,6 @@ extern eOsizecntnr_t eo_transmitter_regular_rops_Size(EOtransmitter *p)
 extern eOsizecntnr_t eo_transmitter_regular_rops_Size_with_ep(EOtransmitter *p, eOnvEP8_t ep)
 {
     eOsizecntnr_t retvalue = 0;
-    uint16_t size = 0;
-    uint32_t i = 0;
-    EOlistIter* li = NULL;
-    eOnvID32_t id32 = 0;
     
     if(NULL == p) 
     {
@@ -418,19 +492,7 @@ extern eOsizecntnr_t eo_transmitter_regular_rops_Size_with_ep(EOtransmitter *p,
     
     eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
     
-    size = eo_list_Size(p->listofregropinfo);
-    li = eo_list_Begin(p->listofregropinfo);
-    for(i=0; i<size; i++) 
-    { 
-        eo_transm_regrop_info_t *item = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
-        li = eo_list_Next(p->listofregropinfo, li);
-        
-        id32 = eo_nv_GetID32(&item->thenv);
-        if(ep == eoprot_ID2endpoint(id32))
-        {
-            retvalue ++;
-        }               
-    }            
+    retvalue = p->regropsnumberof_ep[ep];
 
     eov_mutex_Release(p->mtx_regulars);
 
@@ -540,9 +602,9 @@ extern eOresult_t eo_transmitter_regular_rops_arrayid32_ep_Get(EOtransmitter *p,
     
     eo_array_Reset(array);
     
-    if(start > size)
+    if(start >= p->regropsnumberof_ep[ep])
     {
-        // do nothing
+        // do nothing: there are not enough regulars of this endpoint
     }
     else
     {      
@@ -550,7 +612,8 @@ extern eOresult_t eo_transmitter_regular_rops_arrayid32_ep_Get(EOtransmitter *p,
         uint32_t count = 0;
         uint32_t i=0;
         EOlistIter* li = eo_list_Begin(p->listofregropinfo);
-        for(i=0; i<size; i++)
+        // we stop as soon as we have seen all the regulars of the endpoint
+        for(i=0; (i<size) && (count < p->regropsnumberof_ep[ep]); i++)
         { 
             eo_transm_regrop_info_t *item = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
             li = eo_list_Next(p->listofregropinfo, li);
@@ -599,6 +662,9 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     
     
     eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    
+    // the new rop is added at the end of its ropframe, thus the holes left by unloaded rops must be removed first
+    s_eo_transmitter_regulars_purge(p);
 
     // work on the list ...     
     if(eobool_true == eo_list_Full(p->listofregropinfo))
@@ -613,8 +679,8 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     ropdescriptor.id32      = ropdesc->id32;
 
     
-    // search for ropcode+ep+id. if found, then ... return a non NULL iterator and dont do anything because it means that the rop is already inside
-    if(NULL != eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescriptor))
+    // search for the id32 in the index. if found, then ... dont do anything because it means that the rop is already inside
+    if(NULL != s_eo_transmitter_regropindex_find(p, ropdescriptor.id32))
     {   // it is already inside ...
         eov_mutex_Release(p->mtx_regulars);
         return(eores_OK);
@@ -727,12 +793,16 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     memcpy(&regropinfo.thenv, tmpnvptr, sizeof(EOnv));
 
 
-    // push back regropinfo inside the list.
+    // push back regropinfo inside the list and index it.
     eo_list_PushBack(p->listofregropinfo, &regropinfo);
+    s_eo_transmitter_regropindex_insert(p, ropdescriptor.id32, eo_list_Last(p->listofregropinfo));
     
     // increment size of the relevant regular ropframe
     s_eo_transmitter_regulars_update_sizes(p, regropframe2use_type, +regropinfo.ropsize); // with a + we increment
     
+    // the compiled regulars must be rebuilt
+    p->regropcopiesaredirty = eobool_true;
+    
     eov_mutex_Release(p->mtx_roptmp);
     eov_mutex_Release(p->mtx_regulars);  
     
@@ -742,9 +812,9 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
 
 extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdescriptor_t* ropdesc)//eOropcode_t ropcode, eOnvEP_t nvep, eOnvID_t nvid)
 {
-    eo_transm_regrop_info_t regropinfo;
     eOropdescriptor_t ropdescriptor;
     EOlistIter *li = NULL;
+    eo_transm_regrop_slot_t *slot = NULL;
 
     if(NULL == p) 
     {
@@ -772,33 +842,17 @@ extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdesc
     ropdescriptor.id32          = ropdesc->id32;
 
       
-    // search for ropcode+nvep+nvid. if not found, then ... return OK and dont do anything.
-    li = eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescriptor);
-    if(NULL == li)
+    // search for the id32 in the index. if not found, then ... return NOK and dont do anything.
+    slot = s_eo_transmitter_regropindex_find(p, ropdescriptor.id32);
+    if(NULL == slot)
     {   // it is not inside ...
         eov_mutex_Release(p->mtx_regulars);
         return(eores_NOK_generic);
     }
+    li = slot->li;
     
-    // copy what is inside the list into a temporary variable
-    memcpy(&regropinfo, eo_list_At(p->listofregropinfo, li), sizeof(eo_transm_regrop_info_t));
-    
-    // for each element after li: (name is afterli) retrieve it and modify its content so that ropstarthere is decremented by regropinfo.ropsize ...
-    // but only if ... the element is inside the same regropframe. that is done in function s_eo_transmitter_list_shiftdownropinfo()
-    eo_list_ExecuteFromIter(p->listofregropinfo, s_eo_transmitter_list_shiftdownropinfo, &regropinfo, eo_list_Next(p->listofregropinfo, li));
-    
-    // remove the element indexedby li
-    eo_list_Erase(p->listofregropinfo, li);
-    
-    // inside the p->ropframeregulars: remove a rop of regropinfo.ropsize which starts at regropinfo.ropstartshere. use a _friend method in here defined.
-    //                                 you must: decrement the nrops by 1, decrement the size by regropinfo.ropsize, ... else in header and private variable ...
-    //                                           and finally make a memmove down by regropinfo.ropsize.
-    
-
-    eo_ropframe_ROP_Rem(regropinfo.ropframe, regropinfo.ropstarthere, regropinfo.ropsize);
-    
-    // decrement the size of relevant ropframe
-    s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize); // with a -regropinfo.ropsize we decrement
+    // remove it from list and index. its bytes stay inside the ropframe until the next purge
+    s_eo_transmitter_regulars_erase(p, li);
 
     eov_mutex_Release(p->mtx_regulars);
     
@@ -808,11 +862,9 @@ extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdesc
 
 extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eOnvEP8_t ep8, eOnvENT_t ent)
 {
-    eo_transm_regrop_info_t regropinfo;
     EOlistIter *li = NULL;
+    EOlistIter *next = NULL;
     uint32_t id32 = 0;
-    uint8_t size = 0;
-    uint8_t i = 0;
 
     if(NULL == p) 
     {
@@ -835,39 +887,27 @@ extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eO
         return(eores_NOK_generic);
     }
     
+    // if the endpoint has no regulars there is nothing to search for
+    if((ep8 < eoprot_endpoints_numberof) && (0 == p->regropsnumberof_ep[ep8]))
+    {
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_OK);
+    }
+    
     // need only ropcode, ep and id to search for inside the list listofregropinfo
     id32 = ((uint32_t)ep8 << 24) | ((uint32_t)ent << 16);
 
       
-    size = eo_list_Size(p->listofregropinfo);
-    for(i=0; i<size; i++)
+    // a single walk of the list: the matching rops are erased without touching the ropframes, which are purged later
+    li = eo_list_Begin(p->listofregropinfo);
+    while(NULL != li)
     {
-        // search for ropcode+nvep+nvid. if not found, then ... break.
-        li = eo_list_Find(p->listofregropinfo, s_eo_transmitter_entitymatchingrule_rule, &id32);
-        if(NULL == li)
-        {   // it is not inside ...
-            break;
+        next = eo_list_Next(p->listofregropinfo, li);
+        if(eores_OK == s_eo_transmitter_entitymatchingrule_rule(eo_list_At(p->listofregropinfo, li), &id32))
+        {
+            s_eo_transmitter_regulars_erase(p, li);
         }
-        
-        // copy what is inside the list into a temporary variable
-        memcpy(&regropinfo, eo_list_At(p->listofregropinfo, li), sizeof(eo_transm_regrop_info_t));
-        
-        // for each element after li: (name is afterli) retrieve it and modify its content so that ropstarthere is decremented by regropinfo.ropsize ...
-        // but only if ... the element is inside the same regropframe. that is done in function s_eo_transmitter_list_shiftdownropinfo()
-        eo_list_ExecuteFromIter(p->listofregropinfo, s_eo_transmitter_list_shiftdownropinfo, &regropinfo, eo_list_Next(p->listofregropinfo, li));
-        
-        // remove the element indexedby li
-        eo_list_Erase(p->listofregropinfo, li);
-        
-        // inside the p->ropframeregulars: remove a rop of regropinfo.ropsize which starts at regropinfo.ropstartshere. use a _friend method in here defined.
-        //                                 you must: decrement the nrops by 1, decrement the size by regropinfo.ropsize, ... else in header and private variable ...
-        //                                           and finally make a memmove down by regropinfo.ropsize.
-        
-
-        eo_ropframe_ROP_Rem(regropinfo.ropframe, regropinfo.ropstarthere, regropinfo.ropsize);
-        
-        // decrement the size of relevant ropframe
-        s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize); // with a -regropinfo.ropsize we decrement    
+        li = next;
     }
 
     eov_mutex_Release(p->mtx_regulars);
@@ -890,6 +930,10 @@ extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p)
     
     eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
     
+    // the schedules go away with the regulars
+    memset(p->regropschedule, 0, sizeof(p->regropschedule));
+    p->regularsscheduled = eobool_false;
+    
     if(eobool_true == eo_list_Empty(p->listofregropinfo))
     {
         eov_mutex_Release(p->mtx_regulars);
@@ -897,12 +941,18 @@ extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p)
     } 
     
     eo_list_Clear(p->listofregropinfo);
+    s_eo_transmitter_regropindex_clear(p);
     
     eo_ropframe_Clear(p->ropframeregulars_standard);
     eo_ropframe_Clear(p->ropframeregulars_cycle0of);
     eo_ropframe_Clear(p->ropframeregulars_cycle1of);    
     
     s_eo_transmitter_regulars_reset_sizes(p);
+    p->regropframeswithholes = 0;
+    
+    p->regropcopiesnumberof = 0;
+    p->regropcopiesaredirty = eobool_false;
+
 
     eov_mutex_Release(p->mtx_regulars);
     
@@ -924,6 +974,9 @@ extern eOresult_t eo_transmitter_regular_rops_Refresh(EOtransmitter *p)
     
     eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
     
+    // remove the holes left by unloaded rops. it must be done even if the list is empty 
+    s_eo_transmitter_regulars_purge(p);
+    
     if(eobool_true == eo_list_Empty(p->listofregropinfo))
     {
         eov_mutex_Release(p->mtx_regulars);
@@ -932,8 +985,14 @@ extern eOresult_t eo_transmitter_regular_rops_Refresh(EOtransmitter *p)
     
     p->currenttime = eov_sys_LifeTimeGet(eov_sys_GetHandle());
     
-    // for each element in the list ... i do: ... see function
-    eo_list_Execute(p->listofregropinfo, s_eo_transmitter_list_updaterop_in_ropframe, p);
+    // the list is walked only if the regulars have changed since last refresh. 
+    if(eobool_true == p->regropcopiesaredirty)
+    {
+        s_eo_transmitter_regulars_compile(p);
+    }
+    
+    // for each compiled regular ... i do: ... see function
+    s_eo_transmitter_regulars_copy(p);
 
     eov_mutex_Release(p->mtx_regulars);
     
@@ -982,6 +1041,7 @@ extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *num
         {
             uint16_t cycledrops = 0;
             eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+            s_eo_transmitter_regulars_purge(p);
             // we may have one of the cycled or not
             s_eo_transmitter_get_cycled_regropframe(p, &cycledrops);
             // but the standard is alwyas added
@@ -1003,19 +1063,30 @@ extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *num
 extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
 {
     uint16_t remainingbytes;
+    uint16_t size = 0;
+    eOtransmitter_ropsnumber_t ropsnumber;
+    eOnanotime_t timeofstart = 0;
 
     if(NULL == p) 
     {
         return(eores_NOK_nullpointer);
     }
     
-    if(NULL != ropsnum)
+    timeofstart = s_eo_transmitter_nanotime(p);
+    
+    // the statistics need the number of rops even if the caller does not
+    if(NULL == ropsnum)
     {
-        ropsnum->numberofregulars = 0;
-        ropsnum->numberofoccasionals = 0;
-        ropsnum->numberofreplies = 0;       
+        ropsnum = &ropsnumber;
     }
     
+    ropsnum->numberofregulars = 0;
+    ropsnum->numberofoccasionals = 0;
+    ropsnum->numberofreplies = 0;       
+    
+    // the confirmed rops which have not received their ack/nak in time are loaded again amongst the occasionals
+    s_eo_transmitter_confirmations_retransmit(p);
+    
     // clear the content of the ropframe to transmit which uses the same storage of the packet ...
     eo_ropframe_Clear(p->ropframereadytotx);
     
@@ -1093,24 +1164,36 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
         
         eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
         
-        // at first the standard regulars which are always transmitted
-        eo_ropframe_Append(p->ropframereadytotx, p->ropframeregulars_standard, &remainingbytes);
-        nregulars += eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard);
+        // an unload may have happened after the refresh
+        s_eo_transmitter_regulars_purge(p);
         
-        // then add the cycled one, if there are any
         cycledregulars = s_eo_transmitter_get_cycled_regropframe(p, &nregularscycled);
-        if(NULL != cycledregulars)
+        
+        if(eobool_true == p->regularsscheduled)
+        {   // in schedule mode we add the rops which are due, earliest deadline first
+            nregulars = s_eo_transmitter_regulars_schedule_add(p, p->ropframereadytotx);
+        }
+        else if(p->regularskeyframe > 1)
+        {   // in delta mode we add only the rops which have changed or which are due for their keyframe
+            nregulars = s_eo_transmitter_regulars_delta_add(p, p->ropframereadytotx, cycledregulars);
+        }
+        else
         {
-            eo_ropframe_Append(p->ropframereadytotx, cycledregulars, &remainingbytes);
-            nregulars += nregularscycled;
+            // at first the standard regulars which are always transmitted
+            eo_ropframe_Append(p->ropframereadytotx, p->ropframeregulars_standard, &remainingbytes);
+            nregulars += eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard);
+            
+            // then add the cycled one, if there are any
+            if(NULL != cycledregulars)
+            {
+                eo_ropframe_Append(p->ropframereadytotx, cycledregulars, &remainingbytes);
+                nregulars += nregularscycled;
+            }
         }
                 
         eov_mutex_Release(p->mtx_regulars);
         
-        if(NULL != ropsnum)
-        {
-            ropsnum->numberofregulars = nregulars;
-        }
+        ropsnum->numberofregulars = nregulars;
         
         // very important: increment the regulars progressive number. it is used to decide which cycling regular to get
         p->txregularsprogressive ++;
@@ -1120,12 +1203,10 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
     if(0 == (p->txdecimationprogressive % p->txdecimationoccasionals))
     {
         eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
-        if(NULL != ropsnum)
-        {
-            ropsnum->numberofoccasionals = eo_ropframe_ROP_NumberOf(p->ropframeoccasionals);
-        }
+        ropsnum->numberofoccasionals = eo_ropframe_ROP_NumberOf(p->ropframeoccasionals);
         eo_ropframe_Append(p->ropframereadytotx, p->ropframeoccasionals, &remainingbytes);
         eo_ropframe_Clear(p->ropframeoccasionals);
+        eo_confman_hid_ConfirmationRequests_Sent(p->confmanager, eoconfman_queue_occasionals);
         eov_mutex_Release(p->mtx_occasionals);
     }
 
@@ -1133,12 +1214,10 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
     if(0 == (p->txdecimationprogressive % p->txdecimationreplies))
     {
         eov_mutex_Take(p->mtx_replies, eok_reltimeINFINITE);
-        if(NULL != ropsnum)
-        {
-            ropsnum->numberofreplies = eo_ropframe_ROP_NumberOf(p->ropframereplies);
-        }        
+        ropsnum->numberofreplies = eo_ropframe_ROP_NumberOf(p->ropframereplies);
         eo_ropframe_Append(p->ropframereadytotx, p->ropframereplies, &remainingbytes);
         eo_ropframe_Clear(p->ropframereplies);
+        eo_confman_hid_ConfirmationRequests_Sent(p->confmanager, eoconfman_queue_replies);
         eov_mutex_Release(p->mtx_replies);
     }
 
@@ -1150,6 +1229,9 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
         *numberofrops = eo_ropframe_ROP_NumberOf(p->ropframereadytotx);   
     }
     
+    eo_ropframe_Size_Get(p->ropframereadytotx, &size);
+    s_eo_transmitter_stats_ropframe(p, ropsnum, size, timeofstart);
+    
     // finally we must increment the txdecimationprogressive
     p->txdecimationprogressive ++;
     
@@ -1185,6 +1267,86 @@ extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repl
     return(eores_NOK_nullpointer);       
 }
 
+extern eOresult_t eo_transmitter_regular_rops_Delta_Set(EOtransmitter *p, uint8_t keyframe)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL == p->listofregropinfo)
+    {
+        return(eores_OK);
+    }
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    p->regularskeyframe = keyframe;
+    // a new compile marks all the regulars as changed, so that they are all transmitted at next time
+    p->regropcopiesaredirty = eobool_true;
+    eov_mutex_Release(p->mtx_regulars);
+    
+    return(eores_OK);
+}
+
+extern eOresult_t eo_transmitter_regular_rops_Schedule_Set(EOtransmitter *p, eOnvEP8_t ep8, eOnvENT_t ent, uint16_t period, uint16_t phase)
+{
+    uint8_t e = 0;
+    uint8_t i = 0;
+    eObool_t scheduled = eobool_false;
+    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL == p->listofregropinfo)
+    {
+        return(eores_OK);
+    }
+    
+    if((ep8 >= eoprot_endpoints_numberof) || (ent >= eo_transm_schedule_maxentities))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    
+    p->regropschedule[ep8][ent].period = period;
+    p->regropschedule[ep8][ent].phase = (0 == period) ? (0) : (phase % period);
+    
+    // the schedule mode is active as long as at least one entity has its own schedule. it stays active also if the regulars 
+    // loaded in schedule mode do not fit a single transmission anymore, because the other modes would not transmit them all.
+    for(e=0; e<eoprot_endpoints_numberof; e++)
+    {
+        for(i=0; i<eo_transm_schedule_maxentities; i++)
+        {
+            if(0 != p->regropschedule[e][i].period)
+            {
+                scheduled = eobool_true;
+            }
+        }
+    }
+    p->regularsscheduled = ((eobool_true == scheduled) || (p->maxsizeofregulars > p->effectivecapacityofregulars)) ? (eobool_true) : (eobool_false);
+    
+    // a new compile assigns period and deadline to every regular
+    p->regropcopiesaredirty = eobool_true;
+    eov_mutex_Release(p->mtx_regulars);
+    
+    return(eores_OK);
+}
+
+extern eOresult_t eo_transmitter_ropframeCRC_Set(EOtransmitter *p, eObool_t on)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    p->ropframecrc = on;
+    
+    return(eores_OK);
+}
+
 extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outpkt)
 {
     uint16_t size;
@@ -1201,6 +1363,12 @@ extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outp
     // add sequence number
     p->tx_seqnum++;
     eo_ropframe_seqnum_Set(p->ropframereadytotx, p->tx_seqnum);
+    
+    // the crc must be the last thing, as it covers the header as well
+    if(eobool_true == p->ropframecrc)
+    {
+        eo_ropframe_CRC_Seal(p->ropframereadytotx);
+    }
 
     // now set the size of the packet according to what is inside the ropframe.
     eo_ropframe_Size_Get(p->ropframereadytotx, &size);
@@ -1216,6 +1384,17 @@ extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outp
         }
     }
 #endif
+
+    {
+        uint16_t capacity = 0;
+        eo_packet_Capacity_Get(p->txpacket, &capacity);   
+        if(size > capacity)
+        {
+            eo_nv_hid_Seqlock_WriteBeginSingle(&p->stats.seq);
+            p->stats.current.ropframestoobig ++;
+            eo_nv_hid_Seqlock_WriteEnd(&p->stats.seq);
+        }
+    }
     
     // finally gives back the packet
     *outpkt = p->txpacket;
@@ -1230,6 +1409,175 @@ extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outp
     return(eores_OK);   
 }
 
+extern eOresult_t eo_transmitter_outpacket_GetIOV(EOtransmitter *p, eOtransmitter_iov_t *iov, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
+{
+    uint16_t capacity = 0;
+    uint16_t nrops = 0;
+    uint16_t n = 0;
+    eOtransmitter_ropsnumber_t ropsnumber;
+    eOnanotime_t timeofstart = 0;
+    eObool_t toobig = eobool_false;
+
+    if((NULL == p) || (NULL == iov)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    timeofstart = s_eo_transmitter_nanotime(p);
+    
+    // as in eo_transmitter_outpacket_Prepare()
+    if(NULL == ropsnum)
+    {
+        ropsnum = &ropsnumber;
+    }
+    
+    ropsnum->numberofregulars = 0;
+    ropsnum->numberofoccasionals = 0;
+    ropsnum->numberofreplies = 0;       
+    
+    // as in eo_transmitter_outpacket_Prepare()
+    s_eo_transmitter_confirmations_retransmit(p);
+    
+    // the ropframe cannot be bigger than the packet formed by eo_transmitter_outpacket_Prepare()
+    eo_packet_Capacity_Get(p->txpacket, &capacity);
+    
+    // the first span is the header. we fill it at the end, when we know the rops.
+    iov->size           = eo_ropframe_sizeforZEROrops;
+    iov->numberofspans  = 1;
+    iov->filler         = 0;
+    iov->spans[0].data  = (const uint8_t*)&p->iovheader;
+    iov->spans[0].size  = sizeof(EOropframeHeader_t);
+    
+    // the regulars: same rules as in eo_transmitter_outpacket_Prepare()
+    if(0 == (p->txdecimationprogressive % p->txdecimationregulars))
+    {
+        EOropframe* cycledregulars = NULL;
+        uint16_t nregularscycled = 0;
+        uint16_t nregulars = 0;
+
+        // refresh all regulars ...    
+        eo_transmitter_regular_rops_Refresh(p);
+        
+        eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+        
+        // an unload may have happened after the refresh
+        s_eo_transmitter_regulars_purge(p);
+        
+        cycledregulars = s_eo_transmitter_get_cycled_regropframe(p, &nregularscycled);
+        
+        if((eobool_true == p->regularsscheduled) || (p->regularskeyframe > 1))
+        {   // in schedule or delta mode the rops to transmit are scattered: we gather them in the ropframe of the packet, 
+            // which is not used otherwise by the iov.
+            eo_ropframe_Clear(p->ropframereadytotx);
+            if(eobool_true == p->regularsscheduled)
+            {
+                s_eo_transmitter_regulars_schedule_add(p, p->ropframereadytotx);
+            }
+            else
+            {
+                s_eo_transmitter_regulars_delta_add(p, p->ropframereadytotx, cycledregulars);
+            }
+            nregulars += s_eo_transmitter_iov_add(iov, p->ropframereadytotx, capacity, &toobig);
+        }
+        else
+        {
+            nregulars += s_eo_transmitter_iov_add(iov, p->ropframeregulars_standard, capacity, &toobig);
+            
+            if(NULL != cycledregulars)
+            {
+                nregulars += s_eo_transmitter_iov_add(iov, cycledregulars, capacity, &toobig);
+            }
+        }
+                
+        eov_mutex_Release(p->mtx_regulars);
+        
+        ropsnum->numberofregulars = nregulars;
+        nrops += nregulars;
+        
+        p->txregularsprogressive ++;
+    }
+    
+    // the occasionals: their rops stay where they are and become in flight. the ropframe continues on the other buffer.
+    if(0 == (p->txdecimationprogressive % p->txdecimationoccasionals))
+    {
+        eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
+        n = s_eo_transmitter_iov_add(iov, p->ropframeoccasionals, capacity, &toobig);
+        s_eo_transmitter_ropframe_swap(p->ropframeoccasionals, &p->bufferropframeoccasionals, &p->bufferropframeoccasionals_inflight);
+        eo_confman_hid_ConfirmationRequests_Sent(p->confmanager, eoconfman_queue_occasionals);
+        eov_mutex_Release(p->mtx_occasionals);
+        ropsnum->numberofoccasionals = n;
+        nrops += n;
+    }
+    
+    // the replies: same as the occasionals
+    if(0 == (p->txdecimationprogressive % p->txdecimationreplies))
+    {
+        eov_mutex_Take(p->mtx_replies, eok_reltimeINFINITE);
+        n = s_eo_transmitter_iov_add(iov, p->ropframereplies, capacity, &toobig);
+        s_eo_transmitter_ropframe_swap(p->ropframereplies, &p->bufferropframereplies, &p->bufferropframereplies_inflight);
+        eo_confman_hid_ConfirmationRequests_Sent(p->confmanager, eoconfman_queue_replies);
+        eov_mutex_Release(p->mtx_replies);
+        ropsnum->numberofreplies = n;
+        nrops += n;
+    }
+    
+    // the footer
+    iov->spans[iov->numberofspans].data = (const uint8_t*)&p->iovfooter;
+    iov->spans[iov->numberofspans].size = sizeof(EOropframeFooter_t);
+    iov->numberofspans ++;
+    
+    // and now the header, w/ age and sequence number as in eo_transmitter_outpacket_Get()
+    p->tx_seqnum++;
+    p->iovheader.ropssizeof     = iov->size - eo_ropframe_sizeforZEROrops;
+    p->iovheader.ropsnumberof   = nrops;
+    p->iovheader.ageofframe     = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    p->iovheader.sequencenumber = p->tx_seqnum;
+    
+    // the crc of header and rops is computed span by span. the last span is the footer.
+    if(eobool_true == p->ropframecrc)
+    {
+        uint32_t crc = 0;
+        
+        p->iovheader.startofframe = EOFRAME_STARTwithCRC;
+        for(n=0; n<(iov->numberofspans-1); n++)
+        {
+            crc = eo_ropframe_hid_crc32c(crc, iov->spans[n].data, iov->spans[n].size);
+        }
+        p->iovfooter.endoframe = crc;
+    }
+    else
+    {
+        p->iovheader.startofframe = EOFRAME_START;
+        p->iovfooter.endoframe = EOFRAME_END;
+    }
+    
+    if(NULL != numberofrops)
+    {
+        *numberofrops = nrops;
+    }
+    
+    // as in eo_transmitter_outpacket_Get(): the rops left out of the iov would have made it bigger than the packet
+    if(eobool_true == toobig)
+    {
+        eo_nv_hid_Seqlock_WriteBeginSingle(&p->stats.seq);
+        p->stats.current.ropframestoobig ++;
+        eo_nv_hid_Seqlock_WriteEnd(&p->stats.seq);
+    }
+    
+    s_eo_transmitter_stats_ropframe(p, ropsnum, iov->size, timeofstart);
+    
+    p->txdecimationprogressive ++;
+    
+    // if the confirmation manager is active .. call it
+    if(NULL != p->confmanager)
+    {
+        eo_confman_ConfirmationRequests_Process(p->confmanager, p->ipv4addr);
+    }
+    
+    return(eores_OK);
+}
+
+
 extern eOresult_t eo_transmitter_lasterror_Get(EOtransmitter *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2)
 {
 //    eOresult_t res;
@@ -1253,21 +1601,94 @@ extern eOresult_t eo_transmitter_lasterror_Get(EOtransmitter *p, int32_t *err, i
     return(eores_OK);    
 }
 
-extern eOresult_t eo_transmitter_occasional_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
-{   // we dont care about p->ropframeoccasionals being invalid because all controls are inside s_eo_transmitter_rops_Load().
-    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframeoccasionals, p->mtx_occasionals));
-}
-
 
-extern eOresult_t eo_transmitter_reply_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
-{   // we dont care about p->ropframereplies being invalid because all controls are inside s_eo_transmitter_rops_Load().
-    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframereplies, p->mtx_replies));
-}
-
-
-extern eOresult_t eo_transmitter_reply_ropframe_Load(EOtransmitter *p, EOropframe* ropframe)
+extern eOresult_t eo_transmitter_Stats_Get(EOtransmitter *p, eOtransmitter_stats_t *stats)
 {
-    eOresult_t res;
+    uint32_t begin = 0;
+    uint32_t *value = NULL;
+    const uint32_t *base = NULL;
+    uint16_t i = 0;
+    uint8_t attempts = 0;
+    
+    if((NULL == p) || (NULL == stats)) 
+    {
+        return(eores_NOK_nullpointer);
+    }  
+    
+    // all the fields are uint32_t counters: the difference with the baseline is correct also after a wrap around
+    for(attempts=0; attempts<EONV_SEQLOCK_ATTEMPTS; attempts=eo_nv_hid_Seqlock_Stalls(&p->stats.seqofbaseline, begin, attempts))
+    {
+        if(eobool_false == s_eo_transmitter_stats_copy(p, stats))
+        {
+            break;
+        }
+        begin = eo_nv_hid_Seqlock_ReadBegin(&p->stats.seqofbaseline);
+        value = (uint32_t*)stats;
+        base = (const uint32_t*)&p->stats.baseline;
+        for(i=0; i<sizeof(eOtransmitter_stats_t)/sizeof(uint32_t); i++)
+        {
+            value[i] -= base[i];
+        }
+        if(eobool_false == eo_nv_hid_Seqlock_ReadRetry(&p->stats.seqofbaseline, begin))
+        {
+            return(eores_OK);
+        }
+    }
+
+    // we may have preempted the writer: the caller can try again later
+    return(eores_NOK_busy);        
+}
+
+
+extern eOresult_t eo_transmitter_Stats_Reset(EOtransmitter *p)
+{
+    eOtransmitter_stats_t current;
+    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    } 
+    
+    if(eobool_false == s_eo_transmitter_stats_copy(p, &current))
+    {
+        return(eores_NOK_busy);
+    }
+    
+    eo_nv_hid_Seqlock_WriteBegin(&p->stats.seqofbaseline);
+    memcpy(&p->stats.baseline, &current, sizeof(eOtransmitter_stats_t));
+    eo_nv_hid_Seqlock_WriteEnd(&p->stats.seqofbaseline);
+
+    return(eores_OK);        
+}
+
+
+extern eOresult_t eo_transmitter_Stats_Timing_Enable(EOtransmitter *p, eObool_t enable)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    } 
+    
+    p->stats.timing = enable;
+
+    return(eores_OK);        
+}
+
+extern eOresult_t eo_transmitter_occasional_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
+{   // we dont care about p->ropframeoccasionals being invalid because all controls are inside s_eo_transmitter_rops_Load().
+    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframeoccasionals, p->mtx_occasionals));
+}
+
+
+extern eOresult_t eo_transmitter_reply_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
+{   // we dont care about p->ropframereplies being invalid because all controls are inside s_eo_transmitter_rops_Load().
+    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframereplies, p->mtx_replies));
+}
+
+
+extern eOresult_t eo_transmitter_reply_ropframe_Load(EOtransmitter *p, EOropframe* ropframe)
+{
+    eOresult_t res;
     uint16_t remainingbytes;
 
     if(NULL == p) 
@@ -1293,6 +1714,43 @@ extern eOresult_t eo_transmitter_occasional_rops_LoadStream(EOtransmitter *p, ui
 }
 
 
+extern eOresult_t eo_transmitter_occasional_rops_LoadStreamOfROPs(EOtransmitter *p, uint8_t *stream, uint16_t size, uint16_t numberofrops, uint16_t *remainingbytes)
+{    
+    eOresult_t res;
+    
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
+    res = eo_ropframe_ROPsdata_Add(p->ropframeoccasionals, stream, size, numberofrops, remainingbytes);
+    eov_mutex_Release(p->mtx_occasionals);
+    
+    return(res);
+}
+
+
+extern uint16_t eo_transmitter_occasional_rops_Available(EOtransmitter *p)
+{    
+    uint8_t *data = NULL;
+    uint16_t capacity = 0;
+    uint16_t size = 0;
+    
+    if(NULL == p) 
+    {
+        return(0);
+    }
+    
+    eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
+    eo_ropframe_Get(p->ropframeoccasionals, &data, &size, &capacity);
+    eov_mutex_Release(p->mtx_occasionals);
+    
+    // the size includes header and footer as the capacity does
+    return((capacity > size) ? (capacity - size) : (0));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -1304,22 +1762,129 @@ extern eOresult_t eo_transmitter_occasional_rops_LoadStream(EOtransmitter *p, ui
 // --------------------------------------------------------------------------------------------------------------------
 
 
-static eOresult_t s_eo_transmitter_ropmatchingrule_rule(void *item, void *param)
+static void s_eo_transmitter_regropindex_init(EOtransmitter *p, uint16_t maxnumberofregularrops)
 {
-    eo_transm_regrop_info_t *inside = (eo_transm_regrop_info_t*)item;
-    eOropdescriptor_t *targetrop = (eOropdescriptor_t*)param;
+    p->regropindex = NULL;
+    p->regropindexcapacity = 0;
+    p->regropindexbits = 0;
+    memset(p->regropsnumberof_ep, 0, sizeof(p->regropsnumberof_ep));
+    
+    if(0 == maxnumberofregularrops)
+    {
+        return;
+    }
+    
+    // the capacity is the smallest power of two not lower than twice the max number of regulars, so that the load factor 
+    // is always <= 0.5 and the linear probing is short. it is allocated only once in here.
+    p->regropindexbits = 1;
+    while((1UL << p->regropindexbits) < (2UL*maxnumberofregularrops))
+    {
+        p->regropindexbits ++;
+    }
+    p->regropindexcapacity = (uint16_t)(1UL << p->regropindexbits);
+    p->regropindex = (eo_transm_regrop_slot_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eo_transm_regrop_slot_t), p->regropindexcapacity);
+    
+    s_eo_transmitter_regropindex_clear(p);
+}
+
 
-//    if((inside->thenv.id32 == targetrop->id32) && (inside->ropcode == targetrop->ropcode))
-    if(inside->thenv.id32 == targetrop->id32)
+static void s_eo_transmitter_regropindex_clear(EOtransmitter *p)
+{
+    if(NULL != p->regropindex)
     {
-        return(eores_OK);
+        memset(p->regropindex, 0, sizeof(eo_transm_regrop_slot_t)*p->regropindexcapacity);
     }
-    else
+    memset(p->regropsnumberof_ep, 0, sizeof(p->regropsnumberof_ep));
+}
+
+
+static uint16_t s_eo_transmitter_regropindex_hash(EOtransmitter *p, eOprotID32_t id32)
+{
+    // fibonacci hashing: we keep the most significant bits of the product
+    uint32_t h = (uint32_t)id32 * (uint32_t)2654435761UL;
+    return((uint16_t)(h >> (32 - p->regropindexbits)));
+}
+
+
+static eo_transm_regrop_slot_t * s_eo_transmitter_regropindex_find(EOtransmitter *p, eOprotID32_t id32)
+{
+    // the key is the id32 only, as in the former list search which had the check on the ropcode commented out: 
+    // a netvar cannot be inside the regulars with two different ropcodes.
+    uint16_t mask = p->regropindexcapacity - 1;
+    uint16_t i = 0;
+    
+    if(NULL == p->regropindex)
     {
-        return(eores_NOK_generic);
+        return(NULL);
     }
+    
+    for(i = s_eo_transmitter_regropindex_hash(p, id32); NULL != p->regropindex[i].li; i = (i+1) & mask)
+    {
+        if(id32 == p->regropindex[i].id32)
+        {
+            return(&p->regropindex[i]);
+        }
+    }
+    
+    return(NULL);
 }
 
+
+static void s_eo_transmitter_regropindex_insert(EOtransmitter *p, eOprotID32_t id32, EOlistIter *li)
+{
+    uint16_t mask = p->regropindexcapacity - 1;
+    uint16_t i = 0;
+    eOnvEP8_t ep = eoprot_ID2endpoint(id32);
+    
+    // we are sure that there is a free slot because the list cannot contain more than maxnumberofregularrops items
+    for(i = s_eo_transmitter_regropindex_hash(p, id32); NULL != p->regropindex[i].li; i = (i+1) & mask);
+    
+    p->regropindex[i].id32 = id32;
+    p->regropindex[i].li = li;
+    
+    if(ep < eoprot_endpoints_numberof)
+    {
+        p->regropsnumberof_ep[ep] ++;
+    }
+}
+
+
+static void s_eo_transmitter_regropindex_remove(EOtransmitter *p, eOprotID32_t id32)
+{
+    uint16_t mask = p->regropindexcapacity - 1;
+    eo_transm_regrop_slot_t *slot = s_eo_transmitter_regropindex_find(p, id32);
+    eOnvEP8_t ep = eoprot_ID2endpoint(id32);
+    uint16_t hole = 0;
+    uint16_t i = 0;
+    uint16_t home = 0;
+    
+    if(NULL == slot)
+    {
+        return;
+    }
+    
+    // backward shift deletion: we dont need tombstones, thus the probing never becomes longer after many load / unload
+    hole = (uint16_t)(slot - p->regropindex);
+    p->regropindex[hole].li = NULL;
+    for(i = (hole+1) & mask; NULL != p->regropindex[i].li; i = (i+1) & mask)
+    {
+        home = s_eo_transmitter_regropindex_hash(p, p->regropindex[i].id32);
+        // the item in i can move into the hole only if its home is not cyclically in (hole, i]
+        if(((i - home) & mask) >= ((i - hole) & mask))
+        {
+            p->regropindex[hole] = p->regropindex[i];
+            p->regropindex[i].li = NULL;
+            hole = i;
+        }
+    }
+    
+    if((ep < eoprot_endpoints_numberof) && (p->regropsnumberof_ep[ep] > 0))
+    {
+        p->regropsnumberof_ep[ep] --;
+    }
+}
+
+
 static eOresult_t s_eo_transmitter_entitymatchingrule_rule(void *item, void *param)
 {
     eo_transm_regrop_info_t *inside = (eo_transm_regrop_info_t*)item;
@@ -1338,61 +1903,338 @@ static eOresult_t s_eo_transmitter_entitymatchingrule_rule(void *item, void *par
 }
 
 
-static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param)
+static void s_eo_transmitter_list_compileregrop(void *item, void *param)
 {
     eo_transm_regrop_info_t *inside = (eo_transm_regrop_info_t*)item;
     EOtransmitter *p = (EOtransmitter*)param;
+    eo_transm_regrop_copy_t *copy = &p->regropcopies[p->regropcopiesnumberof];
+    eo_transm_regrop_schedule_t *schedule = NULL;
+    uint32_t now = (uint32_t)p->txregularsprogressive;
+    uint16_t phase = 0;
     
     uint8_t *origofrop;
-    uint8_t *dest;
     
-    // retrieve the beginning of the ropstream inside the ropframe
+    // retrieve the beginning of the ropstream inside the ropframe. the memory of the ropframe does not move, and the
+    // position of the rop inside it changes only with a load / unload of regulars: in such a case we compile again.
     origofrop = eo_ropframe_hid_get_pointer_offset(inside->ropframe, inside->ropstarthere);
-    dest = origofrop + sizeof(eOrophead_t);
+    
+    // if it has a data field ... we shall copy from the nv to the ropstream
+    copy->data      = (eobool_true == inside->hasdata2update) ? (origofrop + sizeof(eOrophead_t)) : (NULL);
+    // if it has a time field ... we shall copy from the current time to the ropstream
+    copy->time      = (EOK_uint16dummy != inside->timeoffsetinsiderop) ? (&origofrop[inside->timeoffsetinsiderop]) : (NULL);
+    copy->ram       = inside->thenv.ram;
+    copy->mtx       = inside->thenv.mtx;
+    copy->seq       = inside->thenv.seq;
+    copy->capacity  = inside->thenv.rom->capacity;
+    copy->ropsize   = inside->ropsize;
+    copy->rop       = origofrop;
+    copy->ropframe  = inside->ropframe;
+    // a rop just compiled is transmitted at first occasion also in delta mode
+    copy->changed   = eobool_true;
+    copy->skipped   = 0;
+    
+    // the default schedule is the same as w/out schedule mode: the cycled ropframes alternate only if both have rops
+    copy->period    = 1;
+    if((eo_transm_regropframe_cycle0of == inside->regropframetype) && (0 != p->totalsizeofregulars_cycle1of))
+    {
+        copy->period = 2;
+    }
+    else if((eo_transm_regropframe_cycle1of == inside->regropframetype) && (0 != p->totalsizeofregulars_cycle0of))
+    {
+        copy->period = 2;
+        phase = 1;
+    }
+    
+    if((eoprot_ID2endpoint(inside->thenv.id32) < eoprot_endpoints_numberof) && (eoprot_ID2entity(inside->thenv.id32) < eo_transm_schedule_maxentities))
+    {
+        schedule = &p->regropschedule[eoprot_ID2endpoint(inside->thenv.id32)][eoprot_ID2entity(inside->thenv.id32)];
+        if(0 != schedule->period)
+        {
+            copy->period = schedule->period;
+            phase = schedule->phase;
+        }
+    }
+    
+    // the first transmission at or after now which has the required phase
+    copy->nextdue   = now + ((phase + copy->period - (now % copy->period)) % copy->period);
+    
+    p->regropcopiesnumberof ++;
+}
+
 
-    // if it has a data field ... copy from the nv to the ropstream
-    if(eobool_true == inside->hasdata2update)
+static void s_eo_transmitter_regulars_compile(EOtransmitter *p)
+{
+    uint16_t i = 0;
+    int16_t j = 0;
+    eo_transm_regrop_copy_t tmp;
+    
+    p->regropcopiesnumberof = 0;
+    eo_list_Execute(p->listofregropinfo, s_eo_transmitter_list_compileregrop, p);
+    
+    // we keep together the copies which use the same mutex, so that in s_eo_transmitter_regulars_copy() we take it 
+    // only once. with eo_nvset_protection_one_per_endpoint (or _one_per_board) we thus have one lock per endpoint 
+    // (or board) rather than one per netvar. the order of the copies is not relevant.
+    for(i=1; i<p->regropcopiesnumberof; i++)
     {
-        // by using eo_nv_hid_Fast_LocalMemoryGet() we use the protection which is configured
-        // by the EOnvscfg object, and the concurrent access to the netvar is managed
-        // internally the nv object.
-        eo_nv_hid_Fast_LocalMemoryGet(&inside->thenv, dest);
+        memcpy(&tmp, &p->regropcopies[i], sizeof(eo_transm_regrop_copy_t));
+        for(j=i-1; (j>=0) && ((uintptr_t)p->regropcopies[j].mtx > (uintptr_t)tmp.mtx); j--)
+        {
+            memcpy(&p->regropcopies[j+1], &p->regropcopies[j], sizeof(eo_transm_regrop_copy_t));
+        }
+        memcpy(&p->regropcopies[j+1], &tmp, sizeof(eo_transm_regrop_copy_t));
+    }
+    
+    p->regropcopiesaredirty = eobool_false;
+}
+
+
+static void s_eo_transmitter_regulars_copy_one(eo_transm_regrop_copy_t *copy, eObool_t delta)
+{
+    if(eobool_false == delta)
+    {
+        memcpy(copy->data, copy->ram, copy->capacity);
+    }
+    else if(0 != memcmp(copy->data, copy->ram, copy->capacity))
+    {   // the ropframe keeps the value last copied, thus we compare vs it. the flag is cleared only when transmitted
+        memcpy(copy->data, copy->ram, copy->capacity);
+        copy->changed = eobool_true;
+    }
+}
+
+
+static void s_eo_transmitter_regulars_copy(EOtransmitter *p)
+{
+    uint16_t i = 0;
+    uint32_t begin = 0;
+    uint8_t attempts = 0;
+    EOVmutexDerived *mtx = NULL;
+    eo_transm_regrop_copy_t *copy = p->regropcopies;
+    eObool_t delta = (p->regularskeyframe > 1) ? (eobool_true) : (eobool_false);
+    
+    for(i=0; i<p->regropcopiesnumberof; i++, copy++)
+    {
+        if((NULL != copy->data) && (NULL != copy->seq))
+        {   // with the seqlock we repeat the copy if the netvar was written meanwhile. only if the writer does not complete
+            // (we may have preempted it) we wait for it on the mutex of the netvar.
+            for(attempts=0; attempts<EONV_SEQLOCK_ATTEMPTS; attempts=eo_nv_hid_Seqlock_Stalls(copy->seq, begin, attempts))
+            {
+                begin = eo_nv_hid_Seqlock_ReadBegin(copy->seq);
+                s_eo_transmitter_regulars_copy_one(copy, delta);
+                if(eobool_false == eo_nv_hid_Seqlock_ReadRetry(copy->seq, begin))
+                {
+                    break;
+                }
+            }
+            if(EONV_SEQLOCK_ATTEMPTS == attempts)
+            {
+                eov_mutex_Take(copy->mtx, eok_reltimeINFINITE);
+                s_eo_transmitter_regulars_copy_one(copy, delta);
+                eov_mutex_Release(copy->mtx);
+            }
+        }
+        else if(NULL != copy->data)
+        {
+            // the copy from the ram of the netvar is protected by the mutex which is configured by the EOnvSet. 
+            // we take it only when it differs from the one of the previous copy.
+            if(copy->mtx != mtx)
+            {
+                eov_mutex_Release(mtx);
+                mtx = copy->mtx;
+                eov_mutex_Take(mtx, eok_reltimeINFINITE);
+            }
+            s_eo_transmitter_regulars_copy_one(copy, delta);
+        }
         
-        // with memcpy the copy from local buffer to dest is not protected, thus data format may be corrupt
-        // in case any concurrent task is in the process of writing the local buffer.
-        //  memcpy(dest, inside->nvloc, inside->capacity);
-        // for debug: memset(dest, 0xaa, inside->capacity); 
+        if(NULL != copy->time)
+        {
+            memcpy(copy->time, &p->currenttime, sizeof(eOabstime_t));
+        }
     }
     
+    eov_mutex_Release(mtx);
+}
+
+
+static void s_eo_transmitter_regulars_erase(EOtransmitter *p, EOlistIter *li)
+{
+    eo_transm_regrop_info_t *regropinfo = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
+    eo_transm_regropframe_t type = (eo_transm_regropframe_t)regropinfo->regropframetype;
+    int16_t ropsize = regropinfo->ropsize;
+    
+    s_eo_transmitter_regropindex_remove(p, regropinfo->thenv.id32);
     
-    // if it has a time field ... copy from the current time to the ropstream
-    if(EOK_uint16dummy != inside->timeoffsetinsiderop)
+    // the rop stays inside its ropframe as a hole: no memmove and no shift of the offsets of the following rops.
+    // s_eo_transmitter_regulars_purge() removes all the holes at once before the ropframe is used again.
+    eo_list_Erase(p->listofregropinfo, li);
+    p->regropframeswithholes |= (1 << type);
+    
+    // decrement the size of relevant ropframe. the sizes count only the live rops
+    s_eo_transmitter_regulars_update_sizes(p, type, -ropsize); 
+    
+    // the compiled regulars must be rebuilt
+    p->regropcopiesaredirty = eobool_true;
+}
+
+
+static void s_eo_transmitter_regulars_purge(EOtransmitter *p)
+{
+    EOropframe *ropframes[3] = {p->ropframeregulars_standard, p->ropframeregulars_cycle0of, p->ropframeregulars_cycle1of};
+    uint8_t *rops[3] = {NULL, NULL, NULL};
+    uint16_t sizeofrops[3] = {0, 0, 0};
+    uint16_t numberofrops[3] = {0, 0, 0};
+    EOlistIter *li = NULL;
+    uint8_t t = 0;
+    
+    if(0 == p->regropframeswithholes)
     {
-        eOabstime_t *time = (eOabstime_t*) (&origofrop[inside->timeoffsetinsiderop]);
-        memcpy(time, &p->currenttime, sizeof(eOabstime_t));
+        return;
     }
     
-//    // if it requires a confirmation ... but it never requires a confirmation. 
-//     if(...)
-//     {
-//         
-//     }
-
+    for(t=0; t<3; t++)
+    {
+        rops[t] = eo_ropframe_hid_get_rops(ropframes[t], &sizeofrops[t], &numberofrops[t]);
+        sizeofrops[t] = 0;
+        numberofrops[t] = 0;
+    }
+    
+    // inside each ropframe the rops are in the same order as in the list, thus we can compact them in place with a single walk:
+    // every live rop of a ropframe with holes moves down to the end of the live rops before it.
+    for(li = eo_list_Begin(p->listofregropinfo); NULL != li; li = eo_list_Next(p->listofregropinfo, li))
+    {
+        eo_transm_regrop_info_t *item = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
+        t = item->regropframetype;
+        
+        if((0 != (p->regropframeswithholes & (1 << t))) && (item->ropstarthere != sizeofrops[t]))
+        {
+            memmove(rops[t] + sizeofrops[t], rops[t] + item->ropstarthere, item->ropsize);
+            item->ropstarthere = sizeofrops[t];
+        }
+        
+        sizeofrops[t] += item->ropsize;
+        numberofrops[t] ++;
+    }
+    
+    for(t=0; t<3; t++)
+    {
+        if(0 != (p->regropframeswithholes & (1 << t)))
+        {
+            eo_ropframe_hid_rops_Shrink(ropframes[t], sizeofrops[t], numberofrops[t]);
+        }
+    }
+    
+    p->regropframeswithholes = 0;
+    
+    // the positions of the rops have changed
+    p->regropcopiesaredirty = eobool_true;
 }
 
 
-static void s_eo_transmitter_list_shiftdownropinfo(void *item, void *param)
+static uint16_t s_eo_transmitter_regulars_delta_add(EOtransmitter *p, EOropframe *intoropframe, EOropframe *cycledregulars)
 {
-    eo_transm_regrop_info_t *after = (eo_transm_regrop_info_t*)item;
-    eo_transm_regrop_info_t *theone2beremoved = (eo_transm_regrop_info_t*)param;
+    uint16_t i = 0;
+    uint16_t n = 0;
+    uint16_t remainingbytes = 0;
+    eo_transm_regrop_copy_t *copy = NULL;
+    
+    // a purge after the refresh may have moved the rops
+    if(eobool_true == p->regropcopiesaredirty)
+    {
+        s_eo_transmitter_regulars_compile(p);
+    }
+    
+    // the rops of the standard ropframe plus those of the cycled one (if any) are added only if they have changed since their 
+    // last transmission or if they were skipped for regularskeyframe-1 times. in this way the receiver, which keeps the 
+    // last value, recovers a lost packet within regularskeyframe transmissions.
+    for(i=0, copy=p->regropcopies; i<p->regropcopiesnumberof; i++, copy++)
+    {
+        if((copy->ropframe != p->ropframeregulars_standard) && (copy->ropframe != cycledregulars))
+        {
+            continue;
+        }
+        
+        if((eobool_false == copy->changed) && ((copy->skipped + 1) < p->regularskeyframe))
+        {
+            copy->skipped ++;
+            continue;
+        }
+        
+        if(eores_OK == eo_ropframe_ROPdata_Add(intoropframe, copy->rop, copy->ropsize, &remainingbytes))
+        {
+            copy->changed = eobool_false;
+            copy->skipped = 0;
+            n ++;
+        }
+    }
+    
+    return(n);
+}
 
-    // for each element after: modify its content so that ropstarthere is decremented by theone2beremoved.ropsize
-    // but only if they have the same regropframetype
 
-    if(after->ropframe == theone2beremoved->ropframe)
+
+static uint16_t s_eo_transmitter_regulars_schedule_add(EOtransmitter *p, EOropframe *intoropframe)
+{
+    uint16_t i = 0;
+    uint16_t j = 0;
+    uint16_t n = 0;
+    uint16_t numberofdue = 0;
+    uint16_t remainingbytes = 0;
+    uint16_t budget = p->effectivecapacityofregulars;
+    uint32_t now = (uint32_t)p->txregularsprogressive;
+    eo_transm_regrop_copy_t *copy = NULL;
+    
+    // a purge after the refresh may have moved the rops
+    if(eobool_true == p->regropcopiesaredirty)
     {
-        after->ropstarthere -= theone2beremoved->ropsize;
+        s_eo_transmitter_regulars_compile(p);
     }
+    
+    // the queue of the rops which are due, sorted by deadline. we use an insertion sort because the rops are few and 
+    // the copies are visited always in the same order. the comparisons are done on differences so that the wrap of 
+    // the 32 bits of the deadline is harmless.
+    for(i=0, copy=p->regropcopies; i<p->regropcopiesnumberof; i++, copy++)
+    {
+        if((int32_t)(copy->nextdue - now) > 0)
+        {
+            continue;
+        }
+        
+        for(j=numberofdue; (j>0) && ((int32_t)(p->regropcopies[p->regropdue[j-1]].nextdue - copy->nextdue) > 0); j--)
+        {
+            p->regropdue[j] = p->regropdue[j-1];
+        }
+        p->regropdue[j] = i;
+        numberofdue ++;
+    }
+    
+    // then we pack the ropframe earliest deadline first, within the capacity reserved to the regulars. a rop which does 
+    // not fit keeps its deadline, thus at next transmission it comes before those which are due later.
+    for(i=0; i<numberofdue; i++)
+    {
+        copy = &p->regropcopies[p->regropdue[i]];
+        
+        if((p->regularskeyframe > 1) && (eobool_false == copy->changed) && ((copy->skipped + 1) < p->regularskeyframe))
+        {   // in delta mode an unchanged rop skips its turn as if it was transmitted
+            copy->skipped ++;
+            copy->nextdue = now + copy->period;
+            continue;
+        }
+        
+        if(copy->ropsize > budget)
+        {
+            continue;
+        }
+        
+        if(eores_OK == eo_ropframe_ROPdata_Add(intoropframe, copy->rop, copy->ropsize, &remainingbytes))
+        {
+            budget -= copy->ropsize;
+            copy->changed = eobool_false;
+            copy->skipped = 0;
+            copy->nextdue = now + copy->period;
+            n ++;
+        }
+    }
+    
+    return(n);
 }
 
 
@@ -1400,6 +2242,7 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
 {
     // marco.accame on 23oct14: mtx protects the occasional or replies ropframe. p->mtx_roptmp protects the use of tmprop
     eOresult_t res;
+    eOresult_t confres = eores_OK;
     uint16_t usedbytes;
     uint16_t ropsize;
     uint16_t remainingbytes;   
@@ -1468,6 +2311,14 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
     }
 
 
+    // a rop with a confirmation request which the confirmation manager cannot track must not be sent at all
+    if((1 == ropdesc->control.rqstconf) && (NULL != p->confmanager) && 
+       (eobool_false == eo_confman_hid_ConfirmationRequest_HasRoom(p->confmanager, ropdesc)))
+    {
+        p->lasterror = 6;
+        return(eores_NOK_generic);
+    }
+
     // we begin the use in rw of p->tmprop: take its mutex ... we must avoid that a concurrent thread use it at the same time.
     eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
            
@@ -1480,9 +2331,14 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
         return(res);
     }
 
-    // put the rop inside the ropframe: protec ropframe vs concurrent use
+    // put the rop inside the ropframe: protec ropframe vs concurrent use. the confirmation manager queues the rop under
+    // the same mutex, so that it knows in which packet it goes
     eov_mutex_Take(mtx, eok_reltimeINFINITE);
     res = eo_ropframe_ROP_Add(intoropframe, p->roptmp, NULL, &ropsize, &remainingbytes);
+    if((eores_OK == res) && (1 == ropdesc->control.rqstconf) && (NULL != p->confmanager))
+    {
+        confres = eo_confman_hid_ConfirmationRequest_Queue(p->confmanager, ropdesc, (intoropframe == p->ropframereplies) ? (eoconfman_queue_replies) : (eoconfman_queue_occasionals));
+    }
     eov_mutex_Release(mtx);
     
     // we dont use p->tmprop anymore: release its mutex
@@ -1496,17 +2352,26 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
         eo_ropframe_EffectiveCapacity_Get(intoropframe, &ss); // no need to protect using mutex as we read its capacity which stays constant all over the time
         p->lasterror_info2  = ss;
         p->lasterror = 5;
+        
+        // the loaders of occasionals and of replies have each their own counter, protected by the mutex of their ropframe
+        eov_mutex_Take(mtx, eok_reltimeINFINITE);
+        if(intoropframe == p->ropframereplies)
+        {
+            p->stats.repliesnotloaded ++;
+        }
+        else
+        {
+            p->stats.occasionalsnotloaded ++;
+        }
+        eov_mutex_Release(mtx);
     }
     
     
  
     // if conf request is flagged on
-    if((eores_OK == res) && (1 == ropdesc->control.rqstconf) && ((NULL != p->confmanager)))
+    if(eores_OK != confres)
     {
-        if(eores_OK != eo_confman_ConfirmationRequest_Insert(p->confmanager, ropdesc))
-        {
-            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "s_eo_transmitter_rops_Load(): fails in processing a conf-request", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
-        }
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "s_eo_transmitter_rops_Load(): fails in processing a conf-request", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
     }
   
     return(res);   
@@ -1602,6 +2467,12 @@ static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm
     uint16_t cy0 = 0;
     uint16_t cy1 = 0;
     
+    if(eobool_true == p->regularsscheduled)
+    {   // in schedule mode the rops are packed by deadline, thus it is enough that the rop fits a transmission. the capacity 
+        // of the regular ropframe which keeps it is verified by eo_ropframe_ROP_Add()
+        return((ropbytes > p->effectivecapacityofregulars) ? (eobool_false) : (eobool_true));
+    }
+    
     std = p->totalsizeofregulars_standard;
     cy0 = p->totalsizeofregulars_cycle0of;
     cy1 = p->totalsizeofregulars_cycle1of;
@@ -1652,6 +2523,144 @@ static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_r
     p->maxsizeofregulars = s_eo_transmitter_get_maxsizeof_regularsropframe(p);
 }
 
+
+static uint16_t s_eo_transmitter_iov_add(eOtransmitter_iov_t *iov, EOropframe *ropframe, uint16_t capacity, eObool_t *toobig)
+{
+    uint16_t sizeofrops = 0;
+    uint16_t numberofrops = 0;
+    uint8_t *rops = NULL;
+    
+    if(eobool_false == eo_ropframe_IsValid(ropframe))
+    {
+        return(0);
+    }
+    
+    rops = eo_ropframe_hid_get_rops(ropframe, &sizeofrops, &numberofrops);
+    
+    if(0 == sizeofrops)
+    {
+        return(0);
+    }
+    
+    // as eo_ropframe_Append() does: if the rops dont fit, then we dont add them
+    if((iov->size + sizeofrops) > capacity)
+    {
+        *toobig = eobool_true;
+        return(0);
+    }
+    
+    iov->spans[iov->numberofspans].data = rops;
+    iov->spans[iov->numberofspans].size = sizeofrops;
+    iov->numberofspans ++;
+    iov->size += sizeofrops;
+    
+    return(numberofrops);
+}
+
+
+static void s_eo_transmitter_ropframe_swap(EOropframe *ropframe, uint8_t **buffer, uint8_t **bufferinflight)
+{
+    uint8_t *tmp = NULL;
+    uint8_t *data = NULL;
+    uint16_t size = 0;
+    uint16_t capacity = 0;
+    
+    if(NULL == *buffer)
+    {   // the ropframe has zero capacity
+        return;
+    }
+    
+    eo_ropframe_Get(ropframe, &data, &size, &capacity);
+    
+    if(NULL == *bufferinflight)
+    {   // first time: we get the second buffer
+        *bufferinflight = (uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacity, 1);
+    }
+    
+    tmp = *buffer;
+    *buffer = *bufferinflight;
+    *bufferinflight = tmp;
+    
+    eo_ropframe_Load(ropframe, *buffer, eo_ropframe_sizeforZEROrops, capacity);
+    eo_ropframe_Clear(ropframe);
+}
+
+
+static void s_eo_transmitter_confirmations_retransmit(EOtransmitter *p)
+{
+    eOropdescriptor_t ropdesc;
+    
+    if(NULL == p->confmanager)
+    {
+        return;
+    }
+    
+    // if the occasionals are full the rop waits for another timeout inside the confirmation manager w/out counting a 
+    // retransmission. the other expired rops wait for the next packet
+    while(eores_OK == eo_confman_hid_Retransmission_Get(p->confmanager, &ropdesc))
+    {
+        if(eores_OK != eo_transmitter_occasional_rops_Load(p, &ropdesc))
+        {
+            eo_confman_hid_Retransmission_Failed(p->confmanager, &ropdesc);
+            break;
+        }
+    }
+}
+
+
+// it returns 0 if the histogram of times is not enabled, so that we dont pay for the nanotime
+static eOnanotime_t s_eo_transmitter_nanotime(EOtransmitter *p)
+{
+    eOnanotime_t nanotime = 0;
+    
+    if(eobool_true == p->stats.timing)
+    {
+        eov_sys_NanoTimeGet(eov_sys_GetHandle(), &nanotime);
+    }
+    
+    return(nanotime);
+}
+
+
+// it returns eobool_false if it does not get a consistent copy, e.g., because it has preempted a writer
+static eObool_t s_eo_transmitter_stats_copy(EOtransmitter *p, eOtransmitter_stats_t *stats)
+{
+    uint32_t begin = 0;
+    uint8_t attempts = 0;
+    
+    for(attempts=0; attempts<EONV_SEQLOCK_ATTEMPTS; attempts=eo_nv_hid_Seqlock_Stalls(&p->stats.seq, begin, attempts))
+    {
+        begin = eo_nv_hid_Seqlock_ReadBegin(&p->stats.seq);
+        memcpy(stats, &p->stats.current, sizeof(eOtransmitter_stats_t));
+        if(eobool_false == eo_nv_hid_Seqlock_ReadRetry(&p->stats.seq, begin))
+        {   // the counters of the loaders are single words: we just read them
+            stats->ropsnotloaded = p->stats.occasionalsnotloaded + p->stats.repliesnotloaded;
+            return(eobool_true);
+        }
+    }
+    
+    return(eobool_false);
+}
+
+
+static void s_eo_transmitter_stats_ropframe(EOtransmitter *p, const eOtransmitter_ropsnumber_t *ropsnum, uint16_t size, eOnanotime_t timeofstart)
+{
+    eo_nv_hid_Seqlock_WriteBeginSingle(&p->stats.seq);
+    
+    p->stats.current.ropframes ++;
+    p->stats.current.bytes += size;
+    p->stats.current.regulars += ropsnum->numberofregulars;
+    p->stats.current.occasionals += ropsnum->numberofoccasionals;
+    p->stats.current.replies += ropsnum->numberofreplies;
+    if(eobool_true == p->stats.timing)
+    {
+        p->stats.current.timeofpreparation[eo_transportstats_hid_Timebin(s_eo_transmitter_nanotime(p) - timeofstart)] ++;
+    }
+    
+    eo_nv_hid_Seqlock_WriteEnd(&p->stats.seq);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
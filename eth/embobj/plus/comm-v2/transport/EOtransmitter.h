@@ -42,6 +42,7 @@ extern "C" {
 
 #include "EoCommon.h"
 #include "EOropframe.h"
+#include "EOtransportStats.h"
 #include "EOpacket.h"
 #include "EOnvSet.h"
 #include "EOagent.h"
@@ -101,6 +102,47 @@ typedef struct
     uint8_t     numberofregulars;
     uint8_t     numberofreplies;    
 } eOtransmitter_ropsnumber_t;
+
+
+enum { eo_transmitter_iov_maxnumberofspans = 6 };   // header, regulars standard, regulars cycled, occasionals, replies, footer
+
+typedef struct
+{
+    const uint8_t*  data;
+    uint16_t        size;
+} eOtransmitter_span_t;
+
+/** @typedef    typedef struct eOtransmitter_iov_t
+    @brief      it describes the out ropframe as a sequence of spans which, once concatenated, are equal to the payload 
+                of the packet formed by eo_transmitter_outpacket_Prepare() + eo_transmitter_outpacket_Get(). 
+                it can be passed to a scatter-gather send (e.g., sendmsg()) span by span.
+ **/
+typedef struct
+{
+    uint16_t                size;               // the sum of the sizes of the spans
+    uint8_t                 numberofspans;
+    uint8_t                 filler;
+    eOtransmitter_span_t    spans[eo_transmitter_iov_maxnumberofspans];
+} eOtransmitter_iov_t;
+
+
+/** @typedef    typedef struct eOtransmitter_stats_t
+    @brief      contains the statistics of the transmitter since its creation or since the last eo_transmitter_Stats_Reset(). 
+                all its fields are uint32_t counters which wrap around. the histogram of times is filled only when 
+                enabled with eo_transmitter_Stats_Timing_Enable().
+ **/
+typedef struct
+{
+    uint32_t                ropframes;              /**< the ropframes formed by eo_transmitter_outpacket_Prepare() or eo_transmitter_outpacket_GetIOV() */
+    uint32_t                bytes;                  /**< their size */
+    uint32_t                regulars;               /**< the regular rops inside them */
+    uint32_t                occasionals;            /**< the occasional rops inside them */
+    uint32_t                replies;                /**< the reply rops inside them */
+    uint32_t                ropsnotloaded;          /**< the occasional or reply rops which did not fit inside their ropframe */
+    uint32_t                ropframestoobig;        /**< the ropframes bigger than the packet */
+    uint32_t                timeofpreparation[eo_transportstats_timebins_numberof];   /**< histogram of the time to form the ropframe */
+} eOtransmitter_stats_t;
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -148,8 +190,26 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
 extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outpkt);
 
 
+/** @fn         extern eOresult_t eo_transmitter_outpacket_GetIOV(EOtransmitter *p, eOtransmitter_iov_t *iov, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
+    @brief      it is the alternative to eo_transmitter_outpacket_Prepare() + eo_transmitter_outpacket_Get(): it forms the
+                out ropframe without copying the rops into the out packet. the spans point inside the ropframes of the 
+                transmitter and stay valid until the next call of eo_transmitter_outpacket_GetIOV() or of
+                eo_transmitter_outpacket_Prepare(), or until a change of the regular rops.
+    @param      p               pointer to transmitter        
+    @param      iov             in output it contains the spans of the ropframe
+    @param      numberofrops    in output it contains number of rops in the ropframe. it can be NULL.
+    @param      ropsnum         in output it contains number of rops of each kind. it can be NULL.
+    @return     eores_OK or eores_NOK_nullpointer
+ **/
+extern eOresult_t eo_transmitter_outpacket_GetIOV(EOtransmitter *p, eOtransmitter_iov_t *iov, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum);
+
+
 extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repliesTXdecimation, uint8_t regularsTXdecimation, uint8_t occasionalsTXdecimation);
 
+// if on is eobool_true the ropframes formed by eo_transmitter_outpacket_Get() and eo_transmitter_outpacket_GetIOV() carry a CRC32C 
+// footer (see eo_ropframe_CRC_Seal()). it must be enabled only towards a remote which understands it: use eo_receiver_RemoteUsesCRC().
+extern eOresult_t eo_transmitter_ropframeCRC_Set(EOtransmitter *p, eObool_t on);
+
 // the rops in regular_rops stay forever unless unloaded one by one or all cleared. at each eo_transmitter_outpacket_Prepare() they are placed 
 // inside the packet. they however need an explicit refresh of their values. 
 extern eOsizecntnr_t eo_transmitter_regular_rops_Size(EOtransmitter *p);
@@ -162,13 +222,39 @@ extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eO
 extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p); 
 extern eOresult_t eo_transmitter_regular_rops_Refresh(EOtransmitter *p);
 
+// it enables the delta mode of the regulars if keyframe > 1: a regular rop is transmitted only if its data has changed since its 
+// last transmission, or else once every keyframe times so that the receiver recovers from lost packets. the ropframe is formed 
+// anyway, even w/out regulars. with keyframe equal to 0 or 1 (the default) every regular is always transmitted.
+extern eOresult_t eo_transmitter_regular_rops_Delta_Set(EOtransmitter *p, uint8_t keyframe);
+
+// it gives to the regular rops of entity ent of endpoint ep8 their own schedule: they are transmitted once every period 
+// transmissions of the regulars, at those for which the progressive number modulo period is phase. with period equal to 0 the 
+// entity goes back to the default schedule. when at least one entity has its own schedule, the rops which are due are packed 
+// earliest deadline first within the capacity of the regulars, and a rop which does not fit is transmitted at next occasion. 
+// in this mode the regulars can be more than what fits in a single transmission as long as their average rate fits. the period
+// can be up to 65535 transmissions, e.g., once every second with regulars at 1 kHz. eo_transmitter_regular_rops_Clear() removes
+// the schedules of all the entities.
+extern eOresult_t eo_transmitter_regular_rops_Schedule_Set(EOtransmitter *p, eOnvEP8_t ep8, eOnvENT_t ent, uint16_t period, uint16_t phase);
+
 // the rops in occasional_rops are inserted with following functions, put inside the packet with function eo_transmitter_outpacket_Get()
 // and after that they are cleared.
 
 extern eOresult_t eo_transmitter_lasterror_Get(EOtransmitter *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2);
 
+// the statistics of the transmitter: they are always collected, a copy is consistent even if done by another thread and  
+// the reset can be called by any thread (but two of them must not preempt each other). they return eores_NOK_busy if the 
+// statistics were being updated all along, e.g., the caller has preempted the transmitter: the caller can try again later.
+// the histogram of times is disabled by default because it needs the nanotime.
+extern eOresult_t eo_transmitter_Stats_Get(EOtransmitter *p, eOtransmitter_stats_t *stats);
+extern eOresult_t eo_transmitter_Stats_Reset(EOtransmitter *p);
+extern eOresult_t eo_transmitter_Stats_Timing_Enable(EOtransmitter *p, eObool_t enable);
+
 extern eOresult_t eo_transmitter_occasional_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc);
 extern eOresult_t eo_transmitter_occasional_rops_LoadStream(EOtransmitter *p, uint8_t *stream, uint16_t size);
+// it loads numberofrops complete rops packed one after the other inside stream, all or none. remainingbytes can be NULL.
+extern eOresult_t eo_transmitter_occasional_rops_LoadStreamOfROPs(EOtransmitter *p, uint8_t *stream, uint16_t size, uint16_t numberofrops, uint16_t *remainingbytes);
+// the bytes still available for rops inside the ropframe of the occasionals
+extern uint16_t eo_transmitter_occasional_rops_Available(EOtransmitter *p);
 
 extern eOresult_t eo_transmitter_reply_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc);
 extern eOresult_t eo_transmitter_reply_ropframe_Load(EOtransmitter *p, EOropframe* ropframe);
@@ -36,6 +36,7 @@ extern "C" {
 #include "EoCommon.h"
 #include "EOpacket.h"
 #include "EOropframe.h"
+#include "EOropframe_hid.h"
 #include "EOrop.h"
 #include "EOnvSet.h"
 #include "EOagent.h"
@@ -44,6 +45,7 @@ extern "C" {
 #include "EOnv_hid.h"
 #include "EOconfirmationManager.h"
 #include "EOvector.h"
+#include "EoProtocol.h"
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
  
@@ -76,12 +78,68 @@ typedef struct      // 40 bytes on arm .... but not 40 on a 64-bit architecture
 } eo_transm_regrop_info_t;   //EO_VERIFYsizeof(eo_transm_regrop_info_t, (8+28+4))
 
 
+// the compiled form of the regulars. it is rebuilt from listofregropinfo only when the set of regulars 
+// changes, so that eo_transmitter_regular_rops_Refresh() is a tight loop of memcpy() without any list walk.
+typedef struct
+{
+    uint8_t*            data;       // where the data of the rop is inside its regular ropframe. NULL if the rop has no data
+    uint8_t*            time;       // where the time of the rop is inside its regular ropframe. NULL if the rop has no time
+    const void*         ram;        // the local ram of the netvar
+    EOVmutexDerived*    mtx;        // the mutex of the netvar (or of its endpoint or board). it depends on the protection of the EOnvSet
+    volatile uint32_t*  seq;        // the sequence counter of the netvar if the EOnvSet uses eo_nvset_protection_seqlock, else NULL
+    uint16_t            capacity;
+    uint16_t            ropsize;    // the size of the whole rop. the following fields are used only in delta mode
+    uint8_t*            rop;        // where the rop starts inside its regular ropframe
+    EOropframe*         ropframe;   // the regular ropframe of the rop
+    eObool_t            changed;    // its data has changed since the last time it was transmitted
+    uint8_t             skipped;    // how many consecutive times it was not transmitted because unchanged
+    uint16_t            period;     // used only in schedule mode: the rop is due once every period transmissions of the regulars
+    uint32_t            nextdue;    // used only in schedule mode: the value of txregularsprogressive at which the rop is due
+} eo_transm_regrop_copy_t;
+
+
+// the schedule of the regular rops of an entity. a period equal to 0 keeps the default schedule which is given 
+// by the regular ropframe of the rop (see s_eo_transmitter_id32_to_typeofregulars()).
+enum { eo_transm_schedule_maxentities = 8 };
+
+typedef struct
+{
+    uint16_t            period;     // the rops are due once every period transmissions of the regulars
+    uint16_t            phase;      // the rops are due when (txregularsprogressive % period) is equal to phase
+} eo_transm_regrop_schedule_t;
+
+
+// a slot of the open-addressing index of the regulars. it maps the id32 of a regular rop into the iterator
+// of its eo_transm_regrop_info_t inside listofregropinfo, so that load and unload do not need to walk the list. 
+// the key is the id32 only because a netvar can be inside the regulars only once (see s_eo_transmitter_regropindex_find()).
+typedef struct
+{
+    eOprotID32_t        id32;
+    EOlistIter*         li;         // NULL if the slot is empty
+} eo_transm_regrop_slot_t;
+
+
 typedef struct
 {
     uint32_t    txropframeistoobigforthepacket;
 } EOtransmitterDEBUG_t;
 
 
+// current is written only by the thread which transmits, hence its seqlock (see eo_nv_hid_Seqlock_ReadBegin()). the threads 
+// which load occasionals and replies count the rops not loaded each in its own counter, under the mutex of its ropframe. 
+// eo_transmitter_Stats_Get() returns current, with ropsnotloaded given by those counters, minus baseline.
+typedef struct
+{
+    volatile uint32_t           seq;
+    eOtransmitter_stats_t       current;
+    volatile uint32_t           occasionalsnotloaded;   // protected by mtx_occasionals
+    volatile uint32_t           repliesnotloaded;       // protected by mtx_replies
+    volatile uint32_t           seqofbaseline;
+    eOtransmitter_stats_t       baseline;       // the value of current at the last eo_transmitter_Stats_Reset()
+    eObool_t                    timing;
+} eOtransmitter_statistics_t;
+
+
 /** @struct     EOtransmitter_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -132,6 +190,24 @@ struct EOtransmitter_hid
     uint16_t                    maxsizeofregulars;
     uint16_t                    effectivecapacityofregulars;
     uint64_t                    txregularsprogressive;
+    eo_transm_regrop_copy_t*    regropcopies;
+    uint16_t                    regropcopiesnumberof;
+    eObool_t                    regropcopiesaredirty;
+    EOropframeHeader_t          iovheader;
+    EOropframeFooter_t          iovfooter;
+    uint8_t*                    bufferropframeoccasionals_inflight;
+    uint8_t*                    bufferropframereplies_inflight;
+    eo_transm_regrop_slot_t*    regropindex;
+    uint16_t                    regropindexcapacity;    // a power of two at least twice maxnumberofregularrops
+    uint8_t                     regropindexbits;        // log2(regropindexcapacity)
+    eObool_t                    ropframecrc;            // if eobool_true the ropframe to tx has the CRC32C footer
+    uint16_t                    regropsnumberof_ep[eoprot_endpoints_numberof];
+    uint8_t                     regropframeswithholes;  // bit (1 << eo_transm_regropframe_t) is set if that ropframe keeps the bytes of unloaded rops
+    uint8_t                     regularskeyframe;       // if > 1 the regulars are in delta mode and an unchanged rop is transmitted once every regularskeyframe times
+    eObool_t                    regularsscheduled;      // if eobool_true at least one entity has its own schedule and the regulars are packed by deadline
+    uint16_t*                   regropdue;              // the indices inside regropcopies of the rops which are due, in order of deadline
+    eo_transm_regrop_schedule_t regropschedule[eoprot_endpoints_numberof][eo_transm_schedule_maxentities];
+    eOtransmitter_statistics_t  stats;
 }; 
 
 
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  iCub Facility
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOTRANSPORTSTATS_H_
+#define _EOTRANSPORTSTATS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOtransportStats.h
+    @brief      This header file contains what the statistics of EOreceiver and EOtransmitter have in common.
+    @author     iCub Facility
+    @date       10/17/2026
+**/
+
+/** @defgroup eo_transportstats EOtransportStats
+    The EOreceiver and the EOtransmitter keep histograms of durations with eo_transportstats_timebins_numberof bins:
+    bin 0 counts what lasts less than 1 usec, bin i what lasts from 2^(i-1) usec to less than 2^i usec, and the last bin 
+    what lasts 1024 usec or more. the last bin thus starts at 1024 usec and not at 1 ms: what lasts from 1000 to 1023 usec 
+    is counted in the bin before.
+    
+    @{        
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types ------------------------------------------------------------------------- 
+
+enum { eo_transportstats_timebins_numberof = 12 };
+
+    
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+// empty-section
+
+
+/** @}            
+    end of group eo_transportstats  
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
+
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  iCub Facility
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOTRANSPORTSTATS_HID_H_
+#define _EOTRANSPORTSTATS_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOtransportStats_hid.h
+    @brief      This header file implements hidden interface to the statistics of EOreceiver and EOtransmitter.
+    @author     iCub Facility
+    @date       10/17/2026
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+ 
+#include "EOtransportStats.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+// empty-section
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+
+// it returns the bin of a duration of nanosec nanoseconds in a histogram of eo_transportstats_timebins_numberof bins.
+// it is inline as it is called for every rop when the histograms are enabled.
+EO_static_inline uint8_t eo_transportstats_hid_Timebin(uint64_t nanosec)
+{
+    uint32_t usec = 0;
+    uint8_t bin = 0;
+    
+    if(nanosec >= 1024000)
+    {
+        return(eo_transportstats_timebins_numberof-1);
+    }
+    
+    // the bin is the number of bits of usec, which is now lower than 1024
+    usec = (uint32_t)nanosec / 1000;
+    while(0 != usec)
+    {
+        bin++;
+        usec >>= 1;
+    }
+    
+    return(bin);
+}
+
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+ 
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
+